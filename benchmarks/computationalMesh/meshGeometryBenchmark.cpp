@@ -0,0 +1,78 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cstddef>
+#include <vector>
+
+// third-party include headers
+#include <benchmark/benchmark.h>
+
+// AIM include headers
+#include "src/computationalMesh/faceTopology/faceTopology.hpp"
+#include "src/computationalMesh/meshGeometry/meshGeometry.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+// Measures the throughput of the geometry precomputation (cell volumes and centroids, face area vectors and centroids
+// and distance vectors) on a structured quad grid of n x n cells, where n is the benchmark argument. The face topology
+// is built once outside the timed loop. The cells/s counter is the number of cells processed per second, divide by
+// 1e6 to get the throughput per million cells.
+
+namespace {
+
+using MeshGeometryType = AIM::Mesh::MeshGeometry<AIM::Enum::Dimension::Two>;
+using FaceTopologyType = AIM::Mesh::FaceTopology<AIM::Enum::Dimension::Two>;
+
+struct GridType {
+  std::vector<AIM::Types::FloatType> x, y;
+  FaceTopologyType::ConnectivityTableType cells;
+  FaceTopologyType::BoundaryFaceConnectivityType boundaryFaces;
+};
+
+auto makeGrid(AIM::Types::UInt numberOfCellsPerDirection) -> GridType {
+  auto grid = GridType{};
+  auto numberOfVerticesPerDirection = numberOfCellsPerDirection + 1;
+  auto vertex = [numberOfVerticesPerDirection](AIM::Types::UInt i, AIM::Types::UInt j) {
+    return j * numberOfVerticesPerDirection + i;
+  };
+
+  for (AIM::Types::UInt j = 0; j < numberOfVerticesPerDirection; ++j)
+    for (AIM::Types::UInt i = 0; i < numberOfVerticesPerDirection; ++i) {
+      grid.x.push_back(static_cast<AIM::Types::FloatType>(i) / numberOfCellsPerDirection);
+      grid.y.push_back(static_cast<AIM::Types::FloatType>(j) / numberOfCellsPerDirection);
+    }
+  for (AIM::Types::UInt j = 0; j < numberOfCellsPerDirection; ++j)
+    for (AIM::Types::UInt i = 0; i < numberOfCellsPerDirection; ++i)
+      grid.cells.addCell(std::vector<AIM::Types::UInt>{vertex(i, j), vertex(i + 1, j), vertex(i + 1, j + 1),
+        vertex(i, j + 1)});
+
+  grid.boundaryFaces.resize(1);
+  for (AIM::Types::UInt index = 0; index < numberOfCellsPerDirection; ++index) {
+    auto last = numberOfCellsPerDirection;
+    grid.boundaryFaces[0].addCell(std::vector<AIM::Types::UInt>{vertex(index, 0), vertex(index + 1, 0)});
+    grid.boundaryFaces[0].addCell(std::vector<AIM::Types::UInt>{vertex(last, index), vertex(last, index + 1)});
+    grid.boundaryFaces[0].addCell(std::vector<AIM::Types::UInt>{vertex(index + 1, last), vertex(index, last)});
+    grid.boundaryFaces[0].addCell(std::vector<AIM::Types::UInt>{vertex(0, index + 1), vertex(0, index)});
+  }
+  return grid;
+}
+
+}  // namespace
+
+static void meshGeometry(benchmark::State &state) {
+  auto grid = makeGrid(static_cast<AIM::Types::UInt>(state.range(0)));
+  auto faceTopology = FaceTopologyType{grid.cells, grid.boundaryFaces};
+
+  for (auto _ : state) {
+    auto geometry = MeshGeometryType{{grid.x, grid.y}, grid.cells, faceTopology};
+    benchmark::DoNotOptimize(geometry.getCellVolumes().data());
+  }
+  state.counters["cells/s"] =
+    benchmark::Counter(static_cast<double>(grid.cells.size()), benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["faces/s"] = benchmark::Counter(
+    static_cast<double>(faceTopology.getNumberOfFaces()), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(meshGeometry)->RangeMultiplier(4)->Range(1 << 6, 1 << 11)->UseRealTime()->Unit(benchmark::kMillisecond);
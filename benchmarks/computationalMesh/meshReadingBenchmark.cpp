@@ -0,0 +1,175 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+// third-party include headers
+#include <benchmark/benchmark.h>
+
+#include <nlohmann/json.hpp>
+
+// AIM include headers
+#include "benchmarks/computationalMesh/syntheticMesh.hpp"
+#include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/faceTopology/faceTopology.hpp"
+#include "src/computationalMesh/meshGeometry/meshGeometry.hpp"
+#include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+// Measures how reading and setting up the mesh scales with the mesh size on synthetic triangle and quad meshes (see
+// AIM::Benchmark::SyntheticMesh). The first benchmark argument is the (minimum) number of cells, the second the element
+// type (0: triangles, 1: quads). Meshes range from 1e3 cells up to the number of cells given by the environment
+// variable AIM_BENCHMARK_MAX_CELLS (default 1e6, use 1e8 for a full scaling study). Each mesh is generated once per
+// process in the temporary directory and removed at exit, generation is not part of the measured time.
+//
+// Besides the total time, each benchmark reports the average time per stage in seconds, the read throughput (bytes/s
+// of the mesh file and cells/s) and the peak resident set size of the benchmark in MiB. The peak is reset before each
+// benchmark on Linux, on other platforms it is the peak of the process so far.
+
+namespace {
+
+using MeshReaderType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>;
+using ComputationalMeshType = AIM::Mesh::ComputationalMesh<AIM::Enum::Dimension::Two>;
+using FaceTopologyType = AIM::Mesh::FaceTopology<AIM::Enum::Dimension::Two>;
+using MeshGeometryType = AIM::Mesh::MeshGeometry<AIM::Enum::Dimension::Two>;
+using ClockType = std::chrono::steady_clock;
+
+auto getSyntheticMesh(std::size_t numberOfCells, AIM::Enum::ElementType elementType, const nlohmann::json& parameters)
+  -> const AIM::Benchmark::SyntheticMesh& {
+  using KeyType = std::tuple<std::size_t, int, std::string>;
+  static auto meshes = std::map<KeyType, std::unique_ptr<AIM::Benchmark::SyntheticMesh>>{};
+  auto &mesh = meshes[KeyType{numberOfCells, elementType, parameters.dump()}];
+  if (!mesh)
+    mesh = std::make_unique<AIM::Benchmark::SyntheticMesh>(numberOfCells, elementType, parameters);
+  return *mesh;
+}
+
+auto getMaximumNumberOfCells() -> std::int64_t {
+  auto maximumNumberOfCells = std::getenv("AIM_BENCHMARK_MAX_CELLS");
+  return maximumNumberOfCells ? static_cast<std::int64_t>(std::stod(maximumNumberOfCells)) : 1'000'000;
+}
+
+auto addMeshSizes(benchmark::internal::Benchmark *benchmark) -> void {
+  for (std::int64_t numberOfCells = 1'000; numberOfCells <= getMaximumNumberOfCells(); numberOfCells *= 10)
+    for (auto elementType : {AIM::Enum::ElementType::Tri3, AIM::Enum::ElementType::Quad4})
+      benchmark->Args({numberOfCells, elementType});
+}
+
+// the peak resident set size (VmHWM) can be reset on Linux by writing 5 to /proc/self/clear_refs
+auto resetPeakResidentSetSize() -> void {
+  auto clearReferences = std::ofstream("/proc/self/clear_refs");
+  if (clearReferences)
+    clearReferences << "5" << std::endl;
+}
+
+auto getPeakResidentSetSizeInMiB() -> double {
+  auto status = std::ifstream("/proc/self/status");
+  auto line = std::string{};
+  while (std::getline(status, line))
+    if (line.starts_with("VmHWM:"))
+      return std::stod(line.substr(6)) / 1024.0;
+  return 0.0;
+}
+
+auto elapsedSeconds(ClockType::time_point start) -> double {
+  return std::chrono::duration<double>(ClockType::now() - start).count();
+}
+
+auto setStageCounters(benchmark::State &state, const std::map<std::string, double>& stages) -> void {
+  for (const auto &[stage, seconds] : stages)
+    state.counters[stage + "[s]"] = benchmark::Counter(seconds, benchmark::Counter::kAvgIterations);
+  state.counters["peakRSS[MiB]"] = getPeakResidentSetSizeInMiB();
+}
+
+auto setThroughputCounters(benchmark::State &state, const AIM::Benchmark::SyntheticMesh& mesh) -> void {
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(mesh.getFileSize()));
+  state.counters["cells/s"] =
+    benchmark::Counter(static_cast<double>(mesh.getNumberOfCells()), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+auto readMeshInStages(benchmark::State &state, const nlohmann::json& parameters) -> void {
+  auto elementType = static_cast<AIM::Enum::ElementType>(state.range(1));
+  const auto &mesh = getSyntheticMesh(static_cast<std::size_t>(state.range(0)), elementType, parameters);
+  auto workingDirectory = AIM::Benchmark::ScopedWorkingDirectory{mesh.getDirectory()};
+  auto stages = std::map<std::string, double>{};
+  resetPeakResidentSetSize();
+
+  for (auto _ : state) {
+    auto start = ClockType::now();
+    auto meshReader = MeshReaderType{};
+    stages["setup"] += elapsedSeconds(start);
+
+    start = ClockType::now();
+    auto x = meshReader.readCoordinate<AIM::Enum::Coordinate::X>();
+    auto y = meshReader.readCoordinate<AIM::Enum::Coordinate::Y>();
+    stages["coordinates"] += elapsedSeconds(start);
+
+    start = ClockType::now();
+    auto cells = meshReader.readConnectivityTable();
+    stages["connectivity"] += elapsedSeconds(start);
+
+    start = ClockType::now();
+    auto boundaryConditions = meshReader.readBoundaryConditions();
+    auto boundaryFaces = meshReader.readBoundaryFaceConnectivity();
+    stages["boundaries"] += elapsedSeconds(start);
+
+    benchmark::DoNotOptimize(x.data());
+    benchmark::DoNotOptimize(y.data());
+    benchmark::DoNotOptimize(cells.getIndices().data());
+    benchmark::DoNotOptimize(boundaryFaces.data());
+  }
+  setStageCounters(state, stages);
+  setThroughputCounters(state, mesh);
+}
+
+}  // namespace
+
+static void meshReadingDirectHDF5(benchmark::State &state) {
+  readMeshInStages(state, {{"directHDF5Reading", true}});
+}
+
+static void meshReadingCGNSLibrary(benchmark::State &state) {
+  readMeshInStages(state, {{"directHDF5Reading", false}});
+}
+
+static void meshSetup(benchmark::State &state) {
+  auto elementType = static_cast<AIM::Enum::ElementType>(state.range(1));
+  const auto &mesh = getSyntheticMesh(static_cast<std::size_t>(state.range(0)), elementType, nlohmann::json::object());
+  auto workingDirectory = AIM::Benchmark::ScopedWorkingDirectory{mesh.getDirectory()};
+  auto stages = std::map<std::string, double>{};
+  resetPeakResidentSetSize();
+
+  for (auto _ : state) {
+    auto start = ClockType::now();
+    auto meshReader = MeshReaderType{};
+    auto computationalMesh = ComputationalMeshType{meshReader};
+    stages["reading"] += elapsedSeconds(start);
+
+    start = ClockType::now();
+    auto faceTopology = FaceTopologyType{computationalMesh};
+    stages["faceTopology"] += elapsedSeconds(start);
+
+    start = ClockType::now();
+    auto geometry = MeshGeometryType{computationalMesh, faceTopology};
+    stages["geometry"] += elapsedSeconds(start);
+
+    benchmark::DoNotOptimize(geometry.getCellVolumes().data());
+  }
+  setStageCounters(state, stages);
+  setThroughputCounters(state, mesh);
+}
+
+BENCHMARK(meshReadingDirectHDF5)->Apply(addMeshSizes)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(meshReadingCGNSLibrary)->Apply(addMeshSizes)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(meshSetup)->Apply(addMeshSizes)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,66 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+// third-party include headers
+#include <benchmark/benchmark.h>
+
+// AIM include headers
+#include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/meshPrefetch/meshPrefetch.hpp"
+#include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/parameterFileReading/parameterFileReading.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+// Compares the wall-clock time of the solver start-up phase with and without prefetching the mesh. The start-up work
+// that does not depend on the mesh (reading parameters and allocating the solver fields) is emulated by
+// setUpSolverFields(), its size is controlled by the benchmark argument (number of entries per field). Both benchmarks
+// read input/mesh.cgns, which can be replaced by a larger mesh to make the overlap visible.
+
+namespace {
+
+constexpr auto numberOfSolverFields = std::size_t{8};
+
+auto setUpSolverFields(std::size_t numberOfEntries) -> std::vector<std::vector<AIM::Types::FloatType>> {
+  auto inputFile = std::filesystem::path{"input/aim.json"};
+  auto initialValue = AIM::Parameters::ParameterFileReading::readParameterOrGetDefaultValue<AIM::Types::FloatType>(
+    inputFile, "/solver/initialValue", 0.0);
+
+  auto fields = std::vector<std::vector<AIM::Types::FloatType>>(numberOfSolverFields);
+  for (auto &field : fields)
+    field.assign(numberOfEntries, initialValue);
+  return fields;
+}
+
+}  // namespace
+
+static void meshStartupSequential(benchmark::State &state) {
+  for (auto _ : state) {
+    auto fields = setUpSolverFields(static_cast<std::size_t>(state.range(0)));
+    auto meshReader = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>{};
+    auto mesh = AIM::Mesh::ComputationalMesh{meshReader};
+    benchmark::DoNotOptimize(fields.data());
+    benchmark::DoNotOptimize(mesh.getConnectivityTable().getIndices().data());
+  }
+}
+
+static void meshStartupPrefetched(benchmark::State &state) {
+  for (auto _ : state) {
+    auto meshPrefetch = AIM::Mesh::MeshPrefetch<AIM::Enum::Dimension::Two>{};
+    auto fields = setUpSolverFields(static_cast<std::size_t>(state.range(0)));
+    auto mesh = AIM::Mesh::ComputationalMesh{meshPrefetch};
+    benchmark::DoNotOptimize(fields.data());
+    benchmark::DoNotOptimize(mesh.getConnectivityTable().getIndices().data());
+  }
+}
+
+BENCHMARK(meshStartupSequential)->RangeMultiplier(8)->Range(1 << 12, 1 << 21)->UseRealTime();
+BENCHMARK(meshStartupPrefetched)->RangeMultiplier(8)->Range(1 << 12, 1 << 21)->UseRealTime();
+
+BENCHMARK_MAIN();
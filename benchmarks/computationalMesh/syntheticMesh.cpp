@@ -0,0 +1,253 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// third-party include headers
+#include <unistd.h>
+
+#include <nlohmann/json.hpp>
+
+#include "cgnslib.h"
+
+// AIM include headers
+#include "benchmarks/computationalMesh/syntheticMesh.hpp"
+#include "src/computationalMesh/cgnsFileHandle/cgnsFileHandle.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+namespace AIM {
+namespace Benchmark {
+
+/// \name Constructors and destructors
+/// @{
+SyntheticMesh::SyntheticMesh(
+  std::size_t minimumNumberOfCells, AIM::Enum::ElementType elementType, const nlohmann::json& meshParameters)
+  : elementType_(elementType) {
+  if (elementType_ != AIM::Enum::ElementType::Tri3 && elementType_ != AIM::Enum::ElementType::Quad4)
+    throw std::runtime_error("synthetic meshes can only be generated with triangles or quads");
+
+  // each quad of the structured grid is split into two triangles for triangular meshes
+  auto cellsPerQuad = elementType_ == AIM::Enum::ElementType::Tri3 ? std::size_t{2} : std::size_t{1};
+  auto numberOfQuads = (std::max(minimumNumberOfCells, std::size_t{1}) + cellsPerQuad - 1) / cellsPerQuad;
+  numberOfCellsPerDirection_ = static_cast<std::size_t>(std::sqrt(static_cast<double>(numberOfQuads)));
+  while (numberOfCellsPerDirection_ * numberOfCellsPerDirection_ < numberOfQuads)
+    ++numberOfCellsPerDirection_;
+  numberOfCells_ = cellsPerQuad * numberOfCellsPerDirection_ * numberOfCellsPerDirection_;
+  numberOfVertices_ = (numberOfCellsPerDirection_ + 1) * (numberOfCellsPerDirection_ + 1);
+
+  // the process id keeps concurrently running benchmarks apart
+  auto name = "aim-synthetic-mesh-" + std::to_string(::getpid()) + "-" + std::to_string(numberOfCells_) +
+              (elementType_ == AIM::Enum::ElementType::Tri3 ? "-tri" : "-quad");
+  for (std::size_t suffix = 0; directory_.empty() || std::filesystem::exists(directory_); ++suffix)
+    directory_ = std::filesystem::temp_directory_path() / (name + "-" + std::to_string(suffix));
+  std::filesystem::create_directories(directory_ / "input");
+
+  writeParameterFile(meshParameters);
+  writeMeshFile();
+}
+
+SyntheticMesh::~SyntheticMesh() {
+  auto errorCode = std::error_code{};
+  std::filesystem::remove_all(directory_, errorCode);
+}
+
+ScopedWorkingDirectory::ScopedWorkingDirectory(const std::filesystem::path& directory)
+  : previousDirectory_(std::filesystem::current_path()) {
+  std::filesystem::current_path(directory);
+}
+
+ScopedWorkingDirectory::~ScopedWorkingDirectory() {
+  auto errorCode = std::error_code{};
+  std::filesystem::current_path(previousDirectory_, errorCode);
+}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+auto SyntheticMesh::writeParameterFile(const nlohmann::json& meshParameters) const -> void {
+  auto parameters = nlohmann::json{{"mesh", {{"filename", "input/mesh.cgns"}}}};
+  parameters["mesh"].update(meshParameters);
+  auto parameterFile = std::ofstream(directory_ / "input" / "aim.json");
+  parameterFile << parameters.dump(2) << std::endl;
+}
+
+auto SyntheticMesh::writeMeshFile() const -> void {
+  auto lock = std::scoped_lock{AIM::Mesh::CGNSFileHandle::getLibraryMutex()};
+
+  // the direct HDF5 reading path of the mesh reader is only taken for HDF5 files
+  checkError(cg_set_file_type(CG_FILE_HDF5), "set file type to HDF5");
+  auto fileIndex = int{0};
+  checkError(cg_open(getMeshFile().string().c_str(), CG_MODE_WRITE, &fileIndex), "open " + getMeshFile().string());
+
+  auto base = int{0};
+  checkError(cg_base_write(fileIndex, "Base", 2, 2, &base), "write base");
+  AIM::Types::CGNSInt zoneSize[3] = {static_cast<AIM::Types::CGNSInt>(numberOfVertices_),
+    static_cast<AIM::Types::CGNSInt>(numberOfCells_), 0};
+  auto zone = int{0};
+  checkError(cg_zone_write(fileIndex, base, "Zone", zoneSize, CGNS_ENUMV(Unstructured), &zone), "write zone");
+
+  writeCoordinates(fileIndex, base, zone);
+  writeCells(fileIndex, base, zone);
+  writeBoundaries(fileIndex, base, zone);
+  checkError(cg_close(fileIndex), "close " + getMeshFile().string());
+}
+
+auto SyntheticMesh::writeCoordinates(int fileIndex, int base, int zone) const -> void {
+  // the coordinates are written for a block of rows at a time, vertices are numbered row by row
+  auto numberOfVerticesPerDirection = numberOfCellsPerDirection_ + 1;
+  auto spacing = 1.0 / static_cast<double>(numberOfCellsPerDirection_);
+  auto rowsPerChunk = getNumberOfRowsPerChunk();
+  auto x = std::vector<double>{};
+  auto y = std::vector<double>{};
+  for (std::size_t firstRow = 0; firstRow < numberOfVerticesPerDirection; firstRow += rowsPerChunk) {
+    auto lastRow = std::min(firstRow + rowsPerChunk, numberOfVerticesPerDirection);
+    x.clear();
+    y.clear();
+    for (std::size_t j = firstRow; j < lastRow; ++j)
+      for (std::size_t i = 0; i < numberOfVerticesPerDirection; ++i) {
+        x.push_back(static_cast<double>(i) * spacing);
+        y.push_back(static_cast<double>(j) * spacing);
+      }
+
+    auto rangeMin = static_cast<AIM::Types::CGNSInt>(firstRow * numberOfVerticesPerDirection + 1);
+    auto rangeMax = static_cast<AIM::Types::CGNSInt>(lastRow * numberOfVerticesPerDirection);
+    auto coordinate = int{0};
+    checkError(cg_coord_partial_write(fileIndex, base, zone, CGNS_ENUMV(RealDouble), "CoordinateX", &rangeMin,
+                 &rangeMax, x.data(), &coordinate),
+      "write x-coordinates");
+    checkError(cg_coord_partial_write(fileIndex, base, zone, CGNS_ENUMV(RealDouble), "CoordinateY", &rangeMin,
+                 &rangeMax, y.data(), &coordinate),
+      "write y-coordinates");
+  }
+}
+
+auto SyntheticMesh::writeCells(int fileIndex, int base, int zone) const -> void {
+  auto isTriangle = elementType_ == AIM::Enum::ElementType::Tri3;
+  auto cellType = isTriangle ? CGNS_ENUMV(TRI_3) : CGNS_ENUMV(QUAD_4);
+  auto cellsPerQuad = isTriangle ? std::size_t{2} : std::size_t{1};
+  auto section = int{0};
+  checkError(cg_section_partial_write(fileIndex, base, zone, isTriangle ? "TriElements" : "QuadElements", cellType, 1,
+               static_cast<AIM::Types::CGNSInt>(numberOfCells_), 0, &section),
+    "write cell section");
+
+  // CGNS vertex indices start at 1, quads are split along their diagonal from the lower left to the upper right vertex
+  auto numberOfVerticesPerDirection = numberOfCellsPerDirection_ + 1;
+  auto vertex = [numberOfVerticesPerDirection](std::size_t i, std::size_t j) {
+    return static_cast<AIM::Types::CGNSInt>(j * numberOfVerticesPerDirection + i + 1);
+  };
+  auto rowsPerChunk = getNumberOfRowsPerChunk();
+  auto cells = std::vector<AIM::Types::CGNSInt>{};
+  for (std::size_t firstRow = 0; firstRow < numberOfCellsPerDirection_; firstRow += rowsPerChunk) {
+    auto lastRow = std::min(firstRow + rowsPerChunk, numberOfCellsPerDirection_);
+    cells.clear();
+    for (std::size_t j = firstRow; j < lastRow; ++j)
+      for (std::size_t i = 0; i < numberOfCellsPerDirection_; ++i) {
+        if (isTriangle)
+          cells.insert(cells.end(), {vertex(i, j), vertex(i + 1, j), vertex(i + 1, j + 1), vertex(i, j),
+                                      vertex(i + 1, j + 1), vertex(i, j + 1)});
+        else
+          cells.insert(cells.end(), {vertex(i, j), vertex(i + 1, j), vertex(i + 1, j + 1), vertex(i, j + 1)});
+      }
+
+    auto firstCell = static_cast<AIM::Types::CGNSInt>(cellsPerQuad * firstRow * numberOfCellsPerDirection_ + 1);
+    auto lastCell = static_cast<AIM::Types::CGNSInt>(cellsPerQuad * lastRow * numberOfCellsPerDirection_);
+    checkError(cg_elements_partial_write(fileIndex, base, zone, section, firstCell, lastCell, cells.data()),
+      "write cells");
+  }
+}
+
+auto SyntheticMesh::writeBoundaries(int fileIndex, int base, int zone) const -> void {
+  // boundary faces are numbered after the cells, each boundary references its section through an element range
+  auto n = numberOfCellsPerDirection_;
+  auto vertex = [n](std::size_t i, std::size_t j) { return static_cast<AIM::Types::CGNSInt>(j * (n + 1) + i + 1); };
+  struct BoundaryType {
+    const char *name;
+    CGNS_ENUMT(BCType_t) type;
+  };
+  constexpr auto boundaries = std::array<BoundaryType, 4>{{{"bottom", CGNS_ENUMV(BCWall)},
+    {"right", CGNS_ENUMV(BCOutflow)}, {"top", CGNS_ENUMV(BCWall)}, {"left", CGNS_ENUMV(BCInflow)}}};
+
+  auto firstFace = static_cast<AIM::Types::CGNSInt>(numberOfCells_ + 1);
+  for (std::size_t boundary = 0; boundary < boundaries.size(); ++boundary) {
+    auto faces = std::vector<AIM::Types::CGNSInt>{};
+    for (std::size_t index = 0; index < n; ++index) {
+      if (boundary == 0)
+        faces.insert(faces.end(), {vertex(index, 0), vertex(index + 1, 0)});
+      else if (boundary == 1)
+        faces.insert(faces.end(), {vertex(n, index), vertex(n, index + 1)});
+      else if (boundary == 2)
+        faces.insert(faces.end(), {vertex(n - index, n), vertex(n - index - 1, n)});
+      else
+        faces.insert(faces.end(), {vertex(0, n - index), vertex(0, n - index - 1)});
+    }
+
+    const auto &[name, type] = boundaries[boundary];
+    AIM::Types::CGNSInt range[2] = {firstFace, firstFace + static_cast<AIM::Types::CGNSInt>(n) - 1};
+    auto section = int{0};
+    checkError(cg_section_write(fileIndex, base, zone, name, CGNS_ENUMV(BAR_2), range[0], range[1], 0, faces.data(),
+                 &section),
+      "write boundary section " + std::string(name));
+
+    auto family = int{0};
+    auto familyBC = int{0};
+    checkError(cg_family_write(fileIndex, base, name, &family), "write family " + std::string(name));
+    checkError(cg_fambc_write(fileIndex, base, family, name, type, &familyBC), "write family boundary condition");
+
+    auto boundaryIndex = int{0};
+    checkError(cg_boco_write(fileIndex, base, zone, name, CGNS_ENUMV(FamilySpecified), CGNS_ENUMV(PointRange), 2,
+                 range, &boundaryIndex),
+      "write boundary condition " + std::string(name));
+    checkError(cg_boco_gridlocation_write(fileIndex, base, zone, boundaryIndex, CGNS_ENUMV(EdgeCenter)),
+      "write boundary location");
+    checkError(cg_goto(fileIndex, base, "Zone_t", zone, "ZoneBC_t", 1, "BC_t", boundaryIndex, "end"),
+      "navigate to boundary condition");
+    checkError(cg_famname_write(name), "write family name of boundary condition");
+    firstFace += static_cast<AIM::Types::CGNSInt>(n);
+  }
+}
+
+auto SyntheticMesh::getNumberOfRowsPerChunk() const -> std::size_t {
+  return std::max(std::size_t{1}, verticesPerChunk_ / (numberOfCellsPerDirection_ + 1));
+}
+
+auto SyntheticMesh::checkError(int errorCode, const std::string& operation) -> void {
+  if (errorCode != CG_OK)
+    throw std::runtime_error("can't " + operation + " of synthetic mesh: " + std::string(cg_get_error()));
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Benchmark
+}  // end namespace AIM
@@ -0,0 +1,143 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <cstddef>
+#include <filesystem>
+#include <string>
+
+// third-party include headers
+#include <nlohmann/json.hpp>
+
+// AIM include headers
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+// concept definition
+
+namespace AIM {
+namespace Benchmark {
+
+/**
+ * \class SyntheticMesh
+ * \brief Writes a structured grid of configurable size as an unstructured 2D CGNS mesh into a temporary directory
+ * \ingroup mesh
+ *
+ * The unit square is split into n x n quads, or into 2 x n x n triangles, where n is chosen so that the mesh has at
+ * least the requested number of cells. The mesh consists of a single base and zone with one cell section and one BAR_2
+ * section per boundary (bottom and top are walls, left is an inlet and right is an outlet, all family specified), i.e.
+ * it has the same layout as the meshes the AIM::Mesh::MeshReader is tested with. Coordinates and cells are written row
+ * by row, so that meshes with up to 1e8 cells can be generated without holding the complete mesh in memory.
+ *
+ * The mesh is written to input/mesh.cgns below a temporary directory, together with an input/aim.json parameter file
+ * that points to it. Additional mesh parameters (e.g. "parallelLoading") are merged into the "mesh" object of the
+ * parameter file. As the mesh classes read their parameters relative to the working directory, the benchmarks change
+ * into getDirectory() with a ScopedWorkingDirectory. The directory is removed on destruction.
+ *
+ * \code
+ * auto syntheticMesh = AIM::Benchmark::SyntheticMesh{1'000'000, AIM::Enum::ElementType::Tri3};
+ * {
+ *   auto workingDirectory = AIM::Benchmark::ScopedWorkingDirectory{syntheticMesh.getDirectory()};
+ *   auto meshReader = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>{};
+ *   auto mesh = AIM::Mesh::ComputationalMesh{meshReader};
+ * }
+ * \endcode
+ */
+
+class SyntheticMesh {
+  /// \name Custom types used in this class
+  /// @{
+
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  SyntheticMesh(std::size_t minimumNumberOfCells, AIM::Enum::ElementType elementType,
+    const nlohmann::json& meshParameters = nlohmann::json::object());
+  SyntheticMesh(const SyntheticMesh&) = delete;
+  ~SyntheticMesh();
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getDirectory() const -> const std::filesystem::path& { return directory_; }
+  auto getMeshFile() const -> std::filesystem::path { return directory_ / "input" / "mesh.cgns"; }
+  auto getNumberOfCellsPerDirection() const -> std::size_t { return numberOfCellsPerDirection_; }
+  auto getNumberOfCells() const -> std::size_t { return numberOfCells_; }
+  auto getNumberOfVertices() const -> std::size_t { return numberOfVertices_; }
+  auto getFileSize() const -> std::size_t {
+    return static_cast<std::size_t>(std::filesystem::file_size(getMeshFile()));
+  }
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const SyntheticMesh&) -> SyntheticMesh& = delete;
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  auto writeParameterFile(const nlohmann::json& meshParameters) const -> void;
+  auto writeMeshFile() const -> void;
+  auto writeCoordinates(int fileIndex, int base, int zone) const -> void;
+  auto writeCells(int fileIndex, int base, int zone) const -> void;
+  auto writeBoundaries(int fileIndex, int base, int zone) const -> void;
+  auto getNumberOfRowsPerChunk() const -> std::size_t;
+  static auto checkError(int errorCode, const std::string& operation) -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  static constexpr std::size_t verticesPerChunk_{1 << 20};
+
+  AIM::Enum::ElementType elementType_;
+  std::size_t numberOfCellsPerDirection_{0};
+  std::size_t numberOfCells_{0};
+  std::size_t numberOfVertices_{0};
+  std::filesystem::path directory_;
+  /// @}
+};
+
+/**
+ * \class ScopedWorkingDirectory
+ * \brief Changes the working directory for the lifetime of the object and restores the previous one afterwards
+ * \ingroup mesh
+ */
+
+class ScopedWorkingDirectory {
+  /// \name Constructors and destructors
+  /// @{
+public:
+  ScopedWorkingDirectory(const std::filesystem::path& directory);
+  ScopedWorkingDirectory(const ScopedWorkingDirectory&) = delete;
+  ~ScopedWorkingDirectory();
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const ScopedWorkingDirectory&) -> ScopedWorkingDirectory& = delete;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  std::filesystem::path previousDirectory_;
+  /// @}
+};
+
+}  // namespace Benchmark
+}  // end namespace AIM
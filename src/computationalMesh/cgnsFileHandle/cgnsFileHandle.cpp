@@ -0,0 +1,78 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cassert>
+#include <filesystem>
+#include <mutex>
+#include <utility>
+
+// third-party include headers
+#include "cgnslib.h"
+
+// AIM include headers
+#include "src/computationalMesh/cgnsFileHandle/cgnsFileHandle.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+CGNSFileHandle::CGNSFileHandle(const std::filesystem::path& file, int mode) {
+  auto lock = std::scoped_lock{getLibraryMutex()};
+  auto errorCode = cg_open(file.string().c_str(), mode, &fileIndex_);
+  assert(errorCode == 0 && "Error opening CGNS file");
+  open_ = errorCode == 0;
+}
+
+CGNSFileHandle::CGNSFileHandle(CGNSFileHandle&& other) noexcept
+  : fileIndex_(std::exchange(other.fileIndex_, 0)), open_(std::exchange(other.open_, false)) {}
+
+CGNSFileHandle::~CGNSFileHandle() { close(); }
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+auto CGNSFileHandle::getLibraryMutex() -> std::mutex& {
+  static auto libraryMutex = std::mutex{};
+  return libraryMutex;
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+auto CGNSFileHandle::operator=(CGNSFileHandle&& other) noexcept -> CGNSFileHandle& {
+  if (this != &other) {
+    close();
+    fileIndex_ = std::exchange(other.fileIndex_, 0);
+    open_ = std::exchange(other.open_, false);
+  }
+  return *this;
+}
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+auto CGNSFileHandle::close() -> void {
+  if (open_) {
+    auto lock = std::scoped_lock{getLibraryMutex()};
+    cg_close(fileIndex_);
+  }
+  fileIndex_ = 0;
+  open_ = false;
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
@@ -0,0 +1,98 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <filesystem>
+#include <mutex>
+
+// third-party include headers
+#include "cgnslib.h"
+
+// AIM include headers
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class CGNSFileHandle
+ * \brief Move-only RAII wrapper around the file index returned by cg_open()
+ * \ingroup mesh
+ *
+ * The file is opened on construction and closed on destruction. Since the handle can't be copied, there is always
+ * exactly one owner of an open file index and cg_close() is called exactly once, even if the handle is moved between
+ * objects or threads. A moved-from handle is closed and must not be used to read from the file anymore.
+ *
+ * The CGNS library itself is not thread-safe, not even for different files. All calls into the library, including
+ * opening and closing files, have to be serialised through the mutex returned by getLibraryMutex(), which this class
+ * does for opening and closing files.
+ *
+ * \code
+ * auto handle = AIM::Mesh::CGNSFileHandle{std::filesystem::path("path/to/file.cgns")};
+ * auto numberOfBases = int{0};
+ * {
+ *   auto lock = std::scoped_lock{AIM::Mesh::CGNSFileHandle::getLibraryMutex()};
+ *   cg_nbases(handle.getIndex(), &numberOfBases);
+ * }
+ * // hand the open file over to another object, the file is only closed once
+ * auto otherHandle = std::move(handle);
+ * \endcode
+ */
+
+class CGNSFileHandle {
+  /// \name Custom types used in this class
+  /// @{
+
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  CGNSFileHandle(const std::filesystem::path& file, int mode = CG_MODE_READ);
+  CGNSFileHandle(const CGNSFileHandle& other) = delete;
+  CGNSFileHandle(CGNSFileHandle&& other) noexcept;
+  ~CGNSFileHandle();
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  static auto getLibraryMutex() -> std::mutex&;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getIndex() const -> int { return fileIndex_; }
+  auto isOpen() const -> bool { return open_; }
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const CGNSFileHandle& other) -> CGNSFileHandle& = delete;
+  auto operator=(CGNSFileHandle&& other) noexcept -> CGNSFileHandle&;
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  auto close() -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  int fileIndex_{0};
+  bool open_{false};
+  /// @}
+};
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "cgnsFileHandle.tpp"
@@ -0,0 +1,97 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <utility>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/cgnsFileHandlePool/cgnsFileHandlePool.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+CGNSFileHandlePool::CGNSFileHandlePool(const std::filesystem::path& file, std::size_t maximumNumberOfIdleHandles)
+  : file_(file), maximumNumberOfIdleHandles_(maximumNumberOfIdleHandles) {
+  // open the first handle eagerly, so that errors are reported when the pool is created
+  idleHandles_.emplace_back(file_);
+}
+
+CGNSFileHandlePool::Lease::Lease(CGNSFileHandlePool* pool, CGNSFileHandle handle)
+  : pool_(pool), handle_(std::move(handle)) {}
+
+CGNSFileHandlePool::Lease::Lease(Lease&& other) noexcept
+  : pool_(std::exchange(other.pool_, nullptr)), handle_(std::move(other.handle_)) {}
+
+CGNSFileHandlePool::Lease::~Lease() { giveBack(); }
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+auto CGNSFileHandlePool::acquire() -> Lease {
+  {
+    auto lock = std::scoped_lock{mutex_};
+    if (!idleHandles_.empty()) {
+      auto handle = std::move(idleHandles_.back());
+      idleHandles_.pop_back();
+      return Lease{this, std::move(handle)};
+    }
+  }
+  // opening a new file is done outside the pool lock, other threads may return or acquire handles in the meantime
+  return Lease{this, CGNSFileHandle{file_}};
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+auto CGNSFileHandlePool::getNumberOfIdleHandles() const -> std::size_t {
+  auto lock = std::scoped_lock{mutex_};
+  return idleHandles_.size();
+}
+/// @}
+
+/// \name Overloaded operators
+/// @{
+auto CGNSFileHandlePool::Lease::operator=(Lease&& other) noexcept -> Lease& {
+  if (this != &other) {
+    giveBack();
+    pool_ = std::exchange(other.pool_, nullptr);
+    handle_ = std::move(other.handle_);
+  }
+  return *this;
+}
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+auto CGNSFileHandlePool::release(CGNSFileHandle handle) -> void {
+  auto lock = std::unique_lock{mutex_};
+  if (idleHandles_.size() < maximumNumberOfIdleHandles_) {
+    idleHandles_.push_back(std::move(handle));
+    return;
+  }
+  // the surplus handle is closed when it goes out of scope, which does not require the pool lock
+  lock.unlock();
+}
+
+auto CGNSFileHandlePool::Lease::giveBack() -> void {
+  if (pool_ && handle_.isOpen())
+    pool_->release(std::move(handle_));
+  pool_ = nullptr;
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
@@ -0,0 +1,141 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/cgnsFileHandle/cgnsFileHandle.hpp"
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class CGNSFileHandlePool
+ * \brief Thread-safe pool of open, read-only CGNS file handles for the same file
+ * \ingroup mesh
+ *
+ * Opening a CGNS file is expensive (the underlying HDF5 file has to be opened and its node tree parsed), so readers
+ * that are used from several threads should not re-open the file for every read. Instead, they acquire a handle from
+ * the pool, which returns a Lease object. The lease gives exclusive access to an open file handle and returns it to the
+ * pool once it goes out of scope. If no idle handle is available, a new one is opened, so acquire() never blocks on
+ * other leases. At most maximumNumberOfIdleHandles handles are kept open once they are returned, any further handles
+ * are closed. The pool must outlive all leases acquired from it and can't be copied or moved.
+ *
+ * \code
+ * auto pool = AIM::Mesh::CGNSFileHandlePool{std::filesystem::path("path/to/file.cgns")};
+ *
+ * auto worker = std::async(std::launch::async, [&pool]() {
+ *   auto lease = pool.acquire();
+ *   auto lock = std::scoped_lock{AIM::Mesh::CGNSFileHandle::getLibraryMutex()};
+ *   // read from lease.getIndex() ...
+ * });
+ * \endcode
+ */
+
+class CGNSFileHandlePool {
+  /// \name Custom types used in this class
+  /// @{
+public:
+  class Lease;
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  CGNSFileHandlePool(const std::filesystem::path& file, std::size_t maximumNumberOfIdleHandles = 4);
+  CGNSFileHandlePool(const CGNSFileHandlePool& other) = delete;
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  auto acquire() -> Lease;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getFile() const -> const std::filesystem::path& { return file_; }
+  auto getNumberOfIdleHandles() const -> std::size_t;
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const CGNSFileHandlePool& other) -> CGNSFileHandlePool& = delete;
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  auto release(CGNSFileHandle handle) -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  const std::filesystem::path file_;
+  const std::size_t maximumNumberOfIdleHandles_{0};
+  mutable std::mutex mutex_;
+  std::vector<CGNSFileHandle> idleHandles_;
+  /// @}
+};
+
+/**
+ * \class CGNSFileHandlePool::Lease
+ * \brief Move-only, exclusive access to a handle of a CGNSFileHandlePool, which is returned to the pool on destruction
+ * \ingroup mesh
+ */
+
+class CGNSFileHandlePool::Lease {
+  /// \name Constructors and destructors
+  /// @{
+public:
+  Lease(CGNSFileHandlePool* pool, CGNSFileHandle handle);
+  Lease(const Lease& other) = delete;
+  Lease(Lease&& other) noexcept;
+  ~Lease();
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getIndex() const -> int { return handle_.getIndex(); }
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const Lease& other) -> Lease& = delete;
+  auto operator=(Lease&& other) noexcept -> Lease&;
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  auto giveBack() -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  CGNSFileHandlePool* pool_{nullptr};
+  CGNSFileHandle handle_;
+  /// @}
+};
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "cgnsFileHandlePool.tpp"
@@ -3,29 +3,60 @@
 // (c) by Tom-Robin Teschner 2021. This file is distribuited under the MIT license.
 
 // c++ include headers
+#include <array>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
 
 // third-party include headers
 
 // AIM include headers
 #include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/meshCache/meshCache.hpp"
+#include "src/parameterFileReading/parameterRegistry.hpp"
 #include "src/types/enums.hpp"
+#include "src/utilities/hardwareCounters/hardwareCounters.hpp"
+#include "src/utilities/instrumentation/instrumentation.hpp"
 
 namespace AIM {
 namespace Mesh {
 
 /// \name Constructors and destructors
 /// @{
-ComputationalMesh::ComputationalMesh(const MeshReader& meshReader) : meshReader_(meshReader) {
-  coordinateX_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::X>();
-  coordinateY_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::Y>();
-  if (meshReader_.getDimensions() == AIM::Enum::Dimension::Three)
-    coordinateZ_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::Z>();
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>::ComputationalMesh() {
+  readParameters();
+  // the mesh reader scans all zones and boundaries on construction, so it is only created if the cache can't be used
+  readMeshFileOrCache(MeshReaderType::readMeshFileName());
+  renumberMesh();
+}
 
-  connectivityTable_ = meshReader_.readConnectivityTable();
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>::ComputationalMesh(const MeshReaderType& meshReader)
+  : meshReader_(meshReader) {
+  readParameters();
+  readMeshFileOrCache(meshReader_->getMeshFile());
+  renumberMesh();
+}
 
-  boundaryConditionInfo_ = meshReader_.readBoundaryConditions();
-  boundaryConditionConnectivityTable_ = meshReader_.readBoundaryConditionConnectivity();
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>::ComputationalMesh(const MeshPrefetchType& meshPrefetch)
+  : meshReader_(meshPrefetch.getMeshReader()) {
+  readParameters();
+  readMeshPrefetch(meshPrefetch);
+  if (useMeshCache_) {
+    const auto &meshFile = meshReader_->getMeshFile();
+    auto cacheFile = MeshCacheType::getCacheFile(meshFile);
+    if (!MeshCacheType::isUpToDate(cacheFile, meshFile, Dimensions))
+      writeMeshCache(cacheFile);
+  }
+  renumberMesh();
 }
 /// @}
 
@@ -46,7 +77,156 @@ ComputationalMesh::ComputationalMesh(const MeshReader& meshReader) : meshReader_
 
 /// \name Private or protected implementation details, not exposed to the caller
 /// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>::readParameters() -> void {
+  auto parameters = AIM::Parameters::ParameterRegistry{"input/aim.json"};
+  auto useMeshCache = parameters.declare<bool>("/mesh/cache", false);
+  auto useParallelLoading = parameters.declare<bool>("/mesh/parallelLoading", false);
+  auto renumbering = parameters.declare<std::string>("/mesh/renumbering", "none");
+  parameters.validate();
+
+  useMeshCache_ = parameters.get(useMeshCache);
+  useParallelLoading_ = parameters.get(useParallelLoading);
+  meshRenumbering_ = MeshRenumberingType{MeshRenumberingType::getMethodFromString(parameters.get(renumbering))};
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>::readMeshFileOrCache(
+  const std::filesystem::path& meshFile) -> void {
+  if (!useMeshCache_) {
+    readMeshFile();
+    return;
+  }
+
+  auto cacheFile = MeshCacheType::getCacheFile(meshFile);
+  if (MeshCacheType::isUpToDate(cacheFile, meshFile, Dimensions))
+    readMeshCache(cacheFile);
+  else {
+    readMeshFile();
+    writeMeshCache(cacheFile);
+  }
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>::readMeshFile() -> void {
+  AIM_INSTRUMENT_SCOPE("ComputationalMesh::readMeshFile");
+  if (!meshReader_)
+    meshReader_.emplace();
+  if (useParallelLoading_) {
+    readMeshFileConcurrently();
+    return;
+  }
+
+  MeshReaderType::forEachCoordinate([this](auto index) {
+    coordinates_[decltype(index)::value] = meshReader_->template readCoordinate<decltype(index)::value>();
+  });
+
+  connectivityTable_ = meshReader_->readConnectivityTable();
+
+  boundaryConditionInfo_ = meshReader_->readBoundaryConditions();
+  boundaryConditionConnectivityTable_ = meshReader_->readBoundaryConditionConnectivity();
+  boundaryFaceConnectivity_ = meshReader_->readBoundaryFaceConnectivity();
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>::readMeshFileConcurrently() -> void {
+  // the connectivity table is launched first as it has the largest amount of CPU-side work after reading
+  auto connectivityTable = std::async(std::launch::async, [this]() { return meshReader_->readConnectivityTable(); });
+  auto coordinates = std::array<std::future<CoordinateType>, static_cast<std::size_t>(Dimensions)>{};
+  MeshReaderType::forEachCoordinate([this, &coordinates](auto index) {
+    coordinates[decltype(index)::value] = std::async(
+      std::launch::async, [this]() { return meshReader_->template readCoordinate<decltype(index)::value>(); });
+  });
+  auto boundaryConditionInfo =
+    std::async(std::launch::async, [this]() { return meshReader_->readBoundaryConditions(); });
+  auto boundaryConditionConnectivity =
+    std::async(std::launch::async, [this]() { return meshReader_->readBoundaryConditionConnectivity(); });
+  auto boundaryFaceConnectivity =
+    std::async(std::launch::async, [this]() { return meshReader_->readBoundaryFaceConnectivity(); });
+
+  // exceptions thrown on any of the worker threads are rethrown here
+  for (std::size_t index = 0; index < coordinates_.size(); ++index)
+    coordinates_[index] = coordinates[index].get();
+  connectivityTable_ = connectivityTable.get();
+  boundaryConditionInfo_ = boundaryConditionInfo.get();
+  boundaryConditionConnectivityTable_ = boundaryConditionConnectivity.get();
+  boundaryFaceConnectivity_ = boundaryFaceConnectivity.get();
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>::readMeshPrefetch(
+  const MeshPrefetchType& meshPrefetch) -> void {
+  AIM_INSTRUMENT_SCOPE("ComputationalMesh::readMeshPrefetch");
+  using CoordinateFutureType = typename MeshPrefetchType::template FutureType<CoordinateType>;
+  auto coordinates = std::array<CoordinateFutureType, static_cast<std::size_t>(Dimensions)>{};
+  MeshReaderType::forEachCoordinate([&meshPrefetch, &coordinates](auto index) {
+    coordinates[decltype(index)::value] = meshPrefetch.template getCoordinate<decltype(index)::value>();
+  });
+  auto connectivityTable = meshPrefetch.getConnectivityTable();
+
+  // the large arrays are not copied out of the futures, the mesh arrays become views into them instead
+  for (std::size_t index = 0; index < coordinates_.size(); ++index)
+    coordinates_[index] = CoordinateViewType{coordinates[index].get()};
+  const auto &prefetchedConnectivityTable = connectivityTable.get();
+  connectivityTable_ =
+    ConnectivityTableType{prefetchedConnectivityTable.getOffsets(), prefetchedConnectivityTable.getIndices()};
+  using PrefetchedStorageType = std::pair<decltype(coordinates), decltype(connectivityTable)>;
+  meshStorage_ = std::make_shared<const PrefetchedStorageType>(coordinates, connectivityTable);
+
+  boundaryConditionInfo_ = meshPrefetch.getBoundaryConditionInfo().get();
+  boundaryConditionConnectivityTable_ = meshPrefetch.getBoundaryConditionConnectivity().get();
+  boundaryFaceConnectivity_ = meshPrefetch.getBoundaryFaceConnectivity().get();
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>::readMeshCache(
+  const std::filesystem::path& cacheFile) -> void {
+  AIM_INSTRUMENT_SCOPE("ComputationalMesh::readMeshCache");
+  auto meshCache = std::make_shared<const MeshCacheType>(cacheFile);
 
+  MeshReaderType::forEachCoordinate([this, &meshCache](auto index) {
+    coordinates_[decltype(index)::value] = meshCache->template getCoordinate<decltype(index)::value>();
+  });
+
+  connectivityTable_ = meshCache->getConnectivityTable();
+
+  boundaryConditionInfo_ = meshCache->getBoundaryConditionInfo();
+  boundaryConditionConnectivityTable_ = meshCache->getBoundaryConditionConnectivity();
+  boundaryFaceConnectivity_ = meshCache->getBoundaryFaceConnectivity();
+  meshStorage_ = std::move(meshCache);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>::writeMeshCache(
+  const std::filesystem::path& cacheFile) const -> void {
+  AIM_INSTRUMENT_SCOPE("ComputationalMesh::writeMeshCache");
+  // the cache layout always provides three coordinate blocks, unused ones are left empty
+  auto coordinates = std::array<CoordinateViewType, 3>{};
+  for (std::size_t index = 0; index < coordinates_.size(); ++index)
+    coordinates[index] = coordinates_[index].view();
+  MeshCacheType::write(cacheFile, Dimensions, coordinates, connectivityTable_, boundaryConditionInfo_,
+    boundaryConditionConnectivityTable_, boundaryFaceConnectivity_);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>::renumberMesh() -> void {
+  AIM_PROFILE_SCOPE("ComputationalMesh::renumberMesh");
+  if (meshRenumbering_.getMethod() == AIM::Enum::Renumbering::NoRenumbering)
+    return;
+
+  auto coordinates = typename MeshRenumberingType::CoordinatesViewType{};
+  for (std::size_t index = 0; index < coordinates_.size(); ++index)
+    coordinates[index] = coordinates_[index].view();
+  meshRenumbering_.renumber(coordinates, connectivityTable_);
+
+  for (std::size_t index = 0; index < coordinates_.size(); ++index)
+    coordinates_[index] = meshRenumbering_.permuteCoordinate(coordinates[index]);
+  connectivityTable_ = meshRenumbering_.permuteConnectivityTable(connectivityTable_);
+  boundaryFaceConnectivity_ = meshRenumbering_.permuteBoundaryFaces(boundaryFaceConnectivity_);
+
+  // all arrays are owned by the mesh now, the cache or prefetched data they pointed into can be released
+  meshStorage_.reset();
+}
 /// @}
 
 /// \name Encapsulated data (private or protected variables)
@@ -54,5 +234,15 @@ ComputationalMesh::ComputationalMesh(const MeshReader& meshReader) : meshReader_
 
 /// @}
 
+// explicit instantiation of the supported mesh dimensions, index and floating point types
+template class ComputationalMesh<AIM::Enum::Dimension::Two, std::uint32_t, float>;
+template class ComputationalMesh<AIM::Enum::Dimension::Two, std::uint32_t, double>;
+template class ComputationalMesh<AIM::Enum::Dimension::Two, std::uint64_t, float>;
+template class ComputationalMesh<AIM::Enum::Dimension::Two, std::uint64_t, double>;
+template class ComputationalMesh<AIM::Enum::Dimension::Three, std::uint32_t, float>;
+template class ComputationalMesh<AIM::Enum::Dimension::Three, std::uint32_t, double>;
+template class ComputationalMesh<AIM::Enum::Dimension::Three, std::uint64_t, float>;
+template class ComputationalMesh<AIM::Enum::Dimension::Three, std::uint64_t, double>;
+
 }  // namespace Mesh
 }  // end namespace AIM
\ No newline at end of file
@@ -5,11 +5,24 @@
 #pragma once
 
 // c++ include headers
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
 
 // third-party include headers
 
 // AIM include headers
+#include "src/computationalMesh/elementBlocks/elementBlocks.hpp"
+#include "src/computationalMesh/meshArray/meshArray.hpp"
+#include "src/computationalMesh/meshCache/meshCache.hpp"
+#include "src/computationalMesh/meshPrefetch/meshPrefetch.hpp"
 #include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/computationalMesh/meshRenumbering/meshRenumbering.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
 
 // concept definition
 
@@ -18,30 +31,95 @@ namespace Mesh {
 
 /**
  * \class ComputationalMesh
- * \brief Brief description (one line)
+ * \brief Holds the coordinates, connectivity and boundary information of the computational mesh
  * \ingroup mesh
  *
- * Purpose of class with example usage below (in code section)
+ * The mesh is read on construction, through either the provided AIM::Mesh::MeshReader or one created internally, and
+ * exposed through getter methods. Coordinates are returned as std::span views and the connectivity table as an
+ * AIM::Mesh::ConnectivityTable.
+ *
+ * If the parameter "/mesh/cache" is set to true in the input file, the mesh is read from the CGNS file only once and
+ * then written into a binary mesh cache next to it (see AIM::Mesh::MeshCache). Subsequent runs memory map the cache
+ * and the coordinates and the connectivity table become views into the mapped file, i.e. they are not copied. The
+ * cache is rebuilt automatically if the mesh file is newer than the cache. To benefit from the cache, construct the
+ * mesh without an AIM::Mesh::MeshReader: the default constructor resolves the mesh file from the parameter file and
+ * only creates the reader (which opens the CGNS file and scans all zones and boundaries) if the cache is disabled or
+ * outdated. A mesh constructed from an existing reader has already paid that cost.
+ *
+ * If the parameter "/mesh/parallelLoading" is set to true, the coordinates, the connectivity table and the boundary
+ * data are read concurrently, each on its own thread. Access to the CGNS library itself is serialised by the
+ * AIM::Mesh::MeshReader, so the gain comes from overlapping the file I/O of one array with the CPU-side conversion of
+ * another (mainly the connectivity table, which dominates the reading time for large meshes).
+ *
+ * The class is templated on the number of dimensions of the mesh, so that the coordinates are held in a fixed-size
+ * std::array of AIM::Mesh::MeshArray objects and loops over them are unrolled at compile time. For 2D meshes, no
+ * z-coordinate is stored and getCoordinateZ() does not exist. Both dimensions are explicitly instantiated in the
+ * translation unit. The index type of the connectivity table and the floating point type of the coordinates are passed
+ * on to the AIM::Mesh::MeshReader, see there for details.
+ *
+ * Alternatively, the mesh can be constructed from an AIM::Mesh::MeshPrefetch object, which starts reading the mesh in
+ * the background as soon as it is created. The constructor then only waits for the remaining reads to finish, so that
+ * any work done between creating the prefetch object and constructing the mesh overlaps with the mesh I/O. The
+ * coordinates and the connectivity table are not copied out of the prefetch object but shared with it. If the mesh
+ * cache is enabled and outdated, it is written from the prefetched data.
+ *
+ * The parameter "/mesh/renumbering" selects how cells and vertices are reordered after loading to improve cache reuse,
+ * either "none" (default), "reverseCuthillMcKee", "hilbert" or "morton" (see AIM::Mesh::MeshRenumbering). The
+ * coordinates, the connectivity table and the boundary faces are permuted consistently, the bandwidth and profile of
+ * the cell adjacency before and after the renumbering are available through getMeshRenumbering(). The mesh cache
+ * always stores the original order, so that changing the renumbering method does not invalidate it. Renumbered arrays
+ * are owned by the mesh, i.e. they are no longer views into the cache or the prefetched data.
+ *
+ * Cells are always grouped by element type, also after renumbering, which only reorders cells within each group.
+ * getElementBlocks() returns the homogeneous blocks of the connectivity table (see AIM::Mesh::ElementBlocks), so that
+ * cell loops can be written per element type with the number of vertices per cell known at compile time. The blocks
+ * are views into the connectivity table and cheap to create, they are not stored in the mesh.
  *
  * \code
+ * auto mesh = AIM::Mesh::ComputationalMesh<AIM::Enum::Dimension::Two>{};
+ * // or, reading from an existing mesh reader
+ * auto meshReader = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>{};
+ * auto mesh = AIM::Mesh::ComputationalMesh{meshReader};
  *
+ * auto x = mesh.getCoordinateX();
+ * // or, overlapping the mesh reading with other start-up work
+ * auto meshPrefetch = AIM::Mesh::MeshPrefetch<AIM::Enum::Dimension::Two>{};
+ * ...
+ * auto mesh = AIM::Mesh::ComputationalMesh<AIM::Enum::Dimension::Two>{meshPrefetch};
+ *
+ * const auto &connectivityTable = mesh.getConnectivityTable();
+ * for (const auto &cell : connectivityTable)
+ *   for (const auto &vertex : cell)
+ *     std::cout << "x-coordinate of vertex " << vertex << ": " << x[vertex] << std::endl;
  * \endcode
  */
 
+template <int Dimensions, typename UnsignedInteger = AIM::Types::UInt, typename FloatingPoint = AIM::Types::FloatType>
 class ComputationalMesh {
   /// \name Custom types used in this class
   /// @{
 public:
-  using CoordinateType = typename MeshReader::CoordinateType;
-  using ConnectivityTableType = typename MeshReader::ConnectivityTableType;
-  using BoundaryConditionType = typename MeshReader::BoundaryConditionType;
-  using BoundaryConditionConnectivityType = typename MeshReader::BoundaryConditionConnectivityType;
+  using MeshReaderType = MeshReader<Dimensions, UnsignedInteger, FloatingPoint>;
+  using MeshPrefetchType = MeshPrefetch<Dimensions, UnsignedInteger, FloatingPoint>;
+  using MeshCacheType = MeshCache<UnsignedInteger, FloatingPoint>;
+  using IndexType = typename MeshReaderType::IndexType;
+  using FloatType = typename MeshReaderType::FloatType;
+  using CoordinateType = typename MeshReaderType::CoordinateType;
+  using CoordinateViewType = std::span<const FloatType>;
+  using ConnectivityTableType = typename MeshReaderType::ConnectivityTableType;
+  using BoundaryConditionType = typename MeshReaderType::BoundaryConditionType;
+  using BoundaryConditionConnectivityType = typename MeshReaderType::BoundaryConditionConnectivityType;
+  using BoundaryFaceConnectivityType = typename MeshReaderType::BoundaryFaceConnectivityType;
+  using MeshRenumberingType = MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>;
+  using ElementBlocksType = ElementBlocks<Dimensions, UnsignedInteger>;
   /// @}
 
   /// \name Constructors and destructors
   /// @{
 public:
-  ComputationalMesh(const MeshReader& meshReader);
+  ComputationalMesh();
+  ComputationalMesh(const MeshReaderType& meshReader);
+  ComputationalMesh(const MeshPrefetchType& meshPrefetch);
   /// @}
 
   /// \name API interface that exposes behaviour to the caller
@@ -52,14 +130,21 @@ public:
   /// \name Getters and setters
   /// @{
 public:
-  auto getCoordinateX() const -> const CoordinateType& { return coordinateX_; }
-  auto getCoordinateY() const -> const CoordinateType& { return coordinateY_; }
-  auto getCoordinateZ() const -> const CoordinateType& { return coordinateZ_; }
+  template <int Index>
+  auto getCoordinate() const -> CoordinateViewType;
+  auto getCoordinateX() const -> CoordinateViewType { return coordinates_[AIM::Enum::Coordinate::X].view(); }
+  auto getCoordinateY() const -> CoordinateViewType { return coordinates_[AIM::Enum::Coordinate::Y].view(); }
+  auto getCoordinateZ() const -> CoordinateViewType requires(Dimensions == AIM::Enum::Dimension::Three) {
+    return coordinates_[AIM::Enum::Coordinate::Z].view();
+  }
   auto getConnectivityTable() const -> const ConnectivityTableType& { return connectivityTable_; }
+  auto getElementBlocks() const -> ElementBlocksType { return ElementBlocksType{connectivityTable_}; }
   auto getBoundaryConditionInfo() const -> const BoundaryConditionType& { return boundaryConditionInfo_; }
   auto getBoundaryConditionConnvectivity() const -> const BoundaryConditionConnectivityType& {
     return boundaryConditionConnectivityTable_;
   }
+  auto getBoundaryFaceConnectivity() const -> const BoundaryFaceConnectivityType& { return boundaryFaceConnectivity_; }
+  auto getMeshRenumbering() const -> const MeshRenumberingType& { return meshRenumbering_; }
   /// @}
 
   /// \name Overloaded operators
@@ -69,24 +154,47 @@ public:
 
   /// \name Private or protected implementation details, not exposed to the caller
   /// @{
-
+private:
+  auto readParameters() -> void;
+  auto readMeshFileOrCache(const std::filesystem::path& meshFile) -> void;
+  auto readMeshFile() -> void;
+  auto readMeshFileConcurrently() -> void;
+  auto readMeshPrefetch(const MeshPrefetchType& meshPrefetch) -> void;
+  auto readMeshCache(const std::filesystem::path& cacheFile) -> void;
+  auto writeMeshCache(const std::filesystem::path& cacheFile) const -> void;
+  auto renumberMesh() -> void;
   /// @}
 
   /// \name Encapsulated data (private or protected variables)
   /// @{
 private:
-  MeshReader meshReader_;
+  // only created when the mesh is read from the CGNS file, a mesh loaded from an up-to-date cache never opens it
+  std::optional<MeshReaderType> meshReader_;
+  bool useMeshCache_{false};
+  bool useParallelLoading_{false};
+  MeshRenumberingType meshRenumbering_;
+  // keeps the memory alive that the coordinate and connectivity views point to (mesh cache or prefetched data)
+  std::shared_ptr<const void> meshStorage_;
 
-  CoordinateType coordinateX_;
-  CoordinateType coordinateY_;
-  CoordinateType coordinateZ_;
+  std::array<MeshArray<FloatType>, static_cast<std::size_t>(Dimensions)> coordinates_;
 
   ConnectivityTableType connectivityTable_;
   BoundaryConditionType boundaryConditionInfo_;
   BoundaryConditionConnectivityType boundaryConditionConnectivityTable_;
+  BoundaryFaceConnectivityType boundaryFaceConnectivity_;
   /// @}
 };
 
+/// \name Deduction guides, so that the dimension and types are taken from the reader or prefetch object
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+ComputationalMesh(const MeshReader<Dimensions, UnsignedInteger, FloatingPoint>&)
+  -> ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>;
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+ComputationalMesh(const MeshPrefetch<Dimensions, UnsignedInteger, FloatingPoint>&)
+  -> ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>;
+/// @}
+
 }  // namespace Mesh
 }  // end namespace AIM
 
@@ -3,6 +3,7 @@
 // (c) by Tom-Robin Teschner 2021. This file is distribuited under the MIT license.
 
 // c++ include headers
+#include <cstddef>
 
 // third-party include headers
 
@@ -23,7 +24,12 @@ namespace Mesh {
 
 /// \name Getters and setters
 /// @{
-
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+template <int Index>
+auto ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>::getCoordinate() const -> CoordinateViewType {
+  static_assert(Index >= 0 && Index < Dimensions, "coordinate index must be smaller than the mesh dimension");
+  return coordinates_[static_cast<std::size_t>(Index)].view();
+}
 /// @}
 
 /// \name Overloaded operators
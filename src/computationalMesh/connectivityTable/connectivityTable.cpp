@@ -0,0 +1,86 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/connectivityTable/connectivityTable.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+template <typename UnsignedInteger>
+ConnectivityTable<UnsignedInteger>::ConnectivityTable(std::vector<IndexType> offsets, std::vector<IndexType> indices)
+  : offsets_(std::move(offsets)), indices_(std::move(indices)) {
+  assertConsistentOffsets();
+}
+
+template <typename UnsignedInteger>
+ConnectivityTable<UnsignedInteger>::ConnectivityTable(
+  std::span<const IndexType> offsets, std::span<const IndexType> indices)
+  : offsets_(offsets), indices_(indices) {
+  assertConsistentOffsets();
+}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <typename UnsignedInteger>
+auto ConnectivityTable<UnsignedInteger>::reserve(std::size_t numberOfCells, std::size_t numberOfIndices) -> void {
+  offsets_.reserve(numberOfCells + 1);
+  indices_.reserve(numberOfIndices);
+}
+
+template <typename UnsignedInteger>
+auto ConnectivityTable<UnsignedInteger>::clear() -> void {
+  // keeps the allocated memory, so that the table can be refilled without reallocation
+  offsets_.resize(1);
+  indices_.resize(0);
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+template <typename UnsignedInteger>
+auto ConnectivityTable<UnsignedInteger>::begin() const -> CellIterator { return CellIterator{this, 0}; }
+
+template <typename UnsignedInteger>
+auto ConnectivityTable<UnsignedInteger>::end() const -> CellIterator { return CellIterator{this, size()}; }
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <typename UnsignedInteger>
+auto ConnectivityTable<UnsignedInteger>::assertConsistentOffsets() const -> void {
+  assert(offsets_.size() > 0 && "offsets array requires at least one entry");
+  assert(offsets_[0] == 0 && "first offset must point to the start of the indices array");
+  assert(offsets_[offsets_.size() - 1] == indices_.size() && "last offset must point to the end of the indices array");
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+// explicit instantiation of the supported index types
+template class ConnectivityTable<std::uint32_t>;
+template class ConnectivityTable<std::uint64_t>;
+
+}  // namespace Mesh
+}  // end namespace AIM
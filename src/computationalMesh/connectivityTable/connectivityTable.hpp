@@ -0,0 +1,166 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/meshArray/meshArray.hpp"
+#include "src/types/types.hpp"
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class ConnectivityTable
+ * \brief Flat (compressed sparse row) storage of the cell to vertex connectivity
+ * \ingroup mesh
+ *
+ * The connectivity of all cells is stored in two contiguous arrays. The indices array holds the vertex indices of all
+ * cells back to back while the offsets array stores, for each cell, the position of its first vertex within the indices
+ * array. The offsets array has one more entry than there are cells, so that the vertices of cell i are located in the
+ * half-open range [offsets[i], offsets[i + 1]) of the indices array. This avoids one heap allocation per cell and keeps
+ * all vertex indices in a single cache-friendly buffer. Accessing a single cell returns a lightweight std::span over
+ * the indices array, no data is copied. The table either owns both arrays or, if constructed from two std::spans,
+ * references memory owned elsewhere (e.g. a memory mapped mesh cache, see AIM::Mesh::MeshCache).
+ *
+ * The table is templated on the unsigned integer type used for the offsets and indices, which can either be a 32-bit or
+ * a 64-bit integer (see AIM::Types::MeshIndexType). 32-bit indices halve the memory footprint and bandwidth of loops
+ * over the connectivity, 64-bit indices are required once a mesh has more than 2^32 vertices or connectivity entries.
+ * The table defaults to AIM::Types::UInt and is explicitly instantiated for both widths.
+ *
+ * \code
+ * auto connectivityTable = meshReader.readConnectivityTable();
+ * auto largeConnectivityTable = AIM::Mesh::ConnectivityTable<std::uint64_t>{};
+ *
+ * // number of cells and number of vertices of the first cell
+ * auto numberOfCells = connectivityTable.size();
+ * auto numberOfVertices = connectivityTable[0].size();
+ *
+ * // loop over all cells and all vertices of each cell
+ * for (const auto &cell : connectivityTable)
+ *   for (const auto &vertex : cell)
+ *     std::cout << vertex << " ";
+ *
+ * // direct access to the underlying arrays, e.g. to pass them to third-party libraries
+ * const auto &offsets = connectivityTable.getOffsets();
+ * const auto &indices = connectivityTable.getIndices();
+ * \endcode
+ */
+
+template <typename UnsignedInteger = AIM::Types::UInt>
+class ConnectivityTable {
+  static_assert(AIM::Types::MeshIndexType<UnsignedInteger>, "connectivity indices must be 32-bit or 64-bit unsigned");
+
+  /// \name Custom types used in this class
+  /// @{
+public:
+  using IndexType = UnsignedInteger;
+  using CellType = std::span<const IndexType>;
+  class CellIterator;
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  ConnectivityTable() = default;
+  ConnectivityTable(std::vector<IndexType> offsets, std::vector<IndexType> indices);
+  ConnectivityTable(std::span<const IndexType> offsets, std::span<const IndexType> indices);
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  auto reserve(std::size_t numberOfCells, std::size_t numberOfIndices) -> void;
+  auto clear() -> void;
+  template <std::ranges::input_range CellRange>
+  auto addCell(const CellRange& cell) -> void;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto size() const -> std::size_t { return offsets_.size() - 1; }
+  auto empty() const -> bool { return size() == 0; }
+  auto getNumberOfIndices() const -> std::size_t { return indices_.size(); }
+  auto getNumberOfVerticesForCell(std::size_t cell) const -> IndexType { return offsets_[cell + 1] - offsets_[cell]; }
+  auto isOwning() const -> bool { return offsets_.isOwning() && indices_.isOwning(); }
+  auto getOffsets() const -> std::span<const IndexType> { return offsets_.view(); }
+  auto getIndices() const -> std::span<const IndexType> { return indices_.view(); }
+  auto begin() const -> CellIterator;
+  auto end() const -> CellIterator;
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator[](std::size_t cell) const -> CellType {
+    return CellType{indices_.data() + offsets_[cell], getNumberOfVerticesForCell(cell)};
+  }
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  auto assertConsistentOffsets() const -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  MeshArray<IndexType> offsets_{std::vector<IndexType>{0}};
+  MeshArray<IndexType> indices_;
+  /// @}
+};
+
+/**
+ * \class ConnectivityTable::CellIterator
+ * \brief Forward iterator over all cells of a ConnectivityTable, dereferencing to a std::span of vertex indices
+ * \ingroup mesh
+ */
+
+template <typename UnsignedInteger>
+class ConnectivityTable<UnsignedInteger>::CellIterator {
+public:
+  using value_type = typename ConnectivityTable::CellType;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::forward_iterator_tag;
+
+public:
+  CellIterator() = default;
+  CellIterator(const ConnectivityTable* table, std::size_t cell) : table_(table), cell_(cell) {}
+
+public:
+  auto operator*() const -> value_type { return (*table_)[cell_]; }
+  auto operator++() -> CellIterator& {
+    ++cell_;
+    return *this;
+  }
+  auto operator++(int) -> CellIterator {
+    auto current = *this;
+    ++cell_;
+    return current;
+  }
+  auto operator==(const CellIterator& other) const -> bool { return cell_ == other.cell_; }
+
+private:
+  const ConnectivityTable* table_{nullptr};
+  std::size_t cell_{0};
+};
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "connectivityTable.tpp"
@@ -0,0 +1,52 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <ranges>
+
+// third-party include headers
+
+// AIM include headers
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <typename UnsignedInteger>
+template <std::ranges::input_range CellRange>
+auto ConnectivityTable<UnsignedInteger>::addCell(const CellRange& cell) -> void {
+  for (const auto& vertex : cell)
+    indices_.push_back(static_cast<IndexType>(vertex));
+  offsets_.push_back(static_cast<IndexType>(indices_.size()));
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
@@ -0,0 +1,368 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// third-party include headers
+#include <mpi.h>
+
+#include "pcgnslib.h"
+
+// AIM include headers
+#include "src/computationalMesh/cgnsFileHandle/cgnsFileHandle.hpp"
+#include "src/computationalMesh/distributedMeshReading/distributedMeshReading.hpp"
+#include "src/parameterFileReading/parameterRegistry.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+#include "src/utilities/fileChecker/fileChecker.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::DistributedMeshReader(MPI_Comm communicator)
+  : communicator_(communicator) {
+  MPI_Comm_rank(communicator_, &rank_);
+  MPI_Comm_size(communicator_, &numberOfRanks_);
+  readParameters();
+
+  // ranks read disjoint slices, independent I/O avoids collective calls for ranks that have nothing to read
+  auto lock = std::scoped_lock{CGNSFileHandle::getLibraryMutex()};
+  auto errorCode = cgp_mpi_comm(communicator_);
+  assert(errorCode == 0 && "Could not set MPI communicator for parallel CGNS");
+  errorCode = cgp_pio_mode(CGNS_ENUMV(CGP_INDEPENDENT));
+  assert(errorCode == 0 && "Could not set parallel I/O mode");
+  errorCode = cgp_open(meshFile_.string().c_str(), CG_MODE_READ, &fileIndex_);
+  if (errorCode != 0)
+    throw std::runtime_error("could not open " + meshFile_.string() + " with parallel CGNS: " + cg_get_error());
+
+  readZone();
+  readCoordinateIndices();
+  readCellSections();
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::~DistributedMeshReader() {
+  auto lock = std::scoped_lock{CGNSFileHandle::getLibraryMutex()};
+  cgp_close(fileIndex_);
+}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readConnectivityTableSlice()
+  -> ConnectivityTableType {
+  auto [firstCell, lastCell] = getCellRange();
+  auto maxNumberOfVerticesPerCell = std::size_t{0};
+  for (const auto &[section, numberOfVerticesPerCell, firstElement, numberOfCellsInSection] : cellSections_)
+    maxNumberOfVerticesPerCell = std::max(maxNumberOfVerticesPerCell, std::size_t{numberOfVerticesPerCell});
+
+  auto cells = ConnectivityTableType{};
+  cells.reserve(lastCell - firstCell, (lastCell - firstCell) * maxNumberOfVerticesPerCell);
+  auto rawIndices = std::vector<AIM::Types::CGNSInt>((lastCell - firstCell) * maxNumberOfVerticesPerCell);
+  auto toZeroBased = std::views::transform([](AIM::Types::CGNSInt vertex) { return vertex - 1; });
+
+  // the local block of cells may span several sections, only the overlapping part of each section is read
+  auto firstCellOfSection = std::size_t{0};
+  for (const auto &[section, numberOfVerticesPerCell, firstElement, numberOfCellsInSection] : cellSections_) {
+    auto begin = std::max(firstCell, firstCellOfSection);
+    auto end = std::min(lastCell, firstCellOfSection + numberOfCellsInSection);
+    if (begin < end) {
+      auto start = firstElement + static_cast<AIM::Types::CGNSInt>(begin - firstCellOfSection);
+      auto stop = start + static_cast<AIM::Types::CGNSInt>(end - begin) - 1;
+      auto lock = std::unique_lock{CGNSFileHandle::getLibraryMutex()};
+      auto errorCode = cgp_elements_read_data(fileIndex_, 1, 1, section, start, stop, rawIndices.data());
+      assert(errorCode == 0 && "Could not read elements with parallel CGNS");
+      lock.unlock();
+
+      for (std::size_t cell = 0; cell < end - begin; ++cell)
+        cells.addCell(std::span{rawIndices}.subspan(cell * numberOfVerticesPerCell, numberOfVerticesPerCell) |
+                      toZeroBased);
+    }
+    firstCellOfSection += numberOfCellsInSection;
+  }
+  return cells;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::distribute() -> LocalMeshType {
+  auto targetRanks = std::vector<int>(getCellRange().second - getCellRange().first, rank_);
+  return distribute(targetRanks);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::distribute(std::span<const int> targetRanks)
+  -> LocalMeshType {
+  auto [firstCell, lastCell] = getCellRange();
+  if (targetRanks.size() != lastCell - firstCell)
+    throw std::runtime_error("expected a target rank for each of the " + std::to_string(lastCell - firstCell) +
+                             " cells of the local block, got " + std::to_string(targetRanks.size()));
+  if (std::ranges::any_of(targetRanks, [this](int target) { return target < 0 || target >= numberOfRanks_; }))
+    throw std::runtime_error("target ranks must be between 0 and " + std::to_string(numberOfRanks_ - 1));
+
+  // cells are sent as their global index, their number of vertices and their (global) vertices
+  auto cellSlice = readConnectivityTableSlice();
+  auto sendCells = std::vector<std::vector<IndexType>>(static_cast<std::size_t>(numberOfRanks_));
+  for (std::size_t cell = 0; cell < cellSlice.size(); ++cell) {
+    auto &buffer = sendCells[static_cast<std::size_t>(targetRanks[cell])];
+    buffer.push_back(static_cast<IndexType>(firstCell + cell));
+    buffer.push_back(cellSlice.getNumberOfVerticesForCell(cell));
+    buffer.insert(buffer.end(), cellSlice[cell].begin(), cellSlice[cell].end());
+  }
+  cellSlice = ConnectivityTableType{};
+  auto receivedCells = exchange(sendCells);
+  sendCells.clear();
+
+  // received cells are ordered by their global index, which keeps them grouped by element type
+  auto cellStarts = std::vector<std::pair<IndexType, std::pair<std::size_t, std::size_t>>>{};
+  auto numberOfIndices = std::size_t{0};
+  for (std::size_t rank = 0; rank < receivedCells.size(); ++rank) {
+    for (std::size_t position = 0; position < receivedCells[rank].size();) {
+      auto numberOfVerticesPerCell = static_cast<std::size_t>(receivedCells[rank][position + 1]);
+      cellStarts.emplace_back(receivedCells[rank][position], std::make_pair(rank, position + 2));
+      numberOfIndices += numberOfVerticesPerCell;
+      position += numberOfVerticesPerCell + 2;
+    }
+  }
+  std::ranges::sort(cellStarts, {}, [](const auto &cellStart) { return cellStart.first; });
+
+  auto localMesh = LocalMeshType{};
+  localMesh.globalVertices.reserve(numberOfIndices);
+  for (const auto &[globalCell, start] : cellStarts) {
+    const auto &[rank, position] = start;
+    auto numberOfVerticesPerCell = static_cast<std::size_t>(receivedCells[rank][position - 1]);
+    auto cell = std::span{receivedCells[rank]}.subspan(position, numberOfVerticesPerCell);
+    localMesh.globalVertices.insert(localMesh.globalVertices.end(), cell.begin(), cell.end());
+  }
+  std::ranges::sort(localMesh.globalVertices);
+  auto duplicates = std::ranges::unique(localMesh.globalVertices);
+  localMesh.globalVertices.erase(duplicates.begin(), duplicates.end());
+
+  // vertices are numbered locally in ascending global order
+  auto toLocal = std::views::transform([&globalVertices = localMesh.globalVertices](IndexType vertex) {
+    return static_cast<IndexType>(std::ranges::lower_bound(globalVertices, vertex) - globalVertices.begin());
+  });
+  localMesh.globalCells.reserve(cellStarts.size());
+  localMesh.cells.reserve(cellStarts.size(), numberOfIndices);
+  for (const auto &[globalCell, start] : cellStarts) {
+    const auto &[rank, position] = start;
+    auto numberOfVerticesPerCell = static_cast<std::size_t>(receivedCells[rank][position - 1]);
+    localMesh.globalCells.push_back(globalCell);
+    localMesh.cells.addCell(std::span{receivedCells[rank]}.subspan(position, numberOfVerticesPerCell) | toLocal);
+  }
+  receivedCells.clear();
+
+  // the coordinates of the required vertices are requested from the ranks that read them. The global vertices are
+  // sorted, so requests to each rank and the replies to them are in local vertex order
+  auto requests = std::vector<std::vector<IndexType>>(static_cast<std::size_t>(numberOfRanks_));
+  for (const auto &vertex : localMesh.globalVertices)
+    requests[static_cast<std::size_t>(getBlockOwner(vertex, numberOfVertices_, numberOfRanks_))].push_back(vertex);
+  auto receivedRequests = exchange(requests);
+
+  auto coordinateSlices = readCoordinateSlices();
+  auto firstVertex = getVertexRange().first;
+  auto replies = std::vector<std::vector<FloatType>>(static_cast<std::size_t>(numberOfRanks_));
+  for (std::size_t rank = 0; rank < receivedRequests.size(); ++rank) {
+    replies[rank].reserve(receivedRequests[rank].size() * static_cast<std::size_t>(Dimensions));
+    for (const auto &vertex : receivedRequests[rank])
+      for (const auto &coordinate : coordinateSlices)
+        replies[rank].push_back(coordinate[static_cast<std::size_t>(vertex) - firstVertex]);
+  }
+  coordinateSlices = CoordinatesType{};
+  auto receivedReplies = exchange(replies);
+
+  for (auto &coordinate : localMesh.coordinates)
+    coordinate.reserve(localMesh.globalVertices.size());
+  for (const auto &reply : receivedReplies)
+    for (std::size_t entry = 0; entry < reply.size(); ++entry)
+      localMesh.coordinates[entry % static_cast<std::size_t>(Dimensions)].push_back(reply[entry]);
+  return localMesh;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getBlockRange(
+  std::size_t size, int rank, int numberOfRanks) -> RangeType {
+  // the first size % numberOfRanks ranks hold one entry more than the remaining ones
+  auto ranks = static_cast<std::size_t>(numberOfRanks);
+  auto current = static_cast<std::size_t>(rank);
+  auto blockSize = size / ranks;
+  auto remainder = size % ranks;
+  auto first = current * blockSize + std::min(current, remainder);
+  return {first, first + blockSize + (current < remainder ? 1 : 0)};
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getBlockOwner(
+  std::size_t index, std::size_t size, int numberOfRanks) -> int {
+  assert(index < size && "index is outside of the distributed range");
+  auto ranks = static_cast<std::size_t>(numberOfRanks);
+  auto blockSize = size / ranks;
+  auto remainder = size % ranks;
+  auto largeBlocks = remainder * (blockSize + 1);
+  if (index < largeBlocks)
+    return static_cast<int>(index / (blockSize + 1));
+  return static_cast<int>(remainder + (index - largeBlocks) / blockSize);
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readParameters() -> void {
+  auto parameters = AIM::Parameters::ParameterRegistry{"input/aim.json"};
+  auto meshFile =
+    parameters.declare<std::filesystem::path>("/mesh/filename", std::filesystem::path{"input/mesh.cgns"});
+  parameters.validate();
+
+  meshFile_ = parameters.get(meshFile);
+  AIM::Utilities::FileChecker::checkIfFileExists(meshFile_);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readZone() -> void {
+  auto numberOfBases = int{0};
+  auto errorCode = cg_nbases(fileIndex_, &numberOfBases);
+  assert(errorCode == 0 && "Could not read number of bases from file");
+  auto numberOfZones = int{0};
+  errorCode = cg_nzones(fileIndex_, 1, &numberOfZones);
+  assert(errorCode == 0 && "Could not read number of zones from base");
+  if (numberOfBases != 1 || numberOfZones != 1)
+    throw std::runtime_error("distributed reading requires a single base and zone, " + meshFile_.string() + " has " +
+                             std::to_string(numberOfBases) + " bases and " + std::to_string(numberOfZones) +
+                             " zones in the first base");
+
+  AIM::Types::CGNSInt gridSizeProperties[3][1]{};
+  char zoneName[33]{};
+  errorCode = cg_zone_read(fileIndex_, 1, 1, zoneName, gridSizeProperties[0]);
+  assert(errorCode == 0 && "Could not read number of vertices from zone");
+  numberOfVertices_ = static_cast<std::size_t>(gridSizeProperties[0][0]);
+  if (numberOfVertices_ > std::numeric_limits<IndexType>::max())
+    throw std::runtime_error("mesh has " + std::to_string(numberOfVertices_) + " vertices, which exceeds the range "
+                             "of the index type, use 64-bit indices instead");
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readCoordinateIndices() -> void {
+  // parallel CGNS addresses coordinates by their index within the zone, which need not follow the X, Y, Z order
+  constexpr const char *coordinateName[] = {"CoordinateX", "CoordinateY", "CoordinateZ"};
+  auto numberOfCoordinates = int{0};
+  auto errorCode = cg_ncoords(fileIndex_, 1, 1, &numberOfCoordinates);
+  assert(errorCode == 0 && "Could not read number of coordinates from zone");
+  for (int coordinate = 1; coordinate <= numberOfCoordinates; ++coordinate) {
+    auto dataType = CGNS_ENUMT(DataType_t){};
+    char name[33]{};
+    errorCode = cg_coord_info(fileIndex_, 1, 1, coordinate, &dataType, name);
+    assert(errorCode == 0 && "Could not read coordinate information from zone");
+    for (std::size_t index = 0; index < coordinateIndices_.size(); ++index)
+      if (std::string(name) == coordinateName[index])
+        coordinateIndices_[index] = coordinate;
+  }
+  for (std::size_t index = 0; index < coordinateIndices_.size(); ++index)
+    if (coordinateIndices_[index] == 0)
+      throw std::runtime_error(std::string(coordinateName[index]) + " is missing in " + meshFile_.string());
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readCellSections() -> void {
+  auto numberOfSections = int{0};
+  auto errorCode = cg_nsections(fileIndex_, 1, 1, &numberOfSections);
+  assert(errorCode == 0 && "Could not read number of sections from file");
+  for (int section = 1; section <= numberOfSections; ++section) {
+    auto begin = AIM::Types::CGNSInt{0};
+    auto end = AIM::Types::CGNSInt{0};
+    char sectionName[33]{};
+    auto indexOfLastElement = int{0};
+    auto parentDataExist = int{0};
+    auto cellType = CGNS_ENUMT(ElementType_t){};
+    errorCode = cg_section_read(
+      fileIndex_, 1, 1, section, sectionName, &cellType, &begin, &end, &indexOfLastElement, &parentDataExist);
+    assert(errorCode == 0 && "Could not read section from zone");
+    if (cellType == CGNS_ENUMV(MIXED))
+      throw std::runtime_error("mixed element sections are not supported by the distributed mesh reader");
+    auto numberOfVerticesPerCell = getNumberOfVerticesPerCell(cellType);
+    if (numberOfVerticesPerCell > 0)
+      cellSections_.emplace_back(section, numberOfVerticesPerCell, begin, static_cast<std::size_t>(end - begin + 1));
+  }
+
+  // same global cell numbering as the MeshReader, i.e. sections grouped by element type
+  std::ranges::stable_sort(cellSections_, {}, [](const auto &section) { return std::get<1>(section); });
+  numberOfCells_ = 0;
+  for (const auto &[section, numberOfVerticesPerCell, firstElement, numberOfCellsInSection] : cellSections_)
+    numberOfCells_ += numberOfCellsInSection;
+  if (numberOfCells_ > std::numeric_limits<IndexType>::max())
+    throw std::runtime_error("mesh has " + std::to_string(numberOfCells_) + " cells, which exceeds the range of the "
+                             "index type, use 64-bit indices instead");
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getNumberOfVerticesPerCell(
+  CGNS_ENUMT(ElementType_t) cellType) -> AIM::Types::UInt {
+  if constexpr (Dimensions == AIM::Enum::Dimension::Two) {
+    if (cellType == CGNS_ENUMV(TRI_3)) return 3u;
+    if (cellType == CGNS_ENUMV(QUAD_4)) return 4u;
+  } else {
+    if (cellType == CGNS_ENUMV(TETRA_4)) return 4u;
+    if (cellType == CGNS_ENUMV(PYRA_5)) return 5u;
+    if (cellType == CGNS_ENUMV(PENTA_6)) return 6u;
+    if (cellType == CGNS_ENUMV(HEXA_8)) return 8u;
+  }
+  return 0u;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readCoordinateSlices() -> CoordinatesType {
+  auto coordinates = CoordinatesType{};
+  coordinates[AIM::Enum::Coordinate::X] = readCoordinateSlice<AIM::Enum::Coordinate::X>();
+  coordinates[AIM::Enum::Coordinate::Y] = readCoordinateSlice<AIM::Enum::Coordinate::Y>();
+  if constexpr (Dimensions == AIM::Enum::Dimension::Three)
+    coordinates[AIM::Enum::Coordinate::Z] = readCoordinateSlice<AIM::Enum::Coordinate::Z>();
+  return coordinates;
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+// explicit instantiation of the supported mesh dimensions, index and floating point types
+template class DistributedMeshReader<AIM::Enum::Dimension::Two, std::uint32_t, float>;
+template class DistributedMeshReader<AIM::Enum::Dimension::Two, std::uint32_t, double>;
+template class DistributedMeshReader<AIM::Enum::Dimension::Two, std::uint64_t, float>;
+template class DistributedMeshReader<AIM::Enum::Dimension::Two, std::uint64_t, double>;
+template class DistributedMeshReader<AIM::Enum::Dimension::Three, std::uint32_t, float>;
+template class DistributedMeshReader<AIM::Enum::Dimension::Three, std::uint32_t, double>;
+template class DistributedMeshReader<AIM::Enum::Dimension::Three, std::uint64_t, float>;
+template class DistributedMeshReader<AIM::Enum::Dimension::Three, std::uint64_t, double>;
+
+}  // namespace Mesh
+}  // end namespace AIM
@@ -0,0 +1,172 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// third-party include headers
+#include <mpi.h>
+
+#include "pcgnslib.h"
+
+// AIM include headers
+#include "src/computationalMesh/connectivityTable/connectivityTable.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class DistributedMeshReader
+ * \brief Reads a CGNS mesh with parallel CGNS (MPI-IO), each rank reading only its own slice of the mesh
+ * \ingroup mesh
+ *
+ * The AIM::Mesh::MeshReader reads the complete mesh on every process, which limits the mesh size to the memory of a
+ * single node. The DistributedMeshReader opens the mesh file collectively on all ranks of an MPI communicator
+ * (cgp_open) and splits vertices and cells into contiguous, balanced blocks. Each rank reads only its block of the
+ * coordinates and of the element sections (cgp_coord_general_read_data and cgp_elements_read_data), i.e. roughly 1/N of
+ * the file. Cells are numbered globally in the same way as by the MeshReader, i.e. grouped by element type.
+ *
+ * Blocks are rarely a good partition, as neighbouring cells in the file are not necessarily neighbours in space. The
+ * distribute() method therefore sends each cell of the local block to the rank given by the caller (for example from
+ * a partitioner) and gathers the coordinates of all vertices referenced by the received cells from the ranks that
+ * read them. Only the cells and vertices of the final partition are ever held by a rank.
+ *
+ * The reader is only available if AIM is configured with AIM_ENABLE_MPI, which requires MPI and a CGNS library built
+ * with parallel HDF5. Only single base, single zone meshes without mixed element sections are supported. All methods
+ * are collective, i.e. they have to be called by all ranks of the communicator in the same order.
+ *
+ * \code
+ * MPI_Init(&argc, &argv);
+ * {
+ *   auto reader = AIM::Mesh::DistributedMeshReader<AIM::Enum::Dimension::Three>{MPI_COMM_WORLD};
+ *
+ *   // target rank of each cell in the local block, e.g. from a partitioner
+ *   auto targetRanks = std::vector<int>(reader.getCellRange().second - reader.getCellRange().first);
+ *   ...
+ *   auto localMesh = reader.distribute(targetRanks);
+ *   for (std::size_t cell = 0; cell < localMesh.cells.size(); ++cell)
+ *     for (const auto &vertex : localMesh.cells[cell])
+ *       auto x = localMesh.coordinates[AIM::Enum::Coordinate::X][vertex];
+ * }
+ * MPI_Finalize();
+ * \endcode
+ *
+ * The example can be run locally with mpirun -np 4 on a single machine.
+ */
+
+template <int Dimensions, typename UnsignedInteger = AIM::Types::UInt, typename FloatingPoint = AIM::Types::FloatType>
+class DistributedMeshReader {
+  static_assert(AIM::Types::MeshIndexType<UnsignedInteger>, "mesh indices must be 32-bit or 64-bit unsigned");
+  static_assert(AIM::Types::MeshFloatType<FloatingPoint>, "mesh coordinates must be stored as float or double");
+
+  /// \name Custom types used in this class
+  /// @{
+public:
+  using IndexType = UnsignedInteger;
+  using FloatType = FloatingPoint;
+  using CoordinateType = typename std::vector<FloatType>;
+  using CoordinatesType = typename std::array<CoordinateType, static_cast<std::size_t>(Dimensions)>;
+  using ConnectivityTableType = ConnectivityTable<IndexType>;
+  using RangeType = typename std::pair<std::size_t, std::size_t>;
+
+  struct LocalMeshType {
+    std::vector<IndexType> globalCells;
+    std::vector<IndexType> globalVertices;
+    ConnectivityTableType cells;
+    CoordinatesType coordinates;
+  };
+
+private:
+  // section index, number of vertices per cell, first element of the section and number of cells in the section
+  using CellSectionsType = std::vector<std::tuple<int, AIM::Types::UInt, AIM::Types::CGNSInt, std::size_t>>;
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  explicit DistributedMeshReader(MPI_Comm communicator = MPI_COMM_WORLD);
+  DistributedMeshReader(const DistributedMeshReader&) = delete;
+  DistributedMeshReader(DistributedMeshReader&&) = delete;
+  ~DistributedMeshReader();
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  template <int Index>
+  auto readCoordinateSlice() -> CoordinateType;
+  auto readConnectivityTableSlice() -> ConnectivityTableType;
+  auto distribute() -> LocalMeshType;
+  auto distribute(std::span<const int> targetRanks) -> LocalMeshType;
+  static auto getBlockRange(std::size_t size, int rank, int numberOfRanks) -> RangeType;
+  static auto getBlockOwner(std::size_t index, std::size_t size, int numberOfRanks) -> int;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  static constexpr auto getDimensions() -> short int { return Dimensions; }
+  auto getMeshFile() const -> const std::filesystem::path& { return meshFile_; }
+  auto getRank() const -> int { return rank_; }
+  auto getNumberOfRanks() const -> int { return numberOfRanks_; }
+  auto getNumberOfVertices() const -> std::size_t { return numberOfVertices_; }
+  auto getNumberOfCells() const -> std::size_t { return numberOfCells_; }
+  auto getVertexRange() const -> RangeType { return getBlockRange(numberOfVertices_, rank_, numberOfRanks_); }
+  auto getCellRange() const -> RangeType { return getBlockRange(numberOfCells_, rank_, numberOfRanks_); }
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const DistributedMeshReader&) -> DistributedMeshReader& = delete;
+  auto operator=(DistributedMeshReader&&) -> DistributedMeshReader& = delete;
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  auto readParameters() -> void;
+  auto readZone() -> void;
+  auto readCoordinateIndices() -> void;
+  auto readCellSections() -> void;
+  auto getNumberOfVerticesPerCell(CGNS_ENUMT(ElementType_t) cellType) -> AIM::Types::UInt;
+  auto readCoordinateSlices() -> CoordinatesType;
+  template <typename Type>
+  auto exchange(const std::vector<std::vector<Type>>& sendBuffers) const -> std::vector<std::vector<Type>>;
+  template <typename Type>
+  static auto getMPIType() -> MPI_Datatype;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  MPI_Comm communicator_;
+  int rank_{0};
+  int numberOfRanks_{1};
+  std::filesystem::path meshFile_;
+  int fileIndex_{0};
+  std::size_t numberOfVertices_{0};
+  std::size_t numberOfCells_{0};
+  std::array<int, static_cast<std::size_t>(Dimensions)> coordinateIndices_{};
+  CellSectionsType cellSections_;
+  /// @}
+};
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "distributedMeshReading.tpp"
@@ -0,0 +1,132 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cassert>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// third-party include headers
+#include <mpi.h>
+
+#include "pcgnslib.h"
+
+// AIM include headers
+#include "src/computationalMesh/cgnsFileHandle/cgnsFileHandle.hpp"
+#include "src/types/types.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+template <int Index>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readCoordinateSlice() -> CoordinateType {
+  static_assert(Index >= 0 && Index < Dimensions, "coordinate index must be smaller than the mesh dimension");
+  auto [firstVertex, lastVertex] = getVertexRange();
+  auto coordinate = CoordinateType(lastVertex - firstVertex);
+  if (coordinate.empty())
+    return coordinate;
+
+  // the file range is written into a contiguous one-dimensional memory range, converted to the storage precision
+  AIM::Types::CGNSInt begin{static_cast<AIM::Types::CGNSInt>(firstVertex + 1)};
+  AIM::Types::CGNSInt end{static_cast<AIM::Types::CGNSInt>(lastVertex)};
+  AIM::Types::CGNSInt memoryDimension{static_cast<AIM::Types::CGNSInt>(coordinate.size())};
+  AIM::Types::CGNSInt memoryBegin{1};
+  AIM::Types::CGNSInt memoryEnd{memoryDimension};
+  constexpr auto dataType = std::is_same_v<FloatType, float> ? CGNS_ENUMV(RealSingle) : CGNS_ENUMV(RealDouble);
+
+  auto lock = std::scoped_lock{CGNSFileHandle::getLibraryMutex()};
+  auto errorCode = cgp_coord_general_read_data(fileIndex_, 1, 1, coordinateIndices_[Index], &begin, &end, dataType, 1,
+    &memoryDimension, &memoryBegin, &memoryEnd, coordinate.data());
+  assert(errorCode == 0 && "Could not read coordinates with parallel CGNS");
+  return coordinate;
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+template <typename Type>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::exchange(
+  const std::vector<std::vector<Type>>& sendBuffers) const -> std::vector<std::vector<Type>> {
+  // all-to-all exchange of variable sized buffers, the sizes are exchanged first so each rank can allocate its receive
+  // buffer. MPI counts and displacements are int, larger buffers have to be exchanged in several rounds by the caller
+  auto ranks = static_cast<std::size_t>(numberOfRanks_);
+  auto sendCounts = std::vector<int>(ranks);
+  auto sendDisplacements = std::vector<int>(ranks + 1, 0);
+  for (std::size_t rank = 0; rank < ranks; ++rank) {
+    if (sendBuffers[rank].size() > static_cast<std::size_t>(INT_MAX - sendDisplacements[rank]))
+      throw std::runtime_error("MPI exchange buffer exceeds the maximum message size");
+    sendCounts[rank] = static_cast<int>(sendBuffers[rank].size());
+    sendDisplacements[rank + 1] = sendDisplacements[rank] + sendCounts[rank];
+  }
+  auto receiveCounts = std::vector<int>(ranks);
+  MPI_Alltoall(sendCounts.data(), 1, MPI_INT, receiveCounts.data(), 1, MPI_INT, communicator_);
+  auto receiveDisplacements = std::vector<int>(ranks + 1, 0);
+  for (std::size_t rank = 0; rank < ranks; ++rank) {
+    if (receiveCounts[rank] > INT_MAX - receiveDisplacements[rank])
+      throw std::runtime_error("MPI exchange buffer exceeds the maximum message size");
+    receiveDisplacements[rank + 1] = receiveDisplacements[rank] + receiveCounts[rank];
+  }
+
+  auto sendBuffer = std::vector<Type>{};
+  sendBuffer.reserve(static_cast<std::size_t>(sendDisplacements.back()));
+  for (const auto &buffer : sendBuffers)
+    sendBuffer.insert(sendBuffer.end(), buffer.begin(), buffer.end());
+  auto receiveBuffer = std::vector<Type>(static_cast<std::size_t>(receiveDisplacements.back()));
+  MPI_Alltoallv(sendBuffer.data(), sendCounts.data(), sendDisplacements.data(), getMPIType<Type>(),
+    receiveBuffer.data(), receiveCounts.data(), receiveDisplacements.data(), getMPIType<Type>(), communicator_);
+
+  auto receiveBuffers = std::vector<std::vector<Type>>(ranks);
+  for (std::size_t rank = 0; rank < ranks; ++rank)
+    receiveBuffers[rank].assign(receiveBuffer.begin() + receiveDisplacements[rank],
+      receiveBuffer.begin() + receiveDisplacements[rank + 1]);
+  return receiveBuffers;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+template <typename Type>
+auto DistributedMeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getMPIType() -> MPI_Datatype {
+  if constexpr (std::is_same_v<Type, std::uint32_t>)
+    return MPI_UINT32_T;
+  else if constexpr (std::is_same_v<Type, std::uint64_t>)
+    return MPI_UINT64_T;
+  else if constexpr (std::is_same_v<Type, float>)
+    return MPI_FLOAT;
+  else {
+    static_assert(std::is_same_v<Type, double>, "unsupported type for MPI exchange");
+    return MPI_DOUBLE;
+  }
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
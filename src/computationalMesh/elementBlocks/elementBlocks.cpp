@@ -0,0 +1,102 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/elementBlocks/elementBlocks.hpp"
+#include "src/types/enums.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+ElementBlocks<Dimensions, UnsignedInteger>::ElementBlocks(const ConnectivityTableType& cells)
+  : numberOfCells_(cells.size()) {
+  // as the cells are grouped by element type, the element type never decreases from one cell to the next and each
+  // block is a contiguous range of cells. It is only looked up again once the number of vertices changes
+  auto lastCell = std::array<std::size_t, numberOfElementTypes_>{};
+  auto elementType = -1;
+  auto numberOfVertices = std::size_t{0};
+  for (std::size_t cell = 0; cell < cells.size(); ++cell) {
+    if (cells.getNumberOfVerticesForCell(cell) != numberOfVertices) {
+      numberOfVertices = cells.getNumberOfVerticesForCell(cell);
+      auto nextElementType = getElementType(numberOfVertices);
+      if (nextElementType < elementType)
+        throw std::runtime_error("cells are not grouped by element type, cell " + std::to_string(cell) +
+                                 " has fewer vertices than the cell before it");
+      elementType = nextElementType;
+      firstCell_[static_cast<std::size_t>(elementType)] = cell;
+    }
+    lastCell[static_cast<std::size_t>(elementType)] = cell + 1;
+  }
+
+  auto offsets = cells.getOffsets();
+  auto indices = cells.getIndices();
+  for (std::size_t type = 0; type < numberOfElementTypes_; ++type)
+    if (lastCell[type] > firstCell_[type])
+      indices_[type] = indices.subspan(offsets[firstCell_[type]], offsets[lastCell[type]] - offsets[firstCell_[type]]);
+}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+auto ElementBlocks<Dimensions, UnsignedInteger>::getElementType(std::size_t numberOfVertices) -> int {
+  // within a given dimension, the number of vertices uniquely identifies the (linear) element type
+  if constexpr (Dimensions == AIM::Enum::Dimension::Two) {
+    if (numberOfVertices == 3) return AIM::Enum::ElementType::Tri3;
+    if (numberOfVertices == 4) return AIM::Enum::ElementType::Quad4;
+  } else {
+    if (numberOfVertices == 4) return AIM::Enum::ElementType::Tetra4;
+    if (numberOfVertices == 5) return AIM::Enum::ElementType::Pyra5;
+    if (numberOfVertices == 6) return AIM::Enum::ElementType::Penta6;
+    if (numberOfVertices == 8) return AIM::Enum::ElementType::Hexa8;
+  }
+  throw std::runtime_error("cells with " + std::to_string(numberOfVertices) + " vertices are not supported in a " +
+                           std::to_string(Dimensions) + "D mesh");
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+auto ElementBlocks<Dimensions, UnsignedInteger>::getNumberOfBlocks() const -> std::size_t {
+  return static_cast<std::size_t>(std::ranges::count_if(indices_, [](const auto &block) { return !block.empty(); }));
+}
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+// explicit instantiation of the supported mesh dimensions and index types
+template class ElementBlocks<AIM::Enum::Dimension::Two, std::uint32_t>;
+template class ElementBlocks<AIM::Enum::Dimension::Two, std::uint64_t>;
+template class ElementBlocks<AIM::Enum::Dimension::Three, std::uint32_t>;
+template class ElementBlocks<AIM::Enum::Dimension::Three, std::uint64_t>;
+
+}  // namespace Mesh
+}  // end namespace AIM
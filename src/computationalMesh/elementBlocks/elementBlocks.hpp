@@ -0,0 +1,167 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/connectivityTable/connectivityTable.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class ElementBlocks
+ * \brief Splits a connectivity table into homogeneous blocks of a single element type each
+ * \ingroup mesh
+ *
+ * The connectivity table stores cells with a different number of vertices back to back, so that a loop over all cells
+ * has to look up the number of vertices of each cell and cannot be unrolled or vectorised. The AIM::Mesh::MeshReader
+ * and the AIM::Mesh::MeshRenumbering keep cells of the same element type together, ordered by element type (see
+ * AIM::Enum::ElementType), i.e. triangles before quads in 2D and tetrahedra, pyramids, prisms and hexahedra in 3D.
+ * Within each such block, all cells have the same number of vertices and are stored with a fixed stride.
+ *
+ * This class identifies these blocks and exposes them through forEachBlock(), which calls a function once for each
+ * non-empty block. The block is passed as an ElementBlock<ElementType>, whose element type is a template argument, so
+ * that the number of vertices per cell is a compile-time constant inside the function and indexing into the block
+ * returns a std::span with a static extent. Kernels written against it are free of branches on the element type.
+ *
+ * The blocks are views into the connectivity table, no data is copied. They are only valid as long as the connectivity
+ * table is alive and not modified. Cell indices within a block are local, getFirstCell() returns the index of the
+ * first cell of the block in the connectivity table, so that cell based arrays can be indexed with
+ * block.getFirstCell() + cell. A std::runtime_error is thrown if the connectivity table contains a cell that is not a
+ * supported element type of the mesh dimension, or if the cells are not grouped by element type.
+ *
+ * \code
+ * auto elementBlocks = mesh.getElementBlocks();
+ * elementBlocks.forEachBlock([&](const auto &block) {
+ *   constexpr auto numberOfVertices = std::remove_cvref_t<decltype(block)>::numberOfVertices;
+ *   for (std::size_t cell = 0; cell < block.size(); ++cell) {
+ *     auto average = 0.0;
+ *     for (const auto &vertex : block[cell])
+ *       average += x[vertex];
+ *     cellAverage[block.getFirstCell() + cell] = average / numberOfVertices;
+ *   }
+ * });
+ *
+ * // a single block can also be requested directly, it is empty if the mesh does not contain the element type
+ * auto quads = elementBlocks.getBlock<AIM::Enum::ElementType::Quad4>();
+ * \endcode
+ */
+
+template <int Dimensions, typename UnsignedInteger = AIM::Types::UInt>
+class ElementBlocks {
+  static_assert(AIM::Types::MeshIndexType<UnsignedInteger>, "mesh indices must be 32-bit or 64-bit unsigned");
+
+  /// \name Custom types used in this class
+  /// @{
+public:
+  using IndexType = UnsignedInteger;
+  using ConnectivityTableType = ConnectivityTable<IndexType>;
+  using ElementTypesType = std::conditional_t<Dimensions == AIM::Enum::Dimension::Two,
+    std::integer_sequence<int, AIM::Enum::ElementType::Tri3, AIM::Enum::ElementType::Quad4>,
+    std::integer_sequence<int, AIM::Enum::ElementType::Tetra4, AIM::Enum::ElementType::Pyra5,
+      AIM::Enum::ElementType::Penta6, AIM::Enum::ElementType::Hexa8>>;
+  template <int ElementType>
+  class ElementBlock;
+
+private:
+  static constexpr auto numberOfElementTypes_ = static_cast<std::size_t>(AIM::Enum::ElementType::Hexa8) + 1;
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  ElementBlocks(const ConnectivityTableType& cells);
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  template <typename Function>
+  auto forEachBlock(Function&& function) const -> void;
+  static auto getElementType(std::size_t numberOfVertices) -> int;
+  static constexpr auto getNumberOfVerticesPerElement(int elementType) -> std::size_t {
+    constexpr auto numberOfVertices = std::array<std::size_t, numberOfElementTypes_>{3, 4, 4, 5, 6, 8};
+    return numberOfVertices[static_cast<std::size_t>(elementType)];
+  }
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  template <int ElementType>
+  auto getBlock() const -> ElementBlock<ElementType>;
+  auto getNumberOfBlocks() const -> std::size_t;
+  auto getNumberOfCells() const -> std::size_t { return numberOfCells_; }
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  std::size_t numberOfCells_{0};
+  std::array<std::size_t, numberOfElementTypes_> firstCell_{};
+  std::array<std::span<const IndexType>, numberOfElementTypes_> indices_{};
+  /// @}
+};
+
+/**
+ * \class ElementBlocks::ElementBlock
+ * \brief View over all cells of a single element type, stored with a fixed number of vertices per cell
+ * \ingroup mesh
+ */
+
+template <int Dimensions, typename UnsignedInteger>
+template <int ElementType>
+class ElementBlocks<Dimensions, UnsignedInteger>::ElementBlock {
+public:
+  static constexpr auto elementType = ElementType;
+  static constexpr auto numberOfVertices = ElementBlocks::getNumberOfVerticesPerElement(ElementType);
+  using CellType = std::span<const IndexType, numberOfVertices>;
+
+public:
+  ElementBlock(std::size_t firstCell, std::span<const IndexType> indices) : firstCell_(firstCell), indices_(indices) {}
+
+public:
+  auto getFirstCell() const -> std::size_t { return firstCell_; }
+  auto getIndices() const -> std::span<const IndexType> { return indices_; }
+  auto size() const -> std::size_t { return indices_.size() / numberOfVertices; }
+  auto empty() const -> bool { return indices_.empty(); }
+
+public:
+  auto operator[](std::size_t cell) const -> CellType {
+    return CellType{indices_.data() + cell * numberOfVertices, numberOfVertices};
+  }
+
+private:
+  std::size_t firstCell_{0};
+  std::span<const IndexType> indices_;
+};
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "elementBlocks.tpp"
@@ -0,0 +1,68 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// third-party include headers
+
+// AIM include headers
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+template <typename Function>
+auto ElementBlocks<Dimensions, UnsignedInteger>::forEachBlock(Function&& function) const -> void {
+  auto visitBlock = [this, &function]<int ElementType>(std::integral_constant<int, ElementType>) {
+    auto block = getBlock<ElementType>();
+    if (!block.empty())
+      function(block);
+  };
+  [&visitBlock]<int... ElementType>(std::integer_sequence<int, ElementType...>) {
+    (visitBlock(std::integral_constant<int, ElementType>{}), ...);
+  }(ElementTypesType{});
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+template <int ElementType>
+auto ElementBlocks<Dimensions, UnsignedInteger>::getBlock() const -> ElementBlock<ElementType> {
+  static_assert(Dimensions == AIM::Enum::Dimension::Two
+                  ? ElementType <= AIM::Enum::ElementType::Quad4
+                  : ElementType >= AIM::Enum::ElementType::Tetra4 && ElementType <= AIM::Enum::ElementType::Hexa8,
+    "element type does not exist for the dimension of the mesh");
+  constexpr auto index = static_cast<std::size_t>(ElementType);
+  return ElementBlock<ElementType>{firstCell_[index], indices_[index]};
+}
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
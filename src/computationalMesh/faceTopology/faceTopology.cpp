@@ -0,0 +1,340 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/faceTopology/faceTopology.hpp"
+#include "src/types/enums.hpp"
+#include "src/utilities/hardwareCounters/hardwareCounters.hpp"
+#include "src/utilities/scratchArena/scratchArena.hpp"
+#include "src/utilities/threadPool/threadPool.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+FaceTopology<Dimensions, UnsignedInteger>::FaceTopology(
+  const ConnectivityTableType& cells, const BoundaryFaceConnectivityType& boundaryFaces) {
+  orderBoundaries({}, boundaryFaces.size());
+  build(cells, boundaryFaces);
+}
+
+template <int Dimensions, typename UnsignedInteger>
+FaceTopology<Dimensions, UnsignedInteger>::FaceTopology(const ConnectivityTableType& cells,
+  const BoundaryFaceConnectivityType& boundaryFaces, const BoundaryConditionType& boundaryConditions) {
+  if (boundaryConditions.size() != boundaryFaces.size())
+    throw std::runtime_error("number of boundary conditions (" + std::to_string(boundaryConditions.size()) +
+                             ") does not match number of boundaries (" + std::to_string(boundaryFaces.size()) + ")");
+  orderBoundaries(boundaryConditions, boundaryFaces.size());
+  build(cells, boundaryFaces);
+
+  // boundaries are ordered by type, so the faces of each type follow each other and only have to be counted.
+  // Unassigned boundaries are ordered last and do not belong to any group
+  auto numberOfFacesPerType = std::array<IndexType, numberOfBoundaryConditions_ + 1>{};
+  for (std::size_t boundary = 0; boundary < boundaryConditions.size(); ++boundary) {
+    if (boundaryConditions[boundary].first == AIM::Enum::BoundaryCondition::Unassigned)
+      continue;
+    const auto [first, last] = getBoundaryFaceRange(boundary);
+    numberOfFacesPerType[static_cast<std::size_t>(boundaryConditions[boundary].first) + 1] +=
+      static_cast<IndexType>(last - first);
+  }
+  numberOfFacesPerType[0] = boundaryFaceOffsets_.front();
+  std::partial_sum(
+    numberOfFacesPerType.begin(), numberOfFacesPerType.end(), boundaryConditionFaceOffsets_.begin());
+}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+auto FaceTopology<Dimensions, UnsignedInteger>::getNumberOfFacesForCell(
+  std::size_t numberOfVerticesPerCell) -> std::size_t {
+  if constexpr (Dimensions == AIM::Enum::Dimension::Two) {
+    if (numberOfVerticesPerCell == 3 || numberOfVerticesPerCell == 4)
+      return numberOfVerticesPerCell;
+  } else {
+    switch (numberOfVerticesPerCell) {
+      case 4: return 4;
+      case 5: return 5;
+      case 6: return 5;
+      case 8: return 6;
+    }
+  }
+  throw std::runtime_error(
+    "face topology does not support cells with " + std::to_string(numberOfVerticesPerCell) + " vertices");
+}
+
+template <int Dimensions, typename UnsignedInteger>
+auto FaceTopology<Dimensions, UnsignedInteger>::getLocalFace(
+  std::size_t numberOfVerticesPerCell, std::size_t face) -> LocalFaceType {
+  // local face definitions follow the CGNS standard element numbering (zero-based), normals point out of the cell
+  static constexpr std::array<std::array<std::uint8_t, 2>, 4> edges{{{0, 1}, {1, 2}, {2, 3}, {3, 0}}};
+  static constexpr std::array<std::array<std::uint8_t, 2>, 3> triangleEdges{{{0, 1}, {1, 2}, {2, 0}}};
+  static constexpr std::array<std::array<std::uint8_t, 3>, 4> tetraFaces{{{0, 2, 1}, {0, 1, 3}, {1, 2, 3}, {2, 0, 3}}};
+  static constexpr std::array<std::uint8_t, 4> pyraBase{0, 3, 2, 1};
+  static constexpr std::array<std::array<std::uint8_t, 3>, 4> pyraSides{{{0, 1, 4}, {1, 2, 4}, {2, 3, 4}, {3, 0, 4}}};
+  static constexpr std::array<std::array<std::uint8_t, 4>, 3> pentaSides{{{0, 1, 4, 3}, {1, 2, 5, 4}, {2, 0, 3, 5}}};
+  static constexpr std::array<std::array<std::uint8_t, 3>, 2> pentaCaps{{{0, 2, 1}, {3, 4, 5}}};
+  static constexpr std::array<std::array<std::uint8_t, 4>, 6> hexaFaces{
+    {{0, 3, 2, 1}, {0, 1, 5, 4}, {1, 2, 6, 5}, {2, 3, 7, 6}, {0, 4, 7, 3}, {4, 5, 6, 7}}};
+
+  if constexpr (Dimensions == AIM::Enum::Dimension::Two) {
+    if (numberOfVerticesPerCell == 3)
+      return triangleEdges[face];
+    if (numberOfVerticesPerCell == 4)
+      return edges[face];
+  } else {
+    switch (numberOfVerticesPerCell) {
+      case 4: return tetraFaces[face];
+      case 5: return face == 0 ? LocalFaceType{pyraBase} : LocalFaceType{pyraSides[face - 1]};
+      case 6: return face < 3 ? LocalFaceType{pentaSides[face]} : LocalFaceType{pentaCaps[face - 3]};
+      case 8: return hexaFaces[face];
+    }
+  }
+  throw std::runtime_error(
+    "face topology does not support cells with " + std::to_string(numberOfVerticesPerCell) + " vertices");
+}
+
+template <int Dimensions, typename UnsignedInteger>
+auto FaceTopology<Dimensions, UnsignedInteger>::makeFaceKey(
+  std::span<const IndexType> cell, LocalFaceType localFace) -> FaceKeyType {
+  // unused entries of triangular faces are padded with the largest index so that they never match quadrilateral faces
+  auto key = FaceKeyType{};
+  key.fill(std::numeric_limits<IndexType>::max());
+  for (std::size_t vertex = 0; vertex < localFace.size(); ++vertex)
+    key[vertex] = cell[localFace[vertex]];
+  std::sort(key.begin(), key.begin() + static_cast<std::ptrdiff_t>(localFace.size()));
+  return key;
+}
+
+template <int Dimensions, typename UnsignedInteger>
+auto FaceTopology<Dimensions, UnsignedInteger>::compareFaceRecords(
+  const FaceRecordType& lhs, const FaceRecordType& rhs) -> bool {
+  return std::tie(lhs.key, lhs.cell, lhs.localFace) < std::tie(rhs.key, rhs.cell, rhs.localFace);
+}
+
+template <int Dimensions, typename UnsignedInteger>
+auto FaceTopology<Dimensions, UnsignedInteger>::splitIntoChunks(std::size_t size) -> std::vector<FaceRangeType> {
+  // small meshes are processed on the calling thread, the overhead of scheduling tasks would dominate otherwise
+  constexpr auto minimumChunkSize = std::size_t{4096};
+  auto numberOfThreads = AIM::Utilities::ThreadPool::getInstance().getNumberOfThreads();
+  auto numberOfChunks = std::clamp(size / minimumChunkSize, std::size_t{1}, numberOfThreads);
+  auto chunkSize = (size + numberOfChunks - 1) / numberOfChunks;
+
+  auto chunks = std::vector<FaceRangeType>{};
+  for (std::size_t chunk = 0; chunk < numberOfChunks; ++chunk)
+    chunks.emplace_back(std::min(size, chunk * chunkSize), std::min(size, (chunk + 1) * chunkSize));
+  return chunks;
+}
+
+template <int Dimensions, typename UnsignedInteger>
+auto FaceTopology<Dimensions, UnsignedInteger>::sortInParallel(std::pmr::vector<FaceRecordType>& records) -> void {
+  auto at = [&records](std::size_t index) { return records.begin() + static_cast<std::ptrdiff_t>(index); };
+
+  // each chunk is sorted on its own thread, neighbouring sorted chunks are then merged pairwise, again in parallel
+  auto chunks = splitIntoChunks(records.size());
+  forEachChunk(
+    chunks, [&at](std::size_t begin, std::size_t end) { std::sort(at(begin), at(end), compareFaceRecords); });
+
+  while (chunks.size() > 1) {
+    auto mergedChunks = std::vector<FaceRangeType>{};
+    for (std::size_t chunk = 0; chunk + 1 < chunks.size(); chunk += 2)
+      mergedChunks.emplace_back(chunks[chunk].first, chunks[chunk + 1].second);
+    AIM::Utilities::ThreadPool::getInstance().parallelFor(
+      0, chunks.size() / 2,
+      [&at, &chunks](std::size_t first, std::size_t last) {
+        for (auto pair = first; pair < last; ++pair) {
+          auto [begin, middle] = chunks[2 * pair];
+          auto end = chunks[2 * pair + 1].second;
+          std::inplace_merge(at(begin), at(middle), at(end), compareFaceRecords);
+        }
+      },
+      1);
+    if (chunks.size() % 2 == 1)
+      mergedChunks.push_back(chunks.back());
+    chunks = std::move(mergedChunks);
+  }
+}
+
+template <int Dimensions, typename UnsignedInteger>
+auto FaceTopology<Dimensions, UnsignedInteger>::collectCellFaces(const ConnectivityTableType& cells,
+  std::pmr::memory_resource *resource) const -> std::pmr::vector<FaceRecordType> {
+  // the position of the first face of each cell is known upfront, so that the records can be filled in parallel
+  auto faceOffsets = std::pmr::vector<std::size_t>(cells.size() + 1, 0, resource);
+  for (std::size_t cell = 0; cell < cells.size(); ++cell)
+    faceOffsets[cell + 1] = faceOffsets[cell] + getNumberOfFacesForCell(cells.getNumberOfVerticesForCell(cell));
+
+  auto records = std::pmr::vector<FaceRecordType>(faceOffsets.back(), resource);
+  auto &threadPool = AIM::Utilities::ThreadPool::getInstance();
+  threadPool.parallelFor(0, cells.size(), [&cells, &faceOffsets, &records](std::size_t begin, std::size_t end) {
+    for (auto cell = begin; cell < end; ++cell) {
+      auto vertices = cells[cell];
+      for (auto face = faceOffsets[cell]; face < faceOffsets[cell + 1]; ++face) {
+        auto localFace = face - faceOffsets[cell];
+        records[face] = FaceRecordType{makeFaceKey(vertices, getLocalFace(vertices.size(), localFace)),
+          static_cast<IndexType>(cell), static_cast<std::uint32_t>(localFace)};
+      }
+    }
+  });
+  return records;
+}
+template <int Dimensions, typename UnsignedInteger>
+auto FaceTopology<Dimensions, UnsignedInteger>::collectBoundaryFaces(const BoundaryFaceConnectivityType& boundaryFaces,
+  std::pmr::memory_resource *resource) const -> std::pmr::vector<std::pair<FaceKeyType, IndexType>> {
+  static constexpr std::array<std::uint8_t, 4> identity{0, 1, 2, 3};
+
+  // the arena never reuses memory of a vector that grows, so the final size is reserved upfront
+  auto numberOfBoundaryFaces = std::size_t{0};
+  for (const auto &faces : boundaryFaces)
+    numberOfBoundaryFaces += faces.size();
+  auto boundaryFaceKeys = std::pmr::vector<std::pair<FaceKeyType, IndexType>>{resource};
+  boundaryFaceKeys.reserve(numberOfBoundaryFaces);
+  for (std::size_t boundary = 0; boundary < boundaryFaces.size(); ++boundary)
+    for (const auto &face : boundaryFaces[boundary]) {
+      if (face.size() > maxVerticesPerFace_)
+        throw std::runtime_error("boundary face with " + std::to_string(face.size()) + " vertices is not supported");
+      boundaryFaceKeys.emplace_back(
+        makeFaceKey(face, LocalFaceType{identity}.first(face.size())), static_cast<IndexType>(boundary));
+    }
+  std::sort(boundaryFaceKeys.begin(), boundaryFaceKeys.end());
+  return boundaryFaceKeys;
+}
+
+template <int Dimensions, typename UnsignedInteger>
+auto FaceTopology<Dimensions, UnsignedInteger>::orderBoundaries(
+  const BoundaryConditionType& boundaryConditions, std::size_t numberOfBoundaries) -> void {
+  // boundaries of the same type keep their order in the file, unassigned boundaries sort after all supported types.
+  // Without types, the file order is used as is
+  auto order = std::vector<std::size_t>(numberOfBoundaries);
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  if (!boundaryConditions.empty()) {
+    for (const auto &[type, name] : boundaryConditions)
+      if (type < 0 || type > AIM::Enum::BoundaryCondition::Unassigned)
+        throw std::runtime_error("boundary " + name + " has unsupported boundary condition type " +
+                                 std::to_string(type));
+    std::ranges::stable_sort(order, {}, [&boundaryConditions](auto boundary) {
+      return boundaryConditions[boundary].first;
+    });
+  }
+
+  boundaryPosition_.resize(numberOfBoundaries);
+  for (std::size_t position = 0; position < order.size(); ++position)
+    boundaryPosition_[order[position]] = position;
+}
+
+template <int Dimensions, typename UnsignedInteger>
+auto FaceTopology<Dimensions, UnsignedInteger>::build(
+  const ConnectivityTableType& cells, const BoundaryFaceConnectivityType& boundaryFaces) -> void {
+  AIM_PROFILE_SCOPE("FaceTopology::build");
+  // all intermediate face lists are scratch memory of the calling thread, released together at the end of the build
+  auto scratch = AIM::Utilities::ScratchScope{};
+  auto records = collectCellFaces(cells, scratch.getResource());
+  sortInParallel(records);
+  auto boundaryFaceKeys = collectBoundaryFaces(boundaryFaces, scratch.getResource());
+
+  // after sorting, the two cells sharing an interior face are next to each other with the lower cell index first
+  auto interiorFaces = std::pmr::vector<std::tuple<IndexType, IndexType, std::uint32_t>>{scratch.getResource()};
+  auto boundaryFacesOfCells = std::pmr::vector<std::tuple<IndexType, IndexType, std::uint32_t>>{scratch.getResource()};
+  interiorFaces.reserve(records.size() / 2);
+  boundaryFacesOfCells.reserve(boundaryFaceKeys.size());
+  for (std::size_t record = 0; record < records.size();) {
+    const auto &[key, cell, localFace] = records[record];
+    auto next = record + 1;
+    while (next < records.size() && records[next].key == key)
+      ++next;
+
+    if (next - record == 2)
+      interiorFaces.emplace_back(cell, records[record + 1].cell, localFace);
+    else if (next - record == 1) {
+      auto boundaryFace = std::lower_bound(boundaryFaceKeys.begin(), boundaryFaceKeys.end(), key,
+        [](const auto &boundaryFaceKey, const auto &faceKey) { return boundaryFaceKey.first < faceKey; });
+      if (boundaryFace == boundaryFaceKeys.end() || boundaryFace->first != key)
+        throw std::runtime_error("face " + std::to_string(localFace) + " of cell " + std::to_string(cell) +
+                                 " is neither shared with another cell nor part of a boundary");
+      auto position = static_cast<IndexType>(boundaryPosition_[boundaryFace->second]);
+      boundaryFacesOfCells.emplace_back(position, cell, localFace);
+    } else
+      throw std::runtime_error("face " + std::to_string(localFace) + " of cell " + std::to_string(cell) +
+                               " is shared by " + std::to_string(next - record) + " cells, the mesh is not manifold");
+    record = next;
+  }
+
+  // interior faces are ordered by owner and neighbour, boundary faces are grouped by the position of their boundary
+  // (see orderBoundaries()) and ordered by owner
+  std::sort(interiorFaces.begin(), interiorFaces.end());
+  std::sort(boundaryFacesOfCells.begin(), boundaryFacesOfCells.end());
+
+  auto numberOfFaces = interiorFaces.size() + boundaryFacesOfCells.size();
+  owner_.reserve(numberOfFaces);
+  neighbour_.reserve(interiorFaces.size());
+  faceVertices_.reserve(numberOfFaces, numberOfFaces * maxVerticesPerFace_);
+  auto addFace = [this, &cells](IndexType owner, std::uint32_t localFace) {
+    auto vertices = cells[owner];
+    auto face = getLocalFace(vertices.size(), localFace);
+    faceVertices_.addCell(face | std::views::transform([&vertices](auto vertex) { return vertices[vertex]; }));
+    owner_.push_back(owner);
+  };
+
+  for (const auto &[owner, neighbour, localFace] : interiorFaces) {
+    addFace(owner, localFace);
+    neighbour_.push_back(neighbour);
+  }
+
+  boundaryFaceOffsets_.assign(boundaryFaces.size() + 1, static_cast<IndexType>(interiorFaces.size()));
+  for (const auto &[position, owner, localFace] : boundaryFacesOfCells) {
+    addFace(owner, localFace);
+    ++boundaryFaceOffsets_[position + 1];
+  }
+  for (std::size_t position = 1; position < boundaryFaceOffsets_.size(); ++position)
+    boundaryFaceOffsets_[position] += boundaryFaceOffsets_[position - 1] - static_cast<IndexType>(interiorFaces.size());
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+// explicit instantiation of the supported mesh dimensions and index types
+template class FaceTopology<AIM::Enum::Dimension::Two, std::uint32_t>;
+template class FaceTopology<AIM::Enum::Dimension::Two, std::uint64_t>;
+template class FaceTopology<AIM::Enum::Dimension::Three, std::uint32_t>;
+template class FaceTopology<AIM::Enum::Dimension::Three, std::uint64_t>;
+
+}  // namespace Mesh
+}  // end namespace AIM
\ No newline at end of file
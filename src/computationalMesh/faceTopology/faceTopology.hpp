@@ -0,0 +1,240 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/connectivityTable/connectivityTable.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class FaceTopology
+ * \brief Face-based (owner/neighbour) description of the mesh, as required by finite-volume flux loops
+ * \ingroup mesh
+ *
+ * The cell to vertex connectivity of the AIM::Mesh::ComputationalMesh describes each cell in isolation. Finite-volume
+ * discretisations instead loop over faces, computing the flux through each face once and adding it to the two cells
+ * sharing that face. This class builds the unique faces of the mesh from the connectivity table and stores, for each
+ * face, its vertices (in an AIM::Mesh::ConnectivityTable), its owner cell and, for interior faces, its neighbour cell.
+ * All arrays are flat, so a flux loop is a single pass over contiguous memory.
+ *
+ * Faces are ordered as follows. Interior faces come first, sorted by owner and then neighbour, where the owner is
+ * always the cell with the lower index. Boundary faces follow, grouped by the boundary they belong to (in the order of
+ * the boundaries in the CGNS file) and sorted by owner within each boundary, so that each boundary occupies a
+ * contiguous range of faces. If the boundary condition types are passed to the constructor (as done when building the
+ * face topology from the AIM::Mesh::ComputationalMesh), the boundaries are first ordered by their type (see
+ * AIM::Enum::BoundaryCondition), so that all faces of the same type occupy a contiguous range as well. The vertices of
+ * each face are ordered as in the local face definition of the owner cell (CGNS standard element numbering), i.e. the
+ * face normal points out of the owner and into the neighbour. 2D meshes use the edges of the cells as faces, 3D meshes
+ * support tetrahedra, pyramids, prisms and hexahedra.
+ *
+ * Faces are found by collecting the faces of all cells with their vertices sorted into a key, sorting all keys in
+ * parallel and pairing up identical keys. Faces without a partner are matched against the boundary faces read from the
+ * CGNS file, a std::runtime_error is thrown if a face is shared by more than two cells or if an unpaired face is not
+ * part of any boundary.
+ *
+ * \code
+ * auto mesh = AIM::Mesh::ComputationalMesh{meshReader};
+ * auto faceTopology = AIM::Mesh::FaceTopology{mesh};
+ *
+ * const auto &owner = faceTopology.getOwner();
+ * const auto &neighbour = faceTopology.getNeighbour();
+ * for (std::size_t face = 0; face < faceTopology.getNumberOfInteriorFaces(); ++face)
+ *   std::cout << "face " << face << " between cell " << owner[face] << " and " << neighbour[face] << std::endl;
+ *
+ * const auto [first, last] = faceTopology.getBoundaryFaceRange(0);
+ * for (auto face = first; face < last; ++face)
+ *   std::cout << "face " << face << " of cell " << owner[face] << " on the first boundary" << std::endl;
+ * \endcode
+ *
+ * Boundary conditions are applied per type with forEachBoundaryCondition(), which calls a function once for each type
+ * with at least one face. The faces are passed as a BoundaryFaceGroup<BoundaryCondition>, whose type is a template
+ * argument, so that the function can dispatch into a kernel specialised for that type once per range, instead of
+ * branching on the type of each face. Without boundary condition types, no groups are formed. Boundaries of type
+ * AIM::Enum::BoundaryCondition::Unassigned are ordered after all groups and are not part of any of them, so they keep
+ * their faces but are skipped by forEachBoundaryCondition().
+ *
+ * \code
+ * template <int BoundaryCondition> struct ApplyBoundaryCondition;
+ * template <> struct ApplyBoundaryCondition<AIM::Enum::BoundaryCondition::Wall> {
+ *   template <typename GroupType>
+ *   static auto apply(const GroupType &group, std::vector<double> &u) -> void {
+ *     for (const auto &cell : group.getOwner())
+ *       u[cell] = 0.0;
+ *   }
+ * };
+ * // ... specialisations for Inlet, Outlet and Symmetry
+ *
+ * faceTopology.forEachBoundaryCondition([&u](const auto &group) {
+ *   ApplyBoundaryCondition<std::remove_cvref_t<decltype(group)>::boundaryCondition>::apply(group, u);
+ * });
+ * \endcode
+ */
+
+template <int Dimensions, typename UnsignedInteger = AIM::Types::UInt>
+class FaceTopology {
+  static_assert(AIM::Types::MeshIndexType<UnsignedInteger>, "face indices must be 32-bit or 64-bit unsigned");
+  static_assert(Dimensions == AIM::Enum::Dimension::Two || Dimensions == AIM::Enum::Dimension::Three,
+    "face topology requires a 2D or 3D mesh");
+
+  /// \name Custom types used in this class
+  /// @{
+public:
+  using IndexType = UnsignedInteger;
+  using ConnectivityTableType = ConnectivityTable<IndexType>;
+  using BoundaryFaceConnectivityType = typename std::vector<ConnectivityTableType>;
+  using BoundaryConditionType = typename std::vector<std::pair<int, std::string>>;
+  using FaceRangeType = std::pair<std::size_t, std::size_t>;
+  using BoundaryConditionsType = std::integer_sequence<int, AIM::Enum::BoundaryCondition::Wall,
+    AIM::Enum::BoundaryCondition::Inlet, AIM::Enum::BoundaryCondition::Outlet, AIM::Enum::BoundaryCondition::Symmetry>;
+  template <int BoundaryCondition>
+  class BoundaryFaceGroup;
+
+private:
+  static constexpr auto numberOfBoundaryConditions_ =
+    static_cast<std::size_t>(AIM::Enum::BoundaryCondition::Symmetry) + 1;
+  static constexpr std::size_t maxVerticesPerFace_{Dimensions == AIM::Enum::Dimension::Two ? 2 : 4};
+  using FaceKeyType = std::array<IndexType, maxVerticesPerFace_>;
+  using LocalFaceType = std::span<const std::uint8_t>;
+
+  struct FaceRecordType {
+    FaceKeyType key;
+    IndexType cell;
+    std::uint32_t localFace;
+  };
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  FaceTopology(const ConnectivityTableType& cells, const BoundaryFaceConnectivityType& boundaryFaces);
+  FaceTopology(const ConnectivityTableType& cells, const BoundaryFaceConnectivityType& boundaryFaces,
+    const BoundaryConditionType& boundaryConditions);
+  template <typename FloatingPoint>
+  FaceTopology(const ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>& mesh);
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  template <typename Function>
+  auto forEachBoundaryCondition(Function&& function) const -> void;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getNumberOfFaces() const -> std::size_t { return owner_.size(); }
+  auto getNumberOfInteriorFaces() const -> std::size_t { return neighbour_.size(); }
+  auto getNumberOfBoundaryFaces() const -> std::size_t { return owner_.size() - neighbour_.size(); }
+  auto getNumberOfBoundaries() const -> std::size_t { return boundaryFaceOffsets_.size() - 1; }
+  auto getFaceVertices() const -> const ConnectivityTableType& { return faceVertices_; }
+  auto getOwner() const -> std::span<const IndexType> { return owner_; }
+  auto getNeighbour() const -> std::span<const IndexType> { return neighbour_; }
+  auto getBoundaryFaceOffsets() const -> std::span<const IndexType> { return boundaryFaceOffsets_; }
+  auto getBoundaryFaceRange(std::size_t boundary) const -> FaceRangeType {
+    auto position = boundaryPosition_[boundary];
+    return {boundaryFaceOffsets_[position], boundaryFaceOffsets_[position + 1]};
+  }
+  auto getBoundaryConditionFaceRange(int boundaryCondition) const -> FaceRangeType {
+    auto index = static_cast<std::size_t>(boundaryCondition);
+    return {boundaryConditionFaceOffsets_[index], boundaryConditionFaceOffsets_[index + 1]};
+  }
+  template <int BoundaryCondition>
+  auto getBoundaryFaceGroup() const -> BoundaryFaceGroup<BoundaryCondition>;
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  static auto getNumberOfFacesForCell(std::size_t numberOfVerticesPerCell) -> std::size_t;
+  static auto getLocalFace(std::size_t numberOfVerticesPerCell, std::size_t face) -> LocalFaceType;
+  static auto makeFaceKey(std::span<const IndexType> cell, LocalFaceType localFace) -> FaceKeyType;
+  static auto compareFaceRecords(const FaceRecordType& lhs, const FaceRecordType& rhs) -> bool;
+  static auto splitIntoChunks(std::size_t size) -> std::vector<FaceRangeType>;
+  template <typename ChunkFunction>
+  static auto forEachChunk(const std::vector<FaceRangeType>& chunks, ChunkFunction&& function) -> void;
+  static auto sortInParallel(std::pmr::vector<FaceRecordType>& records) -> void;
+  auto collectCellFaces(const ConnectivityTableType& cells, std::pmr::memory_resource *resource) const
+    -> std::pmr::vector<FaceRecordType>;
+  auto collectBoundaryFaces(const BoundaryFaceConnectivityType& boundaryFaces,
+    std::pmr::memory_resource *resource) const -> std::pmr::vector<std::pair<FaceKeyType, IndexType>>;
+  auto orderBoundaries(const BoundaryConditionType& boundaryConditions, std::size_t numberOfBoundaries) -> void;
+  auto build(const ConnectivityTableType& cells, const BoundaryFaceConnectivityType& boundaryFaces) -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  ConnectivityTableType faceVertices_;
+  std::vector<IndexType> owner_;
+  std::vector<IndexType> neighbour_;
+  std::vector<IndexType> boundaryFaceOffsets_{0};
+  std::vector<std::size_t> boundaryPosition_;
+  std::array<IndexType, numberOfBoundaryConditions_ + 1> boundaryConditionFaceOffsets_{};
+  /// @}
+};
+
+/**
+ * \class FaceTopology::BoundaryFaceGroup
+ * \brief View over the contiguous range of boundary faces of a single boundary condition type
+ * \ingroup mesh
+ */
+
+template <int Dimensions, typename UnsignedInteger>
+template <int BoundaryCondition>
+class FaceTopology<Dimensions, UnsignedInteger>::BoundaryFaceGroup {
+public:
+  static constexpr auto boundaryCondition = BoundaryCondition;
+
+public:
+  BoundaryFaceGroup(std::size_t firstFace, std::span<const IndexType> owner) : firstFace_(firstFace), owner_(owner) {}
+
+public:
+  auto getFirstFace() const -> std::size_t { return firstFace_; }
+  auto getFaceRange() const -> FaceRangeType { return {firstFace_, firstFace_ + owner_.size()}; }
+  auto getOwner() const -> std::span<const IndexType> { return owner_; }
+  auto size() const -> std::size_t { return owner_.size(); }
+  auto empty() const -> bool { return owner_.empty(); }
+
+private:
+  std::size_t firstFace_{0};
+  std::span<const IndexType> owner_;
+};
+
+/// \name Deduction guide, so that the dimension and index type are taken from the computational mesh
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+FaceTopology(const ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>&)
+  -> FaceTopology<Dimensions, UnsignedInteger>;
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "faceTopology.tpp"
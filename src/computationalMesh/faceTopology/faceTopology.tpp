@@ -0,0 +1,85 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/utilities/threadPool/threadPool.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+template <typename FloatingPoint>
+FaceTopology<Dimensions, UnsignedInteger>::FaceTopology(
+  const ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>& mesh)
+  : FaceTopology(
+      mesh.getConnectivityTable(), mesh.getBoundaryFaceConnectivity(), mesh.getBoundaryConditionInfo()) {}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+template <typename Function>
+auto FaceTopology<Dimensions, UnsignedInteger>::forEachBoundaryCondition(Function&& function) const -> void {
+  auto visitGroup = [this, &function]<int BoundaryCondition>(std::integral_constant<int, BoundaryCondition>) {
+    auto group = getBoundaryFaceGroup<BoundaryCondition>();
+    if (!group.empty())
+      function(group);
+  };
+  [&visitGroup]<int... BoundaryCondition>(std::integer_sequence<int, BoundaryCondition...>) {
+    (visitGroup(std::integral_constant<int, BoundaryCondition>{}), ...);
+  }(BoundaryConditionsType{});
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+template <int BoundaryCondition>
+auto FaceTopology<Dimensions, UnsignedInteger>::getBoundaryFaceGroup() const -> BoundaryFaceGroup<BoundaryCondition> {
+  static_assert(BoundaryCondition >= 0 && static_cast<std::size_t>(BoundaryCondition) < numberOfBoundaryConditions_,
+    "unknown boundary condition type");
+  const auto [first, last] = getBoundaryConditionFaceRange(BoundaryCondition);
+  return BoundaryFaceGroup<BoundaryCondition>{first, std::span<const IndexType>{owner_}.subspan(first, last - first)};
+}
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+template <typename ChunkFunction>
+auto FaceTopology<Dimensions, UnsignedInteger>::forEachChunk(
+  const std::vector<FaceRangeType>& chunks, ChunkFunction&& function) -> void {
+  // each chunk is a task of its own, exceptions thrown on any of the worker threads are rethrown here
+  AIM::Utilities::ThreadPool::getInstance().parallelFor(
+    0, chunks.size(),
+    [&chunks, &function](std::size_t first, std::size_t last) {
+      for (auto chunk = first; chunk < last; ++chunk)
+        function(chunks[chunk].first, chunks[chunk].second);
+    },
+    1);
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
@@ -0,0 +1,169 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <ios>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+// third-party include headers
+#include "hdf5.h"
+
+// AIM include headers
+#include "src/computationalMesh/hdf5BulkReading/hdf5BulkReading.hpp"
+#include "src/utilities/memoryMappedFile/memoryMappedFile.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+HDF5BulkReader::HDF5BulkReader(const std::filesystem::path& file) : file_(file), mappedFile_(file) {}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+auto HDF5BulkReader::isHDF5File(const std::filesystem::path& file) -> bool {
+  // the HDF5 superblock starts with a fixed signature at byte 0, 512, 1024, 2048, ... of the file. ADF files start
+  // with a plain text header instead
+  constexpr auto signature = std::array<char, 8>{'\x89', 'H', 'D', 'F', '\r', '\n', '\x1a', '\n'};
+  if (!std::filesystem::is_regular_file(file))
+    return false;
+  auto fileSize = std::filesystem::file_size(file);
+  auto rawFile = std::ifstream(file, std::ios::binary);
+  auto header = std::array<char, 8>{};
+  for (std::uintmax_t offset = 0; offset + signature.size() <= fileSize; offset = offset == 0 ? 512 : offset * 2) {
+    rawFile.seekg(static_cast<std::streamoff>(offset));
+    if (!rawFile.read(header.data(), static_cast<std::streamsize>(header.size())))
+      return false;
+    if (header == signature)
+      return true;
+  }
+  return false;
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+auto HDF5BulkReader::openDataset(hid_t file, const std::string& nodePath) const -> hid_t {
+  // the data of a CGNS node is stored in the dataset " data" of the node's group. Missing nodes are reported by the
+  // caller, the HDF5 error stack is silenced while checking for them
+  auto datasetPath = nodePath + "/ data";
+  auto dataset = hid_t{-1};
+  H5E_BEGIN_TRY { dataset = H5Dopen2(file, datasetPath.c_str(), H5P_DEFAULT); }
+  H5E_END_TRY;
+  return dataset;
+}
+
+auto HDF5BulkReader::getNumberOfEntries(hid_t dataset) const -> std::size_t {
+  if (dataset < 0)
+    return 0;
+  auto dataspace = H5Dget_space(dataset);
+  auto numberOfEntries = H5Sget_simple_extent_npoints(dataspace);
+  H5Sclose(dataspace);
+  return numberOfEntries > 0 ? static_cast<std::size_t>(numberOfEntries) : 0;
+}
+
+auto HDF5BulkReader::getRawBlocks(hid_t dataset, std::size_t numberOfEntries, std::size_t entrySize) const
+  -> std::vector<BlockType> {
+  auto blocks = std::vector<BlockType>{};
+  auto creationProperties = H5Dget_create_plist(dataset);
+  auto layout = H5Pget_layout(creationProperties);
+  auto dataspace = H5Dget_space(dataset);
+  auto isOneDimensional = H5Sget_simple_extent_ndims(dataspace) == 1;
+
+  if (isOneDimensional && layout == H5D_CONTIGUOUS) {
+    // contiguous data is split into blocks of equal size
+    auto address = H5Dget_offset(dataset);
+    auto entriesPerBlock = std::max(std::size_t{1}, blockSizeInBytes_ / entrySize);
+    if (address != HADDR_UNDEF)
+      for (std::size_t entry = 0; entry < numberOfEntries; entry += entriesPerBlock)
+        blocks.push_back({static_cast<std::size_t>(address) + entry * entrySize, entry,
+          std::min(entriesPerBlock, numberOfEntries - entry)});
+  } else if (isOneDimensional && layout == H5D_CHUNKED && H5Pget_nfilters(creationProperties) == 0) {
+    // unfiltered chunks are stored as is, each chunk becomes one block. Chunks at the end of the dataset may extend
+    // beyond it and are cut to the size of the dataset
+    hsize_t chunkSize[1]{};
+    H5Pget_chunk(creationProperties, 1, chunkSize);
+    hsize_t numberOfChunks{0};
+    H5Dget_num_chunks(dataset, dataspace, &numberOfChunks);
+    auto numberOfStoredEntries = std::size_t{0};
+    for (hsize_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+      hsize_t chunkOffset[1]{};
+      unsigned filterMask{0};
+      haddr_t address{HADDR_UNDEF};
+      hsize_t storageSize{0};
+      H5Dget_chunk_info(dataset, dataspace, chunk, chunkOffset, &filterMask, &address, &storageSize);
+      if (address == HADDR_UNDEF || chunkOffset[0] >= numberOfEntries)
+        continue;
+      auto firstEntry = static_cast<std::size_t>(chunkOffset[0]);
+      auto entries = std::min(static_cast<std::size_t>(chunkSize[0]), numberOfEntries - firstEntry);
+      blocks.push_back({static_cast<std::size_t>(address), firstEntry, entries});
+      numberOfStoredEntries += entries;
+    }
+
+    // chunks that were never written hold the fill value, which only H5Dread() knows about
+    if (numberOfStoredEntries != numberOfEntries)
+      blocks.clear();
+  }
+  H5Sclose(dataspace);
+  H5Pclose(creationProperties);
+
+  // the mapped file must contain all blocks, otherwise the data is read through HDF5
+  auto isInsideFile = [this, entrySize](const BlockType &block) {
+    return block.fileOffset + block.numberOfEntries * entrySize <= mappedFile_.size();
+  };
+  if (!std::ranges::all_of(blocks, isInsideFile))
+    blocks.clear();
+  return blocks;
+}
+
+auto HDF5BulkReader::copyBlocksConcurrently(const std::vector<BlockType>& blocks, std::size_t entrySize,
+  std::byte* buffer) const -> void {
+  // blocks are distributed round-robin over the threads, the first share is copied on the calling thread
+  auto numberOfThreads =
+    std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), std::max<std::size_t>(blocks.size(), 1));
+  auto copyBlocks = [this, &blocks, entrySize, buffer, numberOfThreads](std::size_t thread) {
+    auto data = mappedFile_.getData();
+    for (auto block = thread; block < blocks.size(); block += numberOfThreads)
+      std::memcpy(buffer + blocks[block].firstEntry * entrySize, data.data() + blocks[block].fileOffset,
+        blocks[block].numberOfEntries * entrySize);
+  };
+
+  auto workers = std::vector<std::future<void>>{};
+  for (std::size_t thread = 1; thread < numberOfThreads; ++thread)
+    workers.push_back(std::async(std::launch::async, copyBlocks, thread));
+  copyBlocks(0);
+  for (auto &worker : workers)
+    worker.get();
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
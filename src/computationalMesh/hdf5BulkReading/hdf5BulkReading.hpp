@@ -0,0 +1,118 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+// third-party include headers
+#include "hdf5.h"
+
+// AIM include headers
+#include "src/utilities/memoryMappedFile/memoryMappedFile.hpp"
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class HDF5BulkReader
+ * \brief Reads large data arrays of an HDF5-based CGNS file directly, bypassing the CGNS mid-level library
+ * \ingroup mesh
+ *
+ * CGNS files written with the HDF5 backend store each data array (e.g. GridCoordinates/CoordinateX or
+ * ElementConnectivity) as a one-dimensional HDF5 dataset named " data" below the group of its CGNS node. The CGNS
+ * mid-level library reads these arrays through several layers, each of which may convert or copy the data. For large
+ * meshes, this class reads the datasets directly into a caller-provided, preallocated buffer instead.
+ *
+ * The HDF5 library is only used to look up the location of the data in the file. If the dataset is stored contiguously
+ * or in unfiltered (uncompressed) chunks, and its type in the file matches the type of the buffer, the data is copied
+ * straight from a memory mapping of the file. The copy is split into blocks (the HDF5 chunks, or blocks of
+ * blockSizeInBytes for contiguous datasets), which are copied concurrently on up to std::thread::hardware_concurrency()
+ * threads. All other datasets (compact, compressed, or requiring a type conversion) are read with a single H5Dread()
+ * call, which still avoids the intermediate copies of the CGNS library.
+ *
+ * The HDF5 library is not guaranteed to be thread-safe, and CGNS uses it internally. readNode() therefore holds
+ * AIM::Mesh::CGNSFileHandle::getLibraryMutex() while it calls into HDF5 and releases it before the blocks are copied,
+ * so that the copy overlaps with CGNS calls of other threads. The caller must not hold the mutex when calling
+ * readNode(). Files written with the ADF backend are not HDF5 files, which can be checked with isHDF5File() before
+ * constructing the reader.
+ *
+ * \code
+ * if (AIM::Mesh::HDF5BulkReader::isHDF5File(meshFile)) {
+ *   auto reader = AIM::Mesh::HDF5BulkReader{meshFile};
+ *   auto x = std::vector<double>(numberOfVertices);
+ *   reader.readNode("/Base/Zone/GridCoordinates/CoordinateX", std::span{x});
+ * }
+ * \endcode
+ */
+
+class HDF5BulkReader {
+  /// \name Custom types used in this class
+  /// @{
+private:
+  struct BlockType {
+    std::size_t fileOffset{0};
+    std::size_t firstEntry{0};
+    std::size_t numberOfEntries{0};
+  };
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  HDF5BulkReader(const std::filesystem::path& file);
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  static auto isHDF5File(const std::filesystem::path& file) -> bool;
+  template <typename Type>
+  auto readNode(const std::string& nodePath, std::span<Type> buffer) const -> void;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getFile() const -> const std::filesystem::path& { return file_; }
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  template <typename Type>
+  static auto getNativeType() -> hid_t;
+  auto openDataset(hid_t file, const std::string& nodePath) const -> hid_t;
+  auto getNumberOfEntries(hid_t dataset) const -> std::size_t;
+  auto getRawBlocks(hid_t dataset, std::size_t numberOfEntries, std::size_t entrySize) const -> std::vector<BlockType>;
+  auto copyBlocksConcurrently(const std::vector<BlockType>& blocks, std::size_t entrySize, std::byte* buffer) const
+    -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  static constexpr std::size_t blockSizeInBytes_{4 * 1024 * 1024};
+
+  std::filesystem::path file_;
+  AIM::Utilities::MemoryMappedFile mappedFile_;
+  /// @}
+};
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "hdf5BulkReading.tpp"
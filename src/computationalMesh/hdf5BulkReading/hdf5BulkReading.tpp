@@ -0,0 +1,106 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// third-party include headers
+#include "hdf5.h"
+
+// AIM include headers
+#include "src/computationalMesh/cgnsFileHandle/cgnsFileHandle.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <typename Type>
+auto HDF5BulkReader::readNode(const std::string& nodePath, std::span<Type> buffer) const -> void {
+  auto blocks = std::vector<BlockType>{};
+  {
+    auto lock = std::scoped_lock{CGNSFileHandle::getLibraryMutex()};
+    auto file = H5Fopen(file_.string().c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (file < 0)
+      throw std::runtime_error("can't open " + file_.string() + " as HDF5 file");
+
+    auto dataset = openDataset(file, nodePath);
+    auto numberOfEntries = getNumberOfEntries(dataset);
+    if (dataset < 0 || numberOfEntries != buffer.size()) {
+      if (dataset >= 0)
+        H5Dclose(dataset);
+      H5Fclose(file);
+      throw std::runtime_error("node " + nodePath + " of " + file_.string() + " does not exist or does not hold " +
+                               std::to_string(buffer.size()) + " entries");
+    }
+
+    // only data stored in the file with the exact same (native) type can be copied without conversion
+    auto fileType = H5Dget_type(dataset);
+    auto isRawCopy = H5Tequal(fileType, getNativeType<Type>()) > 0;
+    H5Tclose(fileType);
+    blocks = isRawCopy ? getRawBlocks(dataset, numberOfEntries, sizeof(Type)) : std::vector<BlockType>{};
+    auto errorCode = herr_t{0};
+    if (blocks.empty() && numberOfEntries > 0)
+      errorCode = H5Dread(dataset, getNativeType<Type>(), H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data());
+    H5Dclose(dataset);
+    H5Fclose(file);
+    if (errorCode < 0)
+      throw std::runtime_error("can't read node " + nodePath + " of " + file_.string());
+  }
+
+  // the blocks are copied from the memory mapping without calling into HDF5, so other threads can use the library
+  copyBlocksConcurrently(blocks, sizeof(Type), reinterpret_cast<std::byte *>(buffer.data()));
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <typename Type>
+auto HDF5BulkReader::getNativeType() -> hid_t {
+  if constexpr (std::is_same_v<Type, float>)
+    return H5T_NATIVE_FLOAT;
+  else if constexpr (std::is_same_v<Type, double>)
+    return H5T_NATIVE_DOUBLE;
+  else if constexpr (std::is_same_v<Type, std::int32_t>)
+    return H5T_NATIVE_INT32;
+  else if constexpr (std::is_same_v<Type, std::int64_t>)
+    return H5T_NATIVE_INT64;
+  else if constexpr (std::is_same_v<Type, std::uint32_t>)
+    return H5T_NATIVE_UINT32;
+  else {
+    static_assert(std::is_same_v<Type, std::uint64_t>, "unsupported type for reading HDF5 datasets");
+    return H5T_NATIVE_UINT64;
+  }
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
@@ -0,0 +1,174 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/inverseConnectivity/inverseConnectivity.hpp"
+#include "src/types/enums.hpp"
+#include "src/utilities/threadPool/threadPool.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+InverseConnectivity<Dimensions, UnsignedInteger>::InverseConnectivity(
+  const ConnectivityTableType& cells, std::size_t numberOfVertices) {
+  buildVertexToCell(cells, numberOfVertices);
+  buildCellToCell(cells);
+}
+
+template <int Dimensions, typename UnsignedInteger>
+InverseConnectivity<Dimensions, UnsignedInteger>::InverseConnectivity(const ConnectivityTableType& cells)
+  : InverseConnectivity(cells, getNumberOfVertices(cells)) {}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+auto InverseConnectivity<Dimensions, UnsignedInteger>::getNumberOfVertices(
+  const ConnectivityTableType& cells) -> std::size_t {
+  auto indices = cells.getIndices();
+  return indices.empty() ? std::size_t{0} : static_cast<std::size_t>(std::ranges::max(indices)) + 1;
+}
+
+template <int Dimensions, typename UnsignedInteger>
+auto InverseConnectivity<Dimensions, UnsignedInteger>::prefixSum(std::vector<IndexType>& offsets) -> void {
+  // each chunk is scanned on its own, the totals of all preceding chunks are then added to it in a second pass. The
+  // thread pool always passes whole chunks of the grain size, so the chunk follows from the first index
+  auto &threadPool = AIM::Utilities::ThreadPool::getInstance();
+  auto grainSize =
+    AIM::Utilities::ThreadPool::getGrainSize(offsets.size(), AIM::Utilities::ThreadPool::automaticGrainSize);
+  auto at = [&offsets](std::size_t index) { return offsets.begin() + static_cast<std::ptrdiff_t>(index); };
+  threadPool.parallelFor(
+    0, offsets.size(),
+    [&at](std::size_t begin, std::size_t end) { std::inclusive_scan(at(begin), at(end), at(begin)); }, grainSize);
+
+  auto chunkOffsets = std::vector<IndexType>((offsets.size() + grainSize - 1) / grainSize, 0);
+  for (std::size_t chunk = 1; chunk < chunkOffsets.size(); ++chunk)
+    chunkOffsets[chunk] = chunkOffsets[chunk - 1] + offsets[chunk * grainSize - 1];
+  threadPool.parallelFor(
+    0, offsets.size(),
+    [&offsets, &chunkOffsets, grainSize](std::size_t begin, std::size_t end) {
+      for (auto index = begin; index < end; ++index)
+        offsets[index] += chunkOffsets[begin / grainSize];
+    },
+    grainSize);
+}
+
+template <int Dimensions, typename UnsignedInteger>
+auto InverseConnectivity<Dimensions, UnsignedInteger>::buildVertexToCell(
+  const ConnectivityTableType& cells, std::size_t numberOfVertices) -> void {
+  // first pass: count the cells of each vertex, shifted by one so that the prefix sum produces the row offsets
+  auto offsets = std::vector<IndexType>(numberOfVertices + 1, 0);
+  forEachChunk(cells.size(), [&cells, &offsets](std::size_t begin, std::size_t end) {
+    for (auto cell = begin; cell < end; ++cell)
+      for (const auto &vertex : cells[cell])
+        std::atomic_ref<IndexType>{offsets[vertex + 1]}.fetch_add(1, std::memory_order_relaxed);
+  });
+  prefixSum(offsets);
+
+  // second pass: each cell claims a slot in the rows of its vertices through an atomic cursor per row
+  auto indices = std::vector<IndexType>(offsets.back());
+  auto cursor = std::vector<IndexType>(offsets.begin(), offsets.end() - 1);
+  forEachChunk(cells.size(), [&cells, &indices, &cursor](std::size_t begin, std::size_t end) {
+    for (auto cell = begin; cell < end; ++cell)
+      for (const auto &vertex : cells[cell])
+        indices[std::atomic_ref<IndexType>{cursor[vertex]}.fetch_add(1, std::memory_order_relaxed)] =
+          static_cast<IndexType>(cell);
+  });
+
+  // the order within a row depends on the thread schedule, sorting the (short) rows makes the table deterministic
+  auto at = [&indices](IndexType index) { return indices.begin() + static_cast<std::ptrdiff_t>(index); };
+  forEachChunk(numberOfVertices, [&offsets, &at](std::size_t begin, std::size_t end) {
+    for (auto vertex = begin; vertex < end; ++vertex)
+      std::sort(at(offsets[vertex]), at(offsets[vertex + 1]));
+  });
+  vertexToCell_ = ConnectivityTableType{std::move(offsets), std::move(indices)};
+}
+
+template <int Dimensions, typename UnsignedInteger>
+auto InverseConnectivity<Dimensions, UnsignedInteger>::buildCellToCell(const ConnectivityTableType& cells) -> void {
+  // two cells share a face if they have at least as many vertices in common as the smallest face has
+  constexpr auto sharedVerticesPerFace = std::size_t{Dimensions == AIM::Enum::Dimension::Two ? 2u : 3u};
+
+  // collects the cells sharing a vertex with the given cell in sorted order, a face neighbour appears once per shared
+  // vertex, so it is found as a run of sufficient length. Both passes below call this, the first to count, the second
+  // to fill, which avoids storing the candidates of all cells in between
+  auto forEachFaceNeighbour = [this, &cells](std::size_t cell, std::vector<IndexType>& candidates, auto&& function) {
+    candidates.clear();
+    for (const auto &vertex : cells[cell])
+      for (const auto &otherCell : vertexToCell_[vertex])
+        if (otherCell != cell)
+          candidates.push_back(otherCell);
+    std::ranges::sort(candidates);
+
+    for (std::size_t first = 0, last = 0; first < candidates.size(); first = last) {
+      while (last < candidates.size() && candidates[last] == candidates[first])
+        ++last;
+      if (last - first >= sharedVerticesPerFace)
+        function(candidates[first]);
+    }
+  };
+
+  auto offsets = std::vector<IndexType>(cells.size() + 1, 0);
+  forEachChunk(cells.size(), [&forEachFaceNeighbour, &offsets](std::size_t begin, std::size_t end) {
+    auto candidates = std::vector<IndexType>{};
+    for (auto cell = begin; cell < end; ++cell)
+      forEachFaceNeighbour(cell, candidates, [&offsets, cell](IndexType) { ++offsets[cell + 1]; });
+  });
+  prefixSum(offsets);
+
+  auto indices = std::vector<IndexType>(offsets.back());
+  forEachChunk(cells.size(), [&forEachFaceNeighbour, &offsets, &indices](std::size_t begin, std::size_t end) {
+    auto candidates = std::vector<IndexType>{};
+    for (auto cell = begin; cell < end; ++cell) {
+      auto position = offsets[cell];
+      forEachFaceNeighbour(cell, candidates, [&indices, &position](IndexType neighbour) {
+        indices[position++] = neighbour;
+      });
+    }
+  });
+  cellToCell_ = ConnectivityTableType{std::move(offsets), std::move(indices)};
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+// explicit instantiation of the supported mesh dimensions and index types
+template class InverseConnectivity<AIM::Enum::Dimension::Two, std::uint32_t>;
+template class InverseConnectivity<AIM::Enum::Dimension::Two, std::uint64_t>;
+template class InverseConnectivity<AIM::Enum::Dimension::Three, std::uint32_t>;
+template class InverseConnectivity<AIM::Enum::Dimension::Three, std::uint64_t>;
+
+}  // namespace Mesh
+}  // end namespace AIM
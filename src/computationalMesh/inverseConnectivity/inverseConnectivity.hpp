@@ -0,0 +1,124 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/connectivityTable/connectivityTable.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class InverseConnectivity
+ * \brief Vertex to cell and cell to cell (face neighbour) adjacency, built from the cell to vertex connectivity
+ * \ingroup mesh
+ *
+ * The connectivity table of the mesh lists the vertices of each cell. Gradient reconstruction, averaging cell values
+ * onto vertices and graph based algorithms such as partitioning need the reverse direction instead. This class builds
+ * two tables, both stored as AIM::Mesh::ConnectivityTable (compressed sparse row) with each row sorted in ascending
+ * order:
+ *
+ * - getVertexToCell()[vertex] lists all cells that contain the vertex.
+ * - getCellToCell()[cell] lists all cells that share a face with the cell, i.e. at least 2 vertices in 2D and at least
+ *   3 vertices in 3D. Cells that only share an edge or a vertex are not included.
+ *
+ * Both tables are built with a parallel two-pass scheme instead of appending entries one by one: the entries per row
+ * are counted first (with atomic increments for the vertex to cell table, as cells processed on different threads
+ * share vertices), the counts are turned into row offsets by a parallel prefix sum, and the rows are then filled in
+ * parallel, each thread writing into preallocated, disjoint slots. The work per thread is proportional to the number
+ * of cells it processes, so the build time scales with the number of cores.
+ *
+ * \code
+ * auto inverseConnectivity = AIM::Mesh::InverseConnectivity{mesh};
+ *
+ * // average cell values onto vertices
+ * const auto &vertexToCell = inverseConnectivity.getVertexToCell();
+ * for (std::size_t vertex = 0; vertex < vertexToCell.size(); ++vertex) {
+ *   for (const auto &cell : vertexToCell[vertex])
+ *     vertexValue[vertex] += cellValue[cell];
+ *   vertexValue[vertex] /= vertexToCell[vertex].size();
+ * }
+ * \endcode
+ */
+
+template <int Dimensions, typename UnsignedInteger = AIM::Types::UInt>
+class InverseConnectivity {
+  static_assert(AIM::Types::MeshIndexType<UnsignedInteger>, "mesh indices must be 32-bit or 64-bit unsigned");
+
+  /// \name Custom types used in this class
+  /// @{
+public:
+  using IndexType = UnsignedInteger;
+  using ConnectivityTableType = ConnectivityTable<IndexType>;
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  InverseConnectivity(const ConnectivityTableType& cells, std::size_t numberOfVertices);
+  InverseConnectivity(const ConnectivityTableType& cells);
+  template <typename FloatingPoint>
+  InverseConnectivity(const ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>& mesh);
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getVertexToCell() const -> const ConnectivityTableType& { return vertexToCell_; }
+  auto getCellToCell() const -> const ConnectivityTableType& { return cellToCell_; }
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  static auto getNumberOfVertices(const ConnectivityTableType& cells) -> std::size_t;
+  template <typename ChunkFunction>
+  static auto forEachChunk(std::size_t size, ChunkFunction&& function) -> void;
+  static auto prefixSum(std::vector<IndexType>& offsets) -> void;
+  auto buildVertexToCell(const ConnectivityTableType& cells, std::size_t numberOfVertices) -> void;
+  auto buildCellToCell(const ConnectivityTableType& cells) -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  ConnectivityTableType vertexToCell_;
+  ConnectivityTableType cellToCell_;
+  /// @}
+};
+
+/// \name Deduction guide, so that the dimension and index type are taken from the computational mesh
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+InverseConnectivity(const ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>&)
+  -> InverseConnectivity<Dimensions, UnsignedInteger>;
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "inverseConnectivity.tpp"
@@ -0,0 +1,57 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cstddef>
+#include <utility>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/utilities/threadPool/threadPool.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+template <typename FloatingPoint>
+InverseConnectivity<Dimensions, UnsignedInteger>::InverseConnectivity(
+  const ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>& mesh)
+  : InverseConnectivity(mesh.getConnectivityTable(), mesh.getCoordinateX().size()) {}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger>
+template <typename ChunkFunction>
+auto InverseConnectivity<Dimensions, UnsignedInteger>::forEachChunk(
+  std::size_t size, ChunkFunction&& function) -> void {
+  AIM::Utilities::ThreadPool::getInstance().parallelFor(0, size, std::forward<ChunkFunction>(function));
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
@@ -0,0 +1,114 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class MeshArray
+ * \brief One dimensional array that either owns its data or provides a read-only view into memory owned elsewhere
+ * \ingroup mesh
+ *
+ * Mesh data is either read from a mesh file, in which case it is owned by the mesh, or it is mapped from a binary mesh
+ * cache, in which case it lives in a memory mapped file and must not be copied. This class provides a uniform
+ * interface for both cases. An owning array stores its data in a std::vector, a non-owning array only stores a
+ * std::span. Copying an owning array copies the data, copying a non-owning array only copies the view, so the caller
+ * is responsible to keep the referenced memory alive for as long as the view is used. Only owning arrays can be
+ * modified.
+ *
+ * \code
+ * // owning array
+ * auto owning = AIM::Mesh::MeshArray<double>{std::vector<double>{1.0, 2.0, 3.0}};
+ * owning.push_back(4.0);
+ *
+ * // non-owning array, referencing memory owned by someone else
+ * auto buffer = std::vector<double>{1.0, 2.0, 3.0};
+ * auto view = AIM::Mesh::MeshArray<double>{std::span<const double>{buffer}};
+ *
+ * // both can be used in the same way
+ * for (const auto &value : view)
+ *   std::cout << value << std::endl;
+ * \endcode
+ */
+
+template <typename ValueType>
+class MeshArray {
+  /// \name Custom types used in this class
+  /// @{
+public:
+  using ViewType = std::span<const ValueType>;
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  MeshArray() = default;
+  MeshArray(std::vector<ValueType> data);
+  MeshArray(ViewType view);
+  MeshArray(const MeshArray& other);
+  MeshArray(MeshArray&& other) noexcept;
+  ~MeshArray() = default;
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  auto reserve(std::size_t size) -> void;
+  auto resize(std::size_t size) -> void;
+  auto push_back(const ValueType& value) -> void;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto isOwning() const -> bool { return owning_; }
+  auto view() const -> ViewType { return view_; }
+  auto size() const -> std::size_t { return view_.size(); }
+  auto empty() const -> bool { return view_.empty(); }
+  auto data() const -> const ValueType* { return view_.data(); }
+  auto begin() const { return view_.begin(); }
+  auto end() const { return view_.end(); }
+  auto getMutableData() -> std::span<ValueType>;
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const MeshArray& other) -> MeshArray&;
+  auto operator=(MeshArray&& other) noexcept -> MeshArray&;
+  auto operator[](std::size_t index) const -> const ValueType& { return view_[index]; }
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  auto bindView() -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  std::vector<ValueType> data_;
+  ViewType view_;
+  bool owning_{true};
+  /// @}
+};
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "meshArray.tpp"
@@ -0,0 +1,114 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cassert>
+#include <utility>
+
+// third-party include headers
+
+// AIM include headers
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+template <typename ValueType>
+MeshArray<ValueType>::MeshArray(std::vector<ValueType> data) : data_(std::move(data)), owning_(true) {
+  bindView();
+}
+
+template <typename ValueType>
+MeshArray<ValueType>::MeshArray(ViewType view) : view_(view), owning_(false) {}
+
+template <typename ValueType>
+MeshArray<ValueType>::MeshArray(const MeshArray& other)
+  : data_(other.data_), view_(other.view_), owning_(other.owning_) {
+  bindView();
+}
+
+template <typename ValueType>
+MeshArray<ValueType>::MeshArray(MeshArray&& other) noexcept
+  : data_(std::move(other.data_)), view_(other.view_), owning_(other.owning_) {
+  bindView();
+  other.bindView();
+}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <typename ValueType>
+auto MeshArray<ValueType>::reserve(std::size_t size) -> void {
+  assert(owning_ && "only owning mesh arrays can be modified");
+  data_.reserve(size);
+  bindView();
+}
+
+template <typename ValueType>
+auto MeshArray<ValueType>::resize(std::size_t size) -> void {
+  assert(owning_ && "only owning mesh arrays can be modified");
+  data_.resize(size);
+  bindView();
+}
+
+template <typename ValueType>
+auto MeshArray<ValueType>::push_back(const ValueType& value) -> void {
+  assert(owning_ && "only owning mesh arrays can be modified");
+  data_.push_back(value);
+  bindView();
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+template <typename ValueType>
+auto MeshArray<ValueType>::getMutableData() -> std::span<ValueType> {
+  assert(owning_ && "only owning mesh arrays can be modified");
+  return std::span<ValueType>{data_};
+}
+/// @}
+
+/// \name Overloaded operators
+/// @{
+template <typename ValueType>
+auto MeshArray<ValueType>::operator=(const MeshArray& other) -> MeshArray& {
+  if (this != &other) {
+    data_ = other.data_;
+    view_ = other.view_;
+    owning_ = other.owning_;
+    bindView();
+  }
+  return *this;
+}
+
+template <typename ValueType>
+auto MeshArray<ValueType>::operator=(MeshArray&& other) noexcept -> MeshArray& {
+  if (this != &other) {
+    data_ = std::move(other.data_);
+    view_ = other.view_;
+    owning_ = other.owning_;
+    bindView();
+    other.bindView();
+  }
+  return *this;
+}
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <typename ValueType>
+auto MeshArray<ValueType>::bindView() -> void {
+  if (owning_)
+    view_ = ViewType{data_};
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
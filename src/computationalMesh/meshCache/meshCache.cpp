@@ -0,0 +1,275 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/meshCache/meshCache.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+template <typename UnsignedInteger, typename FloatingPoint>
+MeshCache<UnsignedInteger, FloatingPoint>::MeshCache(const std::filesystem::path& cacheFile) : file_(cacheFile) {
+  static_assert(std::is_trivially_copyable_v<HeaderType>, "mesh cache header must be trivially copyable");
+
+  auto data = file_.getData();
+  if (data.size() < sizeof(HeaderType))
+    throw std::runtime_error("mesh cache file is too small to contain a header: " + cacheFile.string());
+  std::memcpy(&header_, data.data(), sizeof(HeaderType));
+
+  if (!isCompatible(header_))
+    throw std::runtime_error("mesh cache was written with an incompatible version or type configuration: " +
+                             cacheFile.string());
+
+  auto blockSizes = getBlockSizesInBytes(header_);
+  for (std::size_t block = 0; block < NumberOfBlocks; ++block)
+    if (header_.blockOffsets[block] % alignment_ != 0 || header_.blockOffsets[block] + blockSizes[block] > data.size())
+      throw std::runtime_error("mesh cache file is truncated or corrupt: " + cacheFile.string());
+}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <typename UnsignedInteger, typename FloatingPoint>
+auto MeshCache<UnsignedInteger, FloatingPoint>::getCacheFile(
+  const std::filesystem::path& meshFile) -> std::filesystem::path {
+  auto cacheFile = meshFile;
+  cacheFile.replace_extension(".aimmesh");
+  return cacheFile;
+}
+
+template <typename UnsignedInteger, typename FloatingPoint>
+auto MeshCache<UnsignedInteger, FloatingPoint>::isUpToDate(
+  const std::filesystem::path& cacheFile, const std::filesystem::path& meshFile, short int dimensions) -> bool {
+  if (!std::filesystem::exists(cacheFile) || !std::filesystem::exists(meshFile))
+    return false;
+  if (std::filesystem::last_write_time(cacheFile) < std::filesystem::last_write_time(meshFile))
+    return false;
+  auto header = readHeader(cacheFile);
+  return header.has_value() && isCompatible(header.value()) &&
+         header.value().dimensions == static_cast<std::uint32_t>(dimensions);
+}
+
+template <typename UnsignedInteger, typename FloatingPoint>
+auto MeshCache<UnsignedInteger, FloatingPoint>::write(const std::filesystem::path& cacheFile, short int dimensions,
+  const std::array<CoordinateViewType, 3>& coordinates, const ConnectivityTableType& connectivityTable,
+  const BoundaryConditionType& boundaryConditionInfo,
+  const BoundaryConditionConnectivityType& boundaryConditionConnectivity,
+  const BoundaryFaceConnectivityType& boundaryFaceConnectivity) -> void {
+  auto boundaryTypes = std::vector<std::int32_t>{};
+  auto boundaryNameOffsets = std::vector<std::uint64_t>{0};
+  auto boundaryNames = std::string{};
+  for (const auto &[type, name] : boundaryConditionInfo) {
+    boundaryTypes.push_back(static_cast<std::int32_t>(type));
+    boundaryNames += name;
+    boundaryNameOffsets.push_back(boundaryNames.size());
+  }
+
+  auto boundaryOffsets = std::vector<std::uint64_t>{0};
+  auto boundaryIndices = std::vector<AIM::Types::CGNSInt>{};
+  for (const auto &boundary : boundaryConditionConnectivity) {
+    boundaryIndices.insert(boundaryIndices.end(), boundary.begin(), boundary.end());
+    boundaryOffsets.push_back(boundaryIndices.size());
+  }
+
+  // the boundary faces of all boundaries are stored in a single connectivity table, split by face table offsets
+  auto boundaryFaceTableOffsets = std::vector<std::uint64_t>{0};
+  auto boundaryFaces = ConnectivityTableType{};
+  for (const auto &boundary : boundaryFaceConnectivity) {
+    for (const auto &face : boundary)
+      boundaryFaces.addCell(face);
+    boundaryFaceTableOffsets.push_back(boundaryFaces.size());
+  }
+
+  auto header = HeaderType{};
+  header.magic = magic_;
+  header.version = version_;
+  header.dimensions = static_cast<std::uint32_t>(dimensions);
+  header.floatTypeSize = sizeof(FloatType);
+  header.indexTypeSize = sizeof(IndexType);
+  header.cgnsIntTypeSize = sizeof(AIM::Types::CGNSInt);
+  header.numberOfVertices = coordinates[AIM::Enum::Coordinate::X].size();
+  header.numberOfCells = connectivityTable.size();
+  header.numberOfIndices = connectivityTable.getNumberOfIndices();
+  header.numberOfBoundaries = boundaryConditionInfo.size();
+  header.numberOfBoundaryNameCharacters = boundaryNames.size();
+  header.numberOfBoundaryConnectivities = boundaryConditionConnectivity.size();
+  header.numberOfBoundaryIndices = boundaryIndices.size();
+  header.numberOfBoundaryFaceTables = boundaryFaceConnectivity.size();
+  header.numberOfBoundaryFaces = boundaryFaces.size();
+  header.numberOfBoundaryFaceIndices = boundaryFaces.getNumberOfIndices();
+
+  auto blocks = std::array<std::span<const std::byte>, NumberOfBlocks>{};
+  blocks[CoordinateX] = std::as_bytes(coordinates[AIM::Enum::Coordinate::X]);
+  blocks[CoordinateY] = std::as_bytes(coordinates[AIM::Enum::Coordinate::Y]);
+  if (dimensions == AIM::Enum::Dimension::Three)
+    blocks[CoordinateZ] = std::as_bytes(coordinates[AIM::Enum::Coordinate::Z]);
+  blocks[CellOffsets] = std::as_bytes(connectivityTable.getOffsets());
+  blocks[CellIndices] = std::as_bytes(connectivityTable.getIndices());
+  blocks[BoundaryTypes] = std::as_bytes(std::span{boundaryTypes});
+  blocks[BoundaryNameOffsets] = std::as_bytes(std::span{boundaryNameOffsets});
+  blocks[BoundaryNames] = std::as_bytes(std::span{boundaryNames});
+  blocks[BoundaryOffsets] = std::as_bytes(std::span{boundaryOffsets});
+  blocks[BoundaryIndices] = std::as_bytes(std::span{boundaryIndices});
+  blocks[BoundaryFaceTableOffsets] = std::as_bytes(std::span{boundaryFaceTableOffsets});
+  blocks[BoundaryFaceOffsets] = std::as_bytes(boundaryFaces.getOffsets());
+  blocks[BoundaryFaceIndices] = std::as_bytes(boundaryFaces.getIndices());
+
+  auto alignUp = [](std::uint64_t offset) { return (offset + alignment_ - 1) / alignment_ * alignment_; };
+  auto blockSizes = getBlockSizesInBytes(header);
+  auto offset = alignUp(sizeof(HeaderType));
+  for (std::size_t block = 0; block < NumberOfBlocks; ++block) {
+    assert(blocks[block].size() == blockSizes[block] && "mesh data is inconsistent with the mesh cache header");
+    header.blockOffsets[block] = offset;
+    offset = alignUp(offset + blockSizes[block]);
+  }
+
+  // write into a temporary file first so that an interrupted run never leaves a partially written cache behind
+  auto temporaryFile = cacheFile;
+  temporaryFile += ".tmp";
+  auto output = std::ofstream(temporaryFile, std::ios::binary | std::ios::trunc);
+  if (!output)
+    throw std::runtime_error("can't open mesh cache file for writing: " + temporaryFile.string());
+
+  auto padding = std::array<char, alignment_>{};
+  auto position = std::uint64_t{sizeof(HeaderType)};
+  output.write(reinterpret_cast<const char *>(&header), sizeof(HeaderType));
+  for (std::size_t block = 0; block < NumberOfBlocks; ++block) {
+    output.write(padding.data(), static_cast<std::streamsize>(header.blockOffsets[block] - position));
+    output.write(reinterpret_cast<const char *>(blocks[block].data()), static_cast<std::streamsize>(blockSizes[block]));
+    position = header.blockOffsets[block] + blockSizes[block];
+  }
+  output.close();
+  if (!output)
+    throw std::runtime_error("failed to write mesh cache file: " + temporaryFile.string());
+
+  std::filesystem::rename(temporaryFile, cacheFile);
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+template <typename UnsignedInteger, typename FloatingPoint>
+auto MeshCache<UnsignedInteger, FloatingPoint>::getConnectivityTable() const -> ConnectivityTableType {
+  return ConnectivityTableType{getBlock<IndexType>(CellOffsets), getBlock<IndexType>(CellIndices)};
+}
+
+template <typename UnsignedInteger, typename FloatingPoint>
+auto MeshCache<UnsignedInteger, FloatingPoint>::getBoundaryConditionInfo() const -> BoundaryConditionType {
+  auto types = getBlock<std::int32_t>(BoundaryTypes);
+  auto nameOffsets = getBlock<std::uint64_t>(BoundaryNameOffsets);
+  auto names = getBlock<char>(BoundaryNames);
+
+  auto boundaryConditionInfo = BoundaryConditionType{};
+  for (std::size_t boundary = 0; boundary < types.size(); ++boundary) {
+    auto name = std::string(names.begin() + static_cast<std::ptrdiff_t>(nameOffsets[boundary]),
+      names.begin() + static_cast<std::ptrdiff_t>(nameOffsets[boundary + 1]));
+    boundaryConditionInfo.emplace_back(types[boundary], name);
+  }
+  return boundaryConditionInfo;
+}
+
+template <typename UnsignedInteger, typename FloatingPoint>
+auto MeshCache<UnsignedInteger, FloatingPoint>::getBoundaryConditionConnectivity(
+  ) const -> BoundaryConditionConnectivityType {
+  auto offsets = getBlock<std::uint64_t>(BoundaryOffsets);
+  auto indices = getBlock<AIM::Types::CGNSInt>(BoundaryIndices);
+
+  auto boundaryConditionConnectivity = BoundaryConditionConnectivityType(header_.numberOfBoundaryConnectivities);
+  for (std::size_t boundary = 0; boundary < boundaryConditionConnectivity.size(); ++boundary)
+    boundaryConditionConnectivity[boundary].assign(indices.begin() + static_cast<std::ptrdiff_t>(offsets[boundary]),
+      indices.begin() + static_cast<std::ptrdiff_t>(offsets[boundary + 1]));
+  return boundaryConditionConnectivity;
+}
+
+template <typename UnsignedInteger, typename FloatingPoint>
+auto MeshCache<UnsignedInteger, FloatingPoint>::getBoundaryFaceConnectivity() const -> BoundaryFaceConnectivityType {
+  auto tableOffsets = getBlock<std::uint64_t>(BoundaryFaceTableOffsets);
+  auto boundaryFaces =
+    ConnectivityTableType{getBlock<IndexType>(BoundaryFaceOffsets), getBlock<IndexType>(BoundaryFaceIndices)};
+
+  auto boundaryFaceConnectivity = BoundaryFaceConnectivityType(header_.numberOfBoundaryFaceTables);
+  for (std::size_t boundary = 0; boundary < boundaryFaceConnectivity.size(); ++boundary)
+    for (auto face = tableOffsets[boundary]; face < tableOffsets[boundary + 1]; ++face)
+      boundaryFaceConnectivity[boundary].addCell(boundaryFaces[face]);
+  return boundaryFaceConnectivity;
+}
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <typename UnsignedInteger, typename FloatingPoint>
+auto MeshCache<UnsignedInteger, FloatingPoint>::readHeader(
+  const std::filesystem::path& cacheFile) -> std::optional<HeaderType> {
+  auto input = std::ifstream(cacheFile, std::ios::binary);
+  auto header = HeaderType{};
+  if (!input.read(reinterpret_cast<char *>(&header), sizeof(HeaderType)))
+    return std::nullopt;
+  return header;
+}
+
+template <typename UnsignedInteger, typename FloatingPoint>
+auto MeshCache<UnsignedInteger, FloatingPoint>::isCompatible(const HeaderType& header) -> bool {
+  return header.magic == magic_ && header.version == version_ &&
+         header.floatTypeSize == sizeof(FloatType) && header.indexTypeSize == sizeof(IndexType) &&
+         header.cgnsIntTypeSize == sizeof(AIM::Types::CGNSInt);
+}
+
+template <typename UnsignedInteger, typename FloatingPoint>
+auto MeshCache<UnsignedInteger, FloatingPoint>::getBlockSizesInBytes(
+  const HeaderType& header) -> std::array<std::uint64_t, NumberOfBlocks> {
+  auto sizes = std::array<std::uint64_t, NumberOfBlocks>{};
+  auto coordinateSize = header.numberOfVertices * sizeof(FloatType);
+  sizes[CoordinateX] = coordinateSize;
+  sizes[CoordinateY] = coordinateSize;
+  sizes[CoordinateZ] = header.dimensions == AIM::Enum::Dimension::Three ? coordinateSize : 0;
+  sizes[CellOffsets] = (header.numberOfCells + 1) * sizeof(IndexType);
+  sizes[CellIndices] = header.numberOfIndices * sizeof(IndexType);
+  sizes[BoundaryTypes] = header.numberOfBoundaries * sizeof(std::int32_t);
+  sizes[BoundaryNameOffsets] = (header.numberOfBoundaries + 1) * sizeof(std::uint64_t);
+  sizes[BoundaryNames] = header.numberOfBoundaryNameCharacters;
+  sizes[BoundaryOffsets] = (header.numberOfBoundaryConnectivities + 1) * sizeof(std::uint64_t);
+  sizes[BoundaryIndices] = header.numberOfBoundaryIndices * sizeof(AIM::Types::CGNSInt);
+  sizes[BoundaryFaceTableOffsets] = (header.numberOfBoundaryFaceTables + 1) * sizeof(std::uint64_t);
+  sizes[BoundaryFaceOffsets] = (header.numberOfBoundaryFaces + 1) * sizeof(IndexType);
+  sizes[BoundaryFaceIndices] = header.numberOfBoundaryFaceIndices * sizeof(IndexType);
+  return sizes;
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+// explicit instantiation of the supported index and floating point types
+template class MeshCache<std::uint32_t, float>;
+template class MeshCache<std::uint32_t, double>;
+template class MeshCache<std::uint64_t, float>;
+template class MeshCache<std::uint64_t, double>;
+
+}  // namespace Mesh
+}  // end namespace AIM
@@ -0,0 +1,178 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/connectivityTable/connectivityTable.hpp"
+#include "src/types/types.hpp"
+#include "src/utilities/memoryMappedFile/memoryMappedFile.hpp"
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class MeshCache
+ * \brief Native binary mesh format that can be memory mapped to avoid parsing the CGNS file on every run
+ * \ingroup mesh
+ *
+ * Reading a large mesh through the CGNS library is slow and is repeated on every (re)start of the solver. After the
+ * mesh has been read once, the coordinates, the connectivity table and the boundary data can be written into a binary
+ * cache file using the static write() method. The file starts with a versioned header describing the size and location
+ * of each data block, followed by the blocks themselves, each aligned to a cache line boundary. Subsequent runs open
+ * the cache by constructing a MeshCache object, which memory maps the file and exposes the coordinates and the
+ * connectivity table as views into the mapped memory, i.e. no data is read or copied until it is accessed. Only the
+ * (small) boundary condition data and the boundary faces are copied out of the file. The cache is only valid on the
+ * machine architecture and type configuration it was written with. The class is templated on the index type of the
+ * connectivity table and the floating point type of the coordinates (defaulting to the types in src/types/types.hpp),
+ * their widths are stored in the header and validated by isUpToDate() and on construction, so that a cache written
+ * with, for example, 32-bit indices is never reinterpreted as 64-bit indices.
+ *
+ * \code
+ * auto meshFile = std::filesystem::path("input/mesh.cgns");
+ * auto cacheFile = AIM::Mesh::MeshCache<>::getCacheFile(meshFile);
+ *
+ * if (!AIM::Mesh::MeshCache<>::isUpToDate(cacheFile, meshFile, AIM::Enum::Dimension::Two))
+ *   AIM::Mesh::MeshCache<>::write(cacheFile, AIM::Enum::Dimension::Two, {x, y, {}}, connectivity, bc, bcc, faces);
+ *
+ * // the cache object must outlive all views obtained from it
+ * auto meshCache = AIM::Mesh::MeshCache<>{cacheFile};
+ * auto x = meshCache.getCoordinate<AIM::Enum::Coordinate::X>();
+ * auto connectivityTable = meshCache.getConnectivityTable();
+ * \endcode
+ */
+
+template <typename UnsignedInteger = AIM::Types::UInt, typename FloatingPoint = AIM::Types::FloatType>
+class MeshCache {
+  static_assert(AIM::Types::MeshIndexType<UnsignedInteger>, "mesh indices must be 32-bit or 64-bit unsigned");
+  static_assert(AIM::Types::MeshFloatType<FloatingPoint>, "mesh coordinates must be stored as float or double");
+
+  /// \name Custom types used in this class
+  /// @{
+public:
+  using IndexType = UnsignedInteger;
+  using FloatType = FloatingPoint;
+  using CoordinateViewType = std::span<const FloatType>;
+  using ConnectivityTableType = AIM::Mesh::ConnectivityTable<IndexType>;
+  using BoundaryConditionType = typename std::vector<std::pair<int, std::string>>;
+  using BoundaryConditionConnectivityType = typename std::vector<std::vector<AIM::Types::CGNSInt>>;
+  using BoundaryFaceConnectivityType = typename std::vector<ConnectivityTableType>;
+
+private:
+  enum Block {
+    CoordinateX = 0,
+    CoordinateY,
+    CoordinateZ,
+    CellOffsets,
+    CellIndices,
+    BoundaryTypes,
+    BoundaryNameOffsets,
+    BoundaryNames,
+    BoundaryOffsets,
+    BoundaryIndices,
+    BoundaryFaceTableOffsets,
+    BoundaryFaceOffsets,
+    BoundaryFaceIndices,
+    NumberOfBlocks
+  };
+
+  struct HeaderType {
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t dimensions;
+    std::uint32_t floatTypeSize;
+    std::uint32_t indexTypeSize;
+    std::uint32_t cgnsIntTypeSize;
+    std::uint32_t padding;
+    std::uint64_t numberOfVertices;
+    std::uint64_t numberOfCells;
+    std::uint64_t numberOfIndices;
+    std::uint64_t numberOfBoundaries;
+    std::uint64_t numberOfBoundaryNameCharacters;
+    std::uint64_t numberOfBoundaryConnectivities;
+    std::uint64_t numberOfBoundaryIndices;
+    std::uint64_t numberOfBoundaryFaceTables;
+    std::uint64_t numberOfBoundaryFaces;
+    std::uint64_t numberOfBoundaryFaceIndices;
+    std::array<std::uint64_t, NumberOfBlocks> blockOffsets;
+  };
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  MeshCache(const std::filesystem::path& cacheFile);
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  static auto getCacheFile(const std::filesystem::path& meshFile) -> std::filesystem::path;
+  static auto isUpToDate(const std::filesystem::path& cacheFile, const std::filesystem::path& meshFile,
+    short int dimensions) -> bool;
+  static auto write(const std::filesystem::path& cacheFile, short int dimensions,
+    const std::array<CoordinateViewType, 3>& coordinates, const ConnectivityTableType& connectivityTable,
+    const BoundaryConditionType& boundaryConditionInfo,
+    const BoundaryConditionConnectivityType& boundaryConditionConnectivity,
+    const BoundaryFaceConnectivityType& boundaryFaceConnectivity) -> void;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getDimensions() const -> short int { return static_cast<short int>(header_.dimensions); }
+  template <int Index>
+  auto getCoordinate() const -> CoordinateViewType;
+  auto getConnectivityTable() const -> ConnectivityTableType;
+  auto getBoundaryConditionInfo() const -> BoundaryConditionType;
+  auto getBoundaryConditionConnectivity() const -> BoundaryConditionConnectivityType;
+  auto getBoundaryFaceConnectivity() const -> BoundaryFaceConnectivityType;
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  static auto readHeader(const std::filesystem::path& cacheFile) -> std::optional<HeaderType>;
+  static auto isCompatible(const HeaderType& header) -> bool;
+  static auto getBlockSizesInBytes(const HeaderType& header) -> std::array<std::uint64_t, NumberOfBlocks>;
+  template <typename ValueType>
+  auto getBlock(Block block) const -> std::span<const ValueType>;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  static constexpr std::array<char, 8> magic_{'A', 'I', 'M', 'M', 'E', 'S', 'H', '\0'};
+  static constexpr std::uint32_t version_{3};
+  static constexpr std::uint64_t alignment_{64};
+
+  AIM::Utilities::MemoryMappedFile file_;
+  HeaderType header_{};
+  /// @}
+};
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "meshCache.tpp"
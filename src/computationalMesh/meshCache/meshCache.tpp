@@ -0,0 +1,58 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <span>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/types/types.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+
+/// @}
+
+/// \name Getters and setters
+/// @{
+template <typename UnsignedInteger, typename FloatingPoint>
+template <int Index>
+auto MeshCache<UnsignedInteger, FloatingPoint>::getCoordinate() const -> CoordinateViewType {
+  static_assert(Index >= 0 && Index < 3, "coordinate index must be 0 (x), 1 (y) or 2 (z)");
+  return getBlock<FloatType>(static_cast<Block>(CoordinateX + Index));
+}
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <typename UnsignedInteger, typename FloatingPoint>
+template <typename ValueType>
+auto MeshCache<UnsignedInteger, FloatingPoint>::getBlock(Block block) const -> std::span<const ValueType> {
+  auto sizeInBytes = getBlockSizesInBytes(header_)[block];
+  auto begin = file_.getData().data() + header_.blockOffsets[block];
+  return {reinterpret_cast<const ValueType *>(begin), static_cast<std::size_t>(sizeInBytes / sizeof(ValueType))};
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
@@ -0,0 +1,277 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/meshGeometry/meshGeometry.hpp"
+#include "src/types/enums.hpp"
+#include "src/utilities/hardwareCounters/hardwareCounters.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+MeshGeometry<Dimensions, UnsignedInteger, FloatingPoint>::MeshGeometry(
+  const CoordinatesViewType& coordinates, const ConnectivityTableType& cells, const FaceTopologyType& faceTopology) {
+  AIM_PROFILE_SCOPE("MeshGeometry::compute");
+  computeFaceGeometry(coordinates, faceTopology);
+  computeCellGeometry(coordinates, cells, faceTopology);
+  computeDistanceVectors(faceTopology);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+MeshGeometry<Dimensions, UnsignedInteger, FloatingPoint>::MeshGeometry(
+  const ComputationalMeshType& mesh, const FaceTopologyType& faceTopology)
+  : MeshGeometry(getCoordinates(mesh), mesh.getConnectivityTable(), faceTopology) {}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshGeometry<Dimensions, UnsignedInteger, FloatingPoint>::getCoordinates(
+  const ComputationalMeshType& mesh) -> CoordinatesViewType {
+  auto coordinates = CoordinatesViewType{};
+  ComputationalMeshType::MeshReaderType::forEachCoordinate([&mesh, &coordinates](auto index) {
+    coordinates[decltype(index)::value] = mesh.template getCoordinate<decltype(index)::value>();
+  });
+  return coordinates;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshGeometry<Dimensions, UnsignedInteger, FloatingPoint>::resize(VectorFieldType& field, std::size_t size)
+  -> void {
+  for (auto &component : field)
+    component.resize(size);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshGeometry<Dimensions, UnsignedInteger, FloatingPoint>::computeFaceGeometry(
+  const CoordinatesViewType& coordinates, const FaceTopologyType& faceTopology) -> void {
+  constexpr auto half = FloatType{0.5};
+  const auto &faceVertices = faceTopology.getFaceVertices();
+  auto numberOfFaces = faceTopology.getNumberOfFaces();
+  faceAreas_.resize(numberOfFaces);
+  resize(faceAreaVectors_, numberOfFaces);
+  resize(faceCentroids_, numberOfFaces);
+
+  if constexpr (Dimensions == AIM::Enum::Dimension::Two) {
+    // all faces are edges with exactly two vertices, so they are read with a fixed stride from the flat index array and
+    // the loop body is free of branches. For a counter-clockwise owner cell, (dy, -dx) points out of the owner
+    forEachChunk(numberOfFaces, [this, &coordinates, indices = faceVertices.getIndices()](auto begin, auto end) {
+      const auto x = coordinates[AIM::Enum::Coordinate::X];
+      const auto y = coordinates[AIM::Enum::Coordinate::Y];
+      auto *nx = faceAreaVectors_[AIM::Enum::Coordinate::X].data();
+      auto *ny = faceAreaVectors_[AIM::Enum::Coordinate::Y].data();
+      auto *cx = faceCentroids_[AIM::Enum::Coordinate::X].data();
+      auto *cy = faceCentroids_[AIM::Enum::Coordinate::Y].data();
+      auto *area = faceAreas_.data();
+      for (auto face = begin; face < end; ++face) {
+        auto first = indices[2 * face];
+        auto second = indices[2 * face + 1];
+        auto dx = x[second] - x[first];
+        auto dy = y[second] - y[first];
+        nx[face] = dy;
+        ny[face] = -dx;
+        area[face] = std::sqrt(dx * dx + dy * dy);
+        cx[face] = half * (x[first] + x[second]);
+        cy[face] = half * (y[first] + y[second]);
+      }
+    });
+  } else {
+    // faces are split into triangles spanned by each edge and the average of the face vertices. The area vectors of the
+    // triangles are summed, their centroids are weighted by their area
+    constexpr auto third = FloatType{1} / FloatType{3};
+    forEachChunk(numberOfFaces, [this, &coordinates, &faceVertices, half, third](auto begin, auto end) {
+      for (auto face = begin; face < end; ++face) {
+        auto vertices = faceVertices[face];
+        auto numberOfVertices = vertices.size();
+        auto centre = PointType{};
+        for (const auto &vertex : vertices)
+          for (std::size_t dimension = 0; dimension < 3; ++dimension)
+            centre[dimension] += coordinates[dimension][vertex];
+        for (auto &component : centre)
+          component /= static_cast<FloatType>(numberOfVertices);
+
+        auto areaVector = PointType{};
+        auto centroid = PointType{};
+        auto totalArea = FloatType{0};
+        for (std::size_t vertex = 0; vertex < numberOfVertices; ++vertex) {
+          auto first = vertices[vertex];
+          auto second = vertices[(vertex + 1) % numberOfVertices];
+          auto edge = PointType{};
+          auto toCentre = PointType{};
+          for (std::size_t dimension = 0; dimension < 3; ++dimension) {
+            edge[dimension] = coordinates[dimension][second] - coordinates[dimension][first];
+            toCentre[dimension] = centre[dimension] - coordinates[dimension][first];
+          }
+          auto triangle = PointType{half * (edge[1] * toCentre[2] - edge[2] * toCentre[1]),
+            half * (edge[2] * toCentre[0] - edge[0] * toCentre[2]),
+            half * (edge[0] * toCentre[1] - edge[1] * toCentre[0])};
+          auto triangleArea =
+            std::sqrt(triangle[0] * triangle[0] + triangle[1] * triangle[1] + triangle[2] * triangle[2]);
+          for (std::size_t dimension = 0; dimension < 3; ++dimension) {
+            areaVector[dimension] += triangle[dimension];
+            centroid[dimension] += triangleArea * third *
+              (coordinates[dimension][first] + coordinates[dimension][second] + centre[dimension]);
+          }
+          totalArea += triangleArea;
+        }
+
+        faceAreas_[face] =
+          std::sqrt(areaVector[0] * areaVector[0] + areaVector[1] * areaVector[1] + areaVector[2] * areaVector[2]);
+        for (std::size_t dimension = 0; dimension < 3; ++dimension) {
+          faceAreaVectors_[dimension][face] = areaVector[dimension];
+          faceCentroids_[dimension][face] = totalArea > 0 ? centroid[dimension] / totalArea : centre[dimension];
+        }
+      }
+    });
+  }
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshGeometry<Dimensions, UnsignedInteger, FloatingPoint>::computeCellGeometry(
+  const CoordinatesViewType& coordinates, const ConnectivityTableType& cells, const FaceTopologyType& faceTopology)
+  -> void {
+  constexpr auto numberOfDimensions = static_cast<std::size_t>(Dimensions);
+  constexpr auto dimensions = static_cast<FloatType>(Dimensions);
+  auto owner = faceTopology.getOwner();
+  auto neighbour = faceTopology.getNeighbour();
+  cellVolumes_.resize(cells.size());
+  resize(cellCentroids_, cells.size());
+
+  // faces are stored once for both cells sharing them, the cell loop needs the faces of each cell instead
+  auto cellFaceOffsets = std::vector<std::size_t>(cells.size() + 1, 0);
+  for (const auto &cell : owner)
+    ++cellFaceOffsets[cell + 1];
+  for (const auto &cell : neighbour)
+    ++cellFaceOffsets[cell + 1];
+  std::partial_sum(cellFaceOffsets.begin(), cellFaceOffsets.end(), cellFaceOffsets.begin());
+
+  auto cellFaces = std::vector<IndexType>(cellFaceOffsets.back());
+  auto position = std::vector<std::size_t>(cellFaceOffsets.begin(), cellFaceOffsets.end() - 1);
+  for (std::size_t face = 0; face < owner.size(); ++face)
+    cellFaces[position[owner[face]]++] = static_cast<IndexType>(face);
+  for (std::size_t face = 0; face < neighbour.size(); ++face)
+    cellFaces[position[neighbour[face]]++] = static_cast<IndexType>(face);
+
+  // the average of the cell vertices is computed per element block, where the number of vertices per cell is a
+  // compile-time constant and the loop over the vertices of a cell is unrolled
+  auto apexes = VectorFieldType{};
+  resize(apexes, cells.size());
+  ElementBlocksType{cells}.forEachBlock([&apexes, &coordinates, numberOfDimensions](const auto &block) {
+    constexpr auto numberOfVertices = std::remove_cvref_t<decltype(block)>::numberOfVertices;
+    constexpr auto weight = FloatType{1} / static_cast<FloatType>(numberOfVertices);
+    forEachChunk(block.size(), [&apexes, &coordinates, &block, numberOfDimensions, weight](auto begin, auto end) {
+      for (std::size_t dimension = 0; dimension < numberOfDimensions; ++dimension) {
+        const auto coordinate = coordinates[dimension];
+        auto *apex = apexes[dimension].data() + block.getFirstCell();
+        for (auto cell = begin; cell < end; ++cell) {
+          auto vertices = block[cell];
+          auto sum = FloatType{0};
+          for (std::size_t vertex = 0; vertex < numberOfVertices; ++vertex)
+            sum += coordinate[vertices[vertex]];
+          apex[cell] = sum * weight;
+        }
+      }
+    });
+  });
+
+  // each face forms a pyramid with the average of the cell vertices as apex. Its volume is a dot product with the face
+  // area vector, which points out of the owner and therefore into the neighbour, so the sign is flipped for neighbours
+  forEachChunk(cells.size(), [&](auto begin, auto end) {
+    for (auto cell = begin; cell < end; ++cell) {
+      auto apex = PointType{};
+      for (std::size_t dimension = 0; dimension < numberOfDimensions; ++dimension)
+        apex[dimension] = apexes[dimension][cell];
+
+      auto volume = FloatType{0};
+      auto centroid = PointType{};
+      for (auto index = cellFaceOffsets[cell]; index < cellFaceOffsets[cell + 1]; ++index) {
+        auto face = cellFaces[index];
+        auto height = FloatType{0};
+        for (std::size_t dimension = 0; dimension < numberOfDimensions; ++dimension)
+          height += faceAreaVectors_[dimension][face] * (faceCentroids_[dimension][face] - apex[dimension]);
+        auto pyramidVolume = (owner[face] == cell ? height : -height) / dimensions;
+
+        // the centroid of a pyramid lies on the line from its base centroid to its apex, 1 / (D + 1) of the way up
+        for (std::size_t dimension = 0; dimension < numberOfDimensions; ++dimension)
+          centroid[dimension] +=
+            pyramidVolume * (dimensions * faceCentroids_[dimension][face] + apex[dimension]) / (dimensions + 1);
+        volume += pyramidVolume;
+      }
+
+      cellVolumes_[cell] = volume;
+      for (std::size_t dimension = 0; dimension < numberOfDimensions; ++dimension)
+        cellCentroids_[dimension][cell] = volume != 0 ? centroid[dimension] / volume : apex[dimension];
+    }
+  });
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshGeometry<Dimensions, UnsignedInteger, FloatingPoint>::computeDistanceVectors(
+  const FaceTopologyType& faceTopology) -> void {
+  auto owner = faceTopology.getOwner();
+  auto neighbour = faceTopology.getNeighbour();
+  auto numberOfInteriorFaces = faceTopology.getNumberOfInteriorFaces();
+  resize(distanceVectors_, faceTopology.getNumberOfFaces());
+
+  // interior and boundary faces are handled in two separate, branch-free loops per coordinate direction
+  forEachChunk(faceTopology.getNumberOfFaces(), [&](auto begin, auto end) {
+    for (std::size_t dimension = 0; dimension < static_cast<std::size_t>(Dimensions); ++dimension) {
+      const auto *cellCentroid = cellCentroids_[dimension].data();
+      const auto *faceCentroid = faceCentroids_[dimension].data();
+      auto *distance = distanceVectors_[dimension].data();
+      for (auto face = begin; face < std::min(end, numberOfInteriorFaces); ++face)
+        distance[face] = cellCentroid[neighbour[face]] - cellCentroid[owner[face]];
+      for (auto face = std::max(begin, numberOfInteriorFaces); face < end; ++face)
+        distance[face] = faceCentroid[face] - cellCentroid[owner[face]];
+    }
+  });
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+// explicit instantiation of the supported mesh dimensions, index and floating point types
+template class MeshGeometry<AIM::Enum::Dimension::Two, std::uint32_t, float>;
+template class MeshGeometry<AIM::Enum::Dimension::Two, std::uint32_t, double>;
+template class MeshGeometry<AIM::Enum::Dimension::Two, std::uint64_t, float>;
+template class MeshGeometry<AIM::Enum::Dimension::Two, std::uint64_t, double>;
+template class MeshGeometry<AIM::Enum::Dimension::Three, std::uint32_t, float>;
+template class MeshGeometry<AIM::Enum::Dimension::Three, std::uint32_t, double>;
+template class MeshGeometry<AIM::Enum::Dimension::Three, std::uint64_t, float>;
+template class MeshGeometry<AIM::Enum::Dimension::Three, std::uint64_t, double>;
+
+}  // namespace Mesh
+}  // end namespace AIM
@@ -0,0 +1,159 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <array>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/connectivityTable/connectivityTable.hpp"
+#include "src/computationalMesh/elementBlocks/elementBlocks.hpp"
+#include "src/computationalMesh/faceTopology/faceTopology.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class MeshGeometry
+ * \brief Computes the geometric quantities of cells and faces once, so that solver kernels can read them from memory
+ * \ingroup mesh
+ *
+ * Finite-volume kernels need the volume and centroid of each cell, the area vector and centroid of each face and the
+ * distance vector between the two cells sharing a face. This class computes all of them once from the coordinates, the
+ * connectivity table and the AIM::Mesh::FaceTopology of the mesh. In 2D, volumes are cell areas and face areas are
+ * edge lengths.
+ *
+ * - Faces: the area vector is normal to the face, points out of the owner cell (see AIM::Mesh::FaceTopology) and has
+ *   the area of the face as its magnitude. 2D faces are straight edges, 3D faces are split into triangles around the
+ *   average of their vertices, so that non-planar quads are handled consistently.
+ * - Cells: each cell is split into pyramids (triangles in 2D), one per face, with their apex at the average of the cell
+ *   vertices. Their volumes and volume-weighted centroids are summed into the cell volume and centroid. This is exact
+ *   for all cells with planar faces. The vertex averages are computed per element type (see AIM::Mesh::ElementBlocks),
+ *   so the cells of the connectivity table have to be grouped by element type, as they are when read from file.
+ * - Distance vectors: for interior faces, the vector from the owner centroid to the neighbour centroid, for boundary
+ *   faces the vector from the owner centroid to the face centroid.
+ *
+ * All vector quantities are stored as a structure of arrays, i.e. one contiguous array per coordinate direction, so
+ * that kernels looping over cells or faces read unit-stride memory and can be vectorised by the compiler. The face and
+ * cell loops are split into chunks that are processed in parallel, each cell and face is written by exactly one chunk.
+ *
+ * \code
+ * auto mesh = AIM::Mesh::ComputationalMesh{meshReader};
+ * auto faceTopology = AIM::Mesh::FaceTopology{mesh};
+ * auto geometry = AIM::Mesh::MeshGeometry{mesh, faceTopology};
+ *
+ * const auto &faceAreaVectors = geometry.getFaceAreaVectors();
+ * const auto &distances = geometry.getDistanceVectors();
+ * for (std::size_t face = 0; face < faceTopology.getNumberOfInteriorFaces(); ++face) {
+ *   auto nx = faceAreaVectors[AIM::Enum::Coordinate::X][face];
+ *   auto dx = distances[AIM::Enum::Coordinate::X][face];
+ *   ...
+ * }
+ * std::cout << "volume of the first cell: " << geometry.getCellVolumes()[0] << std::endl;
+ * \endcode
+ */
+
+template <int Dimensions, typename UnsignedInteger = AIM::Types::UInt, typename FloatingPoint = AIM::Types::FloatType>
+class MeshGeometry {
+  static_assert(AIM::Types::MeshIndexType<UnsignedInteger>, "mesh indices must be 32-bit or 64-bit unsigned");
+  static_assert(AIM::Types::MeshFloatType<FloatingPoint>, "mesh coordinates must be stored as float or double");
+
+  /// \name Custom types used in this class
+  /// @{
+public:
+  using IndexType = UnsignedInteger;
+  using FloatType = FloatingPoint;
+  using CoordinateViewType = std::span<const FloatType>;
+  using CoordinatesViewType = std::array<CoordinateViewType, static_cast<std::size_t>(Dimensions)>;
+  using ScalarFieldType = std::vector<FloatType>;
+  using VectorFieldType = std::array<ScalarFieldType, static_cast<std::size_t>(Dimensions)>;
+  using ConnectivityTableType = ConnectivityTable<IndexType>;
+  using FaceTopologyType = FaceTopology<Dimensions, UnsignedInteger>;
+  using ElementBlocksType = ElementBlocks<Dimensions, UnsignedInteger>;
+  using ComputationalMeshType = ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>;
+
+private:
+  using PointType = std::array<FloatType, static_cast<std::size_t>(Dimensions)>;
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  MeshGeometry(
+    const CoordinatesViewType& coordinates, const ConnectivityTableType& cells, const FaceTopologyType& faceTopology);
+  MeshGeometry(const ComputationalMeshType& mesh, const FaceTopologyType& faceTopology);
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getNumberOfCells() const -> std::size_t { return cellVolumes_.size(); }
+  auto getNumberOfFaces() const -> std::size_t { return faceAreas_.size(); }
+  auto getCellVolumes() const -> std::span<const FloatType> { return cellVolumes_; }
+  auto getCellCentroids() const -> const VectorFieldType& { return cellCentroids_; }
+  auto getFaceAreas() const -> std::span<const FloatType> { return faceAreas_; }
+  auto getFaceAreaVectors() const -> const VectorFieldType& { return faceAreaVectors_; }
+  auto getFaceCentroids() const -> const VectorFieldType& { return faceCentroids_; }
+  auto getDistanceVectors() const -> const VectorFieldType& { return distanceVectors_; }
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  static auto getCoordinates(const ComputationalMeshType& mesh) -> CoordinatesViewType;
+  template <typename ChunkFunction>
+  static auto forEachChunk(std::size_t size, ChunkFunction&& function) -> void;
+  static auto resize(VectorFieldType& field, std::size_t size) -> void;
+  auto computeFaceGeometry(const CoordinatesViewType& coordinates, const FaceTopologyType& faceTopology) -> void;
+  auto computeCellGeometry(
+    const CoordinatesViewType& coordinates, const ConnectivityTableType& cells, const FaceTopologyType& faceTopology)
+    -> void;
+  auto computeDistanceVectors(const FaceTopologyType& faceTopology) -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  ScalarFieldType cellVolumes_;
+  VectorFieldType cellCentroids_;
+  ScalarFieldType faceAreas_;
+  VectorFieldType faceAreaVectors_;
+  VectorFieldType faceCentroids_;
+  VectorFieldType distanceVectors_;
+  /// @}
+};
+
+/// \name Deduction guide, so that the dimension and types are taken from the computational mesh
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+MeshGeometry(const ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>&,
+  const FaceTopology<Dimensions, UnsignedInteger>&) -> MeshGeometry<Dimensions, UnsignedInteger, FloatingPoint>;
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "meshGeometry.tpp"
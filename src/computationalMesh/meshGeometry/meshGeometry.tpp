@@ -0,0 +1,53 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cstddef>
+#include <utility>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/utilities/threadPool/threadPool.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+template <typename ChunkFunction>
+auto MeshGeometry<Dimensions, UnsignedInteger, FloatingPoint>::forEachChunk(
+  std::size_t size, ChunkFunction&& function) -> void {
+  AIM::Utilities::ThreadPool::getInstance().parallelFor(0, size, std::forward<ChunkFunction>(function));
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
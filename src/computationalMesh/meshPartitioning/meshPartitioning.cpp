@@ -0,0 +1,519 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/meshPartitioning/meshPartitioning.hpp"
+#include "src/parameterFileReading/parameterRegistry.hpp"
+#include "src/types/enums.hpp"
+#include "src/utilities/threadPool/threadPool.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::MeshPartitioning(AIM::Enum::Partitioning method,
+  std::size_t numberOfPartitions, const CoordinatesViewType& coordinates, const ConnectivityTableType& cells) {
+  if (numberOfPartitions == 0 || numberOfPartitions > cells.size())
+    throw std::runtime_error("cannot split " + std::to_string(cells.size()) + " cells into " +
+                             std::to_string(numberOfPartitions) + " partitions");
+
+  auto graph = buildDualGraph(cells);
+  switch (method) {
+    case AIM::Enum::Partitioning::RecursiveCoordinateBisection:
+      partitionByCoordinateBisection(coordinates, cells, numberOfPartitions);
+      break;
+    case AIM::Enum::Partitioning::MultilevelGraph: partitionByMultilevelGraph(graph, numberOfPartitions); break;
+  }
+  buildPartitions(graph, numberOfPartitions);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::MeshPartitioning(const ComputationalMeshType& mesh)
+  : MeshPartitioning(readMethod(), readNumberOfPartitions(mesh.getConnectivityTable().size()), getCoordinates(mesh),
+      mesh.getConnectivityTable()) {}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::getMethodFromString(
+  const std::string& method) -> AIM::Enum::Partitioning {
+  if (method == "recursiveCoordinateBisection")
+    return AIM::Enum::Partitioning::RecursiveCoordinateBisection;
+  if (method == "multilevelGraph")
+    return AIM::Enum::Partitioning::MultilevelGraph;
+  throw std::runtime_error("unknown mesh partitioning method: " + method +
+                           " (expected recursiveCoordinateBisection or multilevelGraph)");
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::partitionGraph(
+  const GraphType& graph, std::size_t numberOfPartitions) -> std::vector<IndexType> {
+  if (numberOfPartitions == 0 || numberOfPartitions > graph.size())
+    throw std::runtime_error("number of partitions (" + std::to_string(numberOfPartitions) +
+                             ") must be between 1 and the number of graph vertices (" + std::to_string(graph.size()) +
+                             ")");
+  auto partition = std::vector<IndexType>(graph.size(), 0);
+  auto nodes = std::vector<IndexType>(graph.size());
+  std::iota(nodes.begin(), nodes.end(), IndexType{0});
+  bisectRecursively(graph, std::move(nodes), 0, numberOfPartitions, partition);
+  refine(graph, numberOfPartitions, partition);
+  return partition;
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::readMethod() -> AIM::Enum::Partitioning {
+  auto parameters = AIM::Parameters::ParameterRegistry{"input/aim.json"};
+  auto method = parameters.declare<std::string>("/mesh/partitioning/method", "multilevelGraph");
+  parameters.validate();
+
+  return getMethodFromString(parameters.get(method));
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::readNumberOfPartitions(
+  std::size_t numberOfCells) -> std::size_t {
+  auto numberOfThreads = AIM::Utilities::ThreadPool::getInstance().getNumberOfThreads();
+  auto parameters = AIM::Parameters::ParameterRegistry{"input/aim.json"};
+  auto numberOfPartitions =
+    parameters.declare<std::size_t>("/mesh/partitioning/numberOfPartitions", std::min(numberOfThreads, numberOfCells));
+  parameters.validate();
+
+  return parameters.get(numberOfPartitions);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::getCoordinates(
+  const ComputationalMeshType& mesh) -> CoordinatesViewType {
+  auto coordinates = CoordinatesViewType{};
+  ComputationalMeshType::MeshReaderType::forEachCoordinate([&mesh, &coordinates](auto index) {
+    coordinates[decltype(index)::value] = mesh.template getCoordinate<decltype(index)::value>();
+  });
+  return coordinates;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::buildDualGraph(
+  const ConnectivityTableType& cells) -> GraphType {
+  auto inverseConnectivity = InverseConnectivityType{cells};
+  const auto &cellToCell = inverseConnectivity.getCellToCell();
+
+  auto graph = GraphType{};
+  graph.offsets.assign(cellToCell.getOffsets().begin(), cellToCell.getOffsets().end());
+  graph.adjacency.assign(cellToCell.getIndices().begin(), cellToCell.getIndices().end());
+  graph.edgeWeights.assign(graph.adjacency.size(), 1);
+  graph.vertexWeights.assign(cells.size(), 1);
+  return graph;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::coarsen(
+  const GraphType& graph, std::vector<IndexType>& coarseNode) -> GraphType {
+  // heavy-edge matching: each node is collapsed with the unmatched neighbour it shares the heaviest edge with. Nodes
+  // with few neighbours are visited first, as they have the fewest chances of finding a partner
+  auto unmatched = std::numeric_limits<IndexType>::max();
+  auto degree = [&graph](IndexType node) { return graph.offsets[node + 1] - graph.offsets[node]; };
+  auto order = std::vector<IndexType>(graph.size());
+  std::iota(order.begin(), order.end(), IndexType{0});
+  std::ranges::stable_sort(order, {}, degree);
+
+  auto match = std::vector<IndexType>(graph.size(), unmatched);
+  for (const auto &node : order) {
+    if (match[node] != unmatched)
+      continue;
+    auto partner = node;
+    auto heaviestEdge = std::size_t{0};
+    for (auto index = graph.offsets[node]; index < graph.offsets[node + 1]; ++index) {
+      auto neighbour = graph.adjacency[index];
+      if (match[neighbour] == unmatched && neighbour != node && graph.edgeWeights[index] > heaviestEdge) {
+        partner = neighbour;
+        heaviestEdge = graph.edgeWeights[index];
+      }
+    }
+    match[node] = partner;
+    match[partner] = node;
+  }
+
+  // coarse nodes are numbered in the order of their first member, so that they are built in order below
+  auto numberOfCoarseNodes = IndexType{0};
+  coarseNode.assign(graph.size(), unmatched);
+  for (std::size_t node = 0; node < graph.size(); ++node)
+    if (coarseNode[node] == unmatched)
+      coarseNode[node] = coarseNode[match[node]] = numberOfCoarseNodes++;
+
+  // edges between the same pair of coarse nodes are merged by adding their weights, position[] stores where the edge
+  // to a coarse node was placed, entries before the start of the current row are stale
+  auto coarse = GraphType{};
+  coarse.vertexWeights.assign(numberOfCoarseNodes, 0);
+  auto notPlaced = std::numeric_limits<std::size_t>::max();
+  auto position = std::vector<std::size_t>(numberOfCoarseNodes, notPlaced);
+  for (std::size_t node = 0; node < graph.size(); ++node) {
+    if (match[node] < node)
+      continue;
+    auto current = coarseNode[node];
+    auto rowStart = coarse.adjacency.size();
+    auto members = std::array<std::size_t, 2>{node, match[node]};
+    for (std::size_t member = 0; member < (members[0] == members[1] ? 1u : 2u); ++member) {
+      coarse.vertexWeights[current] += graph.vertexWeights[members[member]];
+      for (auto index = graph.offsets[members[member]]; index < graph.offsets[members[member] + 1]; ++index) {
+        auto target = coarseNode[graph.adjacency[index]];
+        if (target == current)
+          continue;
+        if (position[target] == notPlaced || position[target] < rowStart) {
+          position[target] = coarse.adjacency.size();
+          coarse.adjacency.push_back(target);
+          coarse.edgeWeights.push_back(graph.edgeWeights[index]);
+        } else
+          coarse.edgeWeights[position[target]] += graph.edgeWeights[index];
+      }
+    }
+    coarse.offsets.push_back(coarse.adjacency.size());
+  }
+  return coarse;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::bisectRecursively(const GraphType& graph,
+  std::vector<IndexType> nodes, std::size_t firstPartition, std::size_t numberOfPartitions,
+  std::vector<IndexType>& partition) -> void {
+  assert(nodes.size() >= numberOfPartitions && "each partition must receive at least one node");
+  const auto left = static_cast<IndexType>(firstPartition);
+  if (numberOfPartitions == 1) {
+    for (const auto &node : nodes)
+      partition[node] = left;
+    return;
+  }
+
+  // on entry, all nodes of this subset carry firstPartition and no node outside of it carries a partition within
+  // [firstPartition, firstPartition + numberOfPartitions), so the partition array doubles as membership marker
+  const auto leftPartitions = numberOfPartitions / 2;
+  const auto rightPartitions = numberOfPartitions - leftPartitions;
+  const auto right = static_cast<IndexType>(firstPartition + leftPartitions);
+  auto totalWeight = std::size_t{0};
+  for (const auto &node : nodes) {
+    totalWeight += graph.vertexWeights[node];
+    partition[node] = right;
+  }
+
+  // each half keeps at least as many nodes as it has partitions, otherwise heavy nodes could leave a half empty
+  const auto minimumLeftNodes = leftPartitions;
+  const auto maximumLeftNodes = nodes.size() - rightPartitions;
+
+  // graph growing: breadth-first search from a seed, claiming nodes for the left half until it reaches its share
+  auto queue = std::vector<IndexType>{};
+  auto grownWeight = std::size_t{0};
+  auto grownNodes = std::size_t{0};
+  auto grow = [&](IndexType seed, auto&& isGrowing) {
+    queue.assign(1, seed);
+    partition[seed] = left;
+    grownWeight += graph.vertexWeights[seed];
+    ++grownNodes;
+    for (std::size_t head = 0; head < queue.size() && isGrowing(); ++head)
+      for (auto index = graph.offsets[queue[head]]; index < graph.offsets[queue[head] + 1]; ++index) {
+        auto neighbour = graph.adjacency[index];
+        if (partition[neighbour] == right && isGrowing()) {
+          partition[neighbour] = left;
+          grownWeight += graph.vertexWeights[neighbour];
+          ++grownNodes;
+          queue.push_back(neighbour);
+        }
+      }
+  };
+
+  // a full search from any node ends on a node far away from it, which is a better seed than the node itself
+  grow(nodes.front(), [] { return true; });
+  auto seed = queue.back();
+  for (const auto &node : nodes)
+    partition[node] = right;
+  grownWeight = 0;
+  grownNodes = 0;
+
+  auto targetWeight = (totalWeight * leftPartitions + numberOfPartitions / 2) / numberOfPartitions;
+  auto isGrowing = [&]() {
+    return (grownWeight < targetWeight || grownNodes < minimumLeftNodes) && grownNodes < maximumLeftNodes;
+  };
+  if (isGrowing())
+    grow(seed, isGrowing);
+  for (auto next = nodes.begin(); isGrowing() && next != nodes.end(); ++next)
+    if (partition[*next] == right)
+      grow(*next, isGrowing);
+
+  auto leftNodes = std::vector<IndexType>{};
+  auto rightNodes = std::vector<IndexType>{};
+  for (const auto &node : nodes)
+    (partition[node] == left ? leftNodes : rightNodes).push_back(node);
+  bisectRecursively(graph, std::move(leftNodes), firstPartition, leftPartitions, partition);
+  bisectRecursively(
+    graph, std::move(rightNodes), firstPartition + leftPartitions, numberOfPartitions - leftPartitions, partition);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::refine(
+  const GraphType& graph, std::size_t numberOfPartitions, std::vector<IndexType>& partition) -> void {
+  auto weights = std::vector<std::size_t>(numberOfPartitions, 0);
+  auto sizes = std::vector<std::size_t>(numberOfPartitions, 0);
+  for (std::size_t node = 0; node < graph.size(); ++node) {
+    weights[partition[node]] += graph.vertexWeights[node];
+    ++sizes[partition[node]];
+  }
+  auto totalWeight = std::accumulate(weights.begin(), weights.end(), std::size_t{0});
+  auto maximumWeight = static_cast<std::size_t>(
+    std::ceil(imbalanceTolerance_ * static_cast<double>(totalWeight) / static_cast<double>(numberOfPartitions)));
+
+  // connection[p] accumulates the weight of the edges from the current node into partition p
+  auto connection = std::vector<std::size_t>(numberOfPartitions, 0);
+  auto touched = std::vector<IndexType>{};
+  for (std::size_t pass = 0; pass < maximumRefinementPasses_; ++pass) {
+    auto numberOfMoves = std::size_t{0};
+    for (std::size_t node = 0; node < graph.size(); ++node) {
+      auto from = partition[node];
+      if (sizes[from] == 1)
+        continue;
+
+      touched.clear();
+      for (auto index = graph.offsets[node]; index < graph.offsets[node + 1]; ++index) {
+        auto neighbourPartition = partition[graph.adjacency[index]];
+        if (connection[neighbourPartition] == 0)
+          touched.push_back(neighbourPartition);
+        connection[neighbourPartition] += graph.edgeWeights[index];
+      }
+
+      // move to the partition that reduces the edge cut most, or keeps it and improves the balance
+      auto weight = graph.vertexWeights[node];
+      auto best = from;
+      auto bestGain = std::int64_t{0};
+      auto bestWeight = weights[from];
+      for (const auto &candidate : touched) {
+        if (candidate == from || weights[candidate] + weight > maximumWeight)
+          continue;
+        auto gain = static_cast<std::int64_t>(connection[candidate]) - static_cast<std::int64_t>(connection[from]);
+        if (gain > bestGain || (gain == bestGain && weights[candidate] + weight < bestWeight)) {
+          best = candidate;
+          bestGain = gain;
+          bestWeight = weights[candidate] + weight;
+        }
+      }
+      for (const auto &candidate : touched)
+        connection[candidate] = 0;
+
+      if (best != from) {
+        partition[node] = best;
+        weights[from] -= weight;
+        weights[best] += weight;
+        --sizes[from];
+        ++sizes[best];
+        ++numberOfMoves;
+      }
+    }
+    if (numberOfMoves == 0)
+      break;
+  }
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::partitionByCoordinateBisection(
+  const CoordinatesViewType& coordinates, const ConnectivityTableType& cells, std::size_t numberOfPartitions) -> void {
+  constexpr auto numberOfDimensions = static_cast<std::size_t>(Dimensions);
+  auto centroids = std::vector<std::array<double, numberOfDimensions>>(cells.size());
+  for (std::size_t cell = 0; cell < cells.size(); ++cell)
+    for (std::size_t dimension = 0; dimension < numberOfDimensions; ++dimension) {
+      auto sum = 0.0;
+      for (const auto &vertex : cells[cell])
+        sum += static_cast<double>(coordinates[dimension][vertex]);
+      centroids[cell][dimension] = sum / static_cast<double>(cells[cell].size());
+    }
+
+  // each entry holds the range [begin, end) of the cell order to split, the first partition and number of partitions
+  auto order = std::vector<IndexType>(cells.size());
+  std::iota(order.begin(), order.end(), IndexType{0});
+  cellPartition_.assign(cells.size(), 0);
+  auto ranges = std::vector<std::array<std::size_t, 4>>{{0, cells.size(), 0, numberOfPartitions}};
+  while (!ranges.empty()) {
+    auto [begin, end, firstPartition, partitions] = ranges.back();
+    ranges.pop_back();
+    if (partitions == 1) {
+      for (auto index = begin; index < end; ++index)
+        cellPartition_[order[index]] = static_cast<IndexType>(firstPartition);
+      continue;
+    }
+
+    auto lower = std::array<double, numberOfDimensions>{};
+    auto upper = std::array<double, numberOfDimensions>{};
+    lower.fill(std::numeric_limits<double>::max());
+    upper.fill(std::numeric_limits<double>::lowest());
+    for (auto index = begin; index < end; ++index)
+      for (std::size_t dimension = 0; dimension < numberOfDimensions; ++dimension) {
+        lower[dimension] = std::min(lower[dimension], centroids[order[index]][dimension]);
+        upper[dimension] = std::max(upper[dimension], centroids[order[index]][dimension]);
+      }
+    auto direction = std::size_t{0};
+    for (std::size_t dimension = 1; dimension < numberOfDimensions; ++dimension)
+      if (upper[dimension] - lower[dimension] > upper[direction] - lower[direction])
+        direction = dimension;
+
+    // the split point is placed so that both halves receive cells in proportion to their number of partitions
+    auto leftPartitions = partitions / 2;
+    auto middle = begin + (end - begin) * leftPartitions / partitions;
+    auto at = [&order](std::size_t index) { return order.begin() + static_cast<std::ptrdiff_t>(index); };
+    std::nth_element(at(begin), at(middle), at(end), [&centroids, direction](IndexType lhs, IndexType rhs) {
+      return centroids[lhs][direction] < centroids[rhs][direction];
+    });
+    ranges.push_back({begin, middle, firstPartition, leftPartitions});
+    ranges.push_back({middle, end, firstPartition + leftPartitions, partitions - leftPartitions});
+  }
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::partitionByMultilevelGraph(
+  const GraphType& graph, std::size_t numberOfPartitions) -> void {
+  // coarse graphs are kept by value and accessed by index, as references into the vector would not survive its growth
+  auto coarseGraphs = std::vector<GraphType>{};
+  auto coarseNodes = std::vector<std::vector<IndexType>>{};
+  auto getGraph = [&graph, &coarseGraphs](std::size_t level) -> const GraphType& {
+    return level == 0 ? graph : coarseGraphs[level - 1];
+  };
+
+  auto coarsestSize = std::max(coarsestNodesPerPartition_ * numberOfPartitions, std::size_t{128});
+  while (getGraph(coarseGraphs.size()).size() > coarsestSize) {
+    auto coarseNode = std::vector<IndexType>{};
+    auto coarse = coarsen(getGraph(coarseGraphs.size()), coarseNode);
+
+    // stop once matching no longer reduces the graph noticeably, e.g. for star-like graphs
+    if (10 * coarse.size() > 9 * getGraph(coarseGraphs.size()).size())
+      break;
+    coarseGraphs.push_back(std::move(coarse));
+    coarseNodes.push_back(std::move(coarseNode));
+  }
+
+  auto partition = partitionGraph(getGraph(coarseGraphs.size()), numberOfPartitions);
+
+  // project the partition back onto each finer graph and improve it there
+  for (auto level = coarseGraphs.size(); level-- > 0;) {
+    const auto &fine = getGraph(level);
+    auto finePartition = std::vector<IndexType>(fine.size());
+    for (std::size_t node = 0; node < fine.size(); ++node)
+      finePartition[node] = partition[coarseNodes[level][node]];
+    partition = std::move(finePartition);
+    refine(fine, numberOfPartitions, partition);
+  }
+  cellPartition_ = std::move(partition);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>::buildPartitions(
+  const GraphType& graph, std::size_t numberOfPartitions) -> void {
+  using HaloCellType = std::pair<IndexType, IndexType>;
+
+  // owned cells are visited in ascending global order, halo cells are collected as (owning partition, global cell)
+  partitions_.assign(numberOfPartitions, PartitionType{});
+  auto halos = std::vector<std::vector<HaloCellType>>(numberOfPartitions);
+  edgeCut_ = 0;
+  for (std::size_t cell = 0; cell < graph.size(); ++cell) {
+    auto owner = cellPartition_[cell];
+    partitions_[owner].localToGlobal.push_back(static_cast<IndexType>(cell));
+    for (auto index = graph.offsets[cell]; index < graph.offsets[cell + 1]; ++index) {
+      auto neighbour = graph.adjacency[index];
+      if (cellPartition_[neighbour] == owner)
+        continue;
+      halos[owner].emplace_back(cellPartition_[neighbour], neighbour);
+      if (cell < neighbour)
+        ++edgeCut_;
+    }
+  }
+
+  auto largestPartition = std::size_t{0};
+  for (std::size_t current = 0; current < numberOfPartitions; ++current) {
+    auto &partition = partitions_[current];
+    auto &halo = halos[current];
+    partition.numberOfOwnedCells = partition.localToGlobal.size();
+    largestPartition = std::max(largestPartition, partition.numberOfOwnedCells);
+
+    std::ranges::sort(halo);
+    auto duplicates = std::ranges::unique(halo);
+    halo.erase(duplicates.begin(), duplicates.end());
+
+    auto receiveList = std::vector<IndexType>{};
+    for (const auto &[owner, cell] : halo) {
+      if (partition.neighbours.empty() || partition.neighbours.back() != owner) {
+        if (!receiveList.empty())
+          partition.receiveLists.addCell(receiveList);
+        partition.neighbours.push_back(owner);
+        receiveList.clear();
+      }
+      receiveList.push_back(static_cast<IndexType>(partition.localToGlobal.size()));
+      partition.localToGlobal.push_back(cell);
+    }
+    if (!receiveList.empty())
+      partition.receiveLists.addCell(receiveList);
+  }
+
+  // the dual graph is symmetric, so the cells partition p sends to q are exactly the halo cells of q owned by p
+  for (std::size_t current = 0; current < numberOfPartitions; ++current) {
+    auto &partition = partitions_[current];
+    auto owned = std::span<const IndexType>{partition.localToGlobal}.first(partition.numberOfOwnedCells);
+    auto sendList = std::vector<IndexType>{};
+    for (const auto &neighbour : partition.neighbours) {
+      auto [first, last] =
+        std::ranges::equal_range(halos[neighbour], static_cast<IndexType>(current), {}, &HaloCellType::first);
+      sendList.clear();
+      for (auto haloCell = first; haloCell != last; ++haloCell)
+        sendList.push_back(static_cast<IndexType>(std::ranges::lower_bound(owned, haloCell->second) - owned.begin()));
+      partition.sendLists.addCell(sendList);
+    }
+  }
+
+  auto averagePartition = static_cast<double>(graph.size()) / static_cast<double>(numberOfPartitions);
+  imbalance_ = static_cast<double>(largestPartition) / averagePartition;
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+// explicit instantiation of the supported mesh dimensions, index and floating point types
+template class MeshPartitioning<AIM::Enum::Dimension::Two, std::uint32_t, float>;
+template class MeshPartitioning<AIM::Enum::Dimension::Two, std::uint32_t, double>;
+template class MeshPartitioning<AIM::Enum::Dimension::Two, std::uint64_t, float>;
+template class MeshPartitioning<AIM::Enum::Dimension::Two, std::uint64_t, double>;
+template class MeshPartitioning<AIM::Enum::Dimension::Three, std::uint32_t, float>;
+template class MeshPartitioning<AIM::Enum::Dimension::Three, std::uint32_t, double>;
+template class MeshPartitioning<AIM::Enum::Dimension::Three, std::uint64_t, float>;
+template class MeshPartitioning<AIM::Enum::Dimension::Three, std::uint64_t, double>;
+
+}  // namespace Mesh
+}  // end namespace AIM
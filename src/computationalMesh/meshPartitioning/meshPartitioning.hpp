@@ -0,0 +1,185 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/connectivityTable/connectivityTable.hpp"
+#include "src/computationalMesh/inverseConnectivity/inverseConnectivity.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class MeshPartitioning
+ * \brief Splits the cells of the mesh into balanced partitions and builds the halo (ghost cell) exchange lists
+ * \ingroup mesh
+ *
+ * To solve on several cores (threads or processes), each core works on its own partition of the cells and exchanges
+ * the values of the cells along the partition interfaces with its neighbours. This class assigns each cell to one of
+ * the requested number of partitions, using one of the following methods (see AIM::Enum::Partitioning):
+ *
+ * - RecursiveCoordinateBisection: the cell centroids are recursively split at the median along the direction
+ *   of largest extent. This is fast and produces compact partitions, but ignores the mesh connectivity.
+ * - MultilevelGraph: the cell dual graph (cells sharing a face, see AIM::Mesh::InverseConnectivity::getCellToCell()) is
+ *   coarsened by heavy-edge matching, the coarsest graph is split by recursive graph growing bisection, and the
+ *   partition is projected back level by level, improving it on each level with a greedy boundary refinement that moves
+ *   cells to the neighbouring partition they are most connected to, as long as the load stays balanced. This minimises
+ *   the number of dual graph edges cut by the partition interfaces (the edge cut), i.e. the amount of halo data.
+ *
+ * The bisection step is available on its own through partitionGraph(), which splits any graph with weighted vertices
+ * and edges (given in compressed adjacency form) into the requested number of partitions. Each half of a bisection
+ * keeps at least as many vertices as partitions it is split into further, so no partition is ever left empty, even if
+ * a few heavy vertices carry most of the weight.
+ *
+ * For each partition, the cells it owns are stored first in its local to global map (in ascending global order),
+ * followed by one layer of halo cells, i.e. face neighbours owned by other partitions, grouped by their owning
+ * partition. The send and receive lists of a partition hold one row per neighbouring partition (in the order of its
+ * neighbours), with the local indices of the owned cells to send and of the halo cells to receive, respectively.
+ * Both lists are sorted by global cell index, so that the send list of partition p towards q matches the receive list
+ * of q from p entry by entry.
+ *
+ * When constructed from an AIM::Mesh::ComputationalMesh, the method and number of partitions are read from the
+ * parameters "/mesh/partitioning/method" ("recursiveCoordinateBisection" or "multilevelGraph", default) and
+ * "/mesh/partitioning/numberOfPartitions" (defaults to the number of threads of the AIM::Utilities::ThreadPool, see
+ * "/parallel/numberOfThreads", limited by the number of cells).
+ *
+ * \code
+ * auto partitioning = AIM::Mesh::MeshPartitioning{mesh};
+ * const auto &partition = partitioning.getPartition(0);
+ *
+ * // exchange halo data with all neighbouring partitions
+ * for (std::size_t neighbour = 0; neighbour < partition.neighbours.size(); ++neighbour) {
+ *   for (const auto &localCell : partition.sendLists[neighbour])
+ *     sendBuffer.push_back(solution[partition.localToGlobal[localCell]]);
+ *   ...
+ * }
+ * std::cout << "edge cut: " << partitioning.getEdgeCut() << ", imbalance: " << partitioning.getImbalance()
+ *           << std::endl;
+ * \endcode
+ */
+
+template <int Dimensions, typename UnsignedInteger = AIM::Types::UInt, typename FloatingPoint = AIM::Types::FloatType>
+class MeshPartitioning {
+  static_assert(AIM::Types::MeshIndexType<UnsignedInteger>, "mesh indices must be 32-bit or 64-bit unsigned");
+  static_assert(AIM::Types::MeshFloatType<FloatingPoint>, "mesh coordinates must be stored as float or double");
+
+  /// \name Custom types used in this class
+  /// @{
+public:
+  using IndexType = UnsignedInteger;
+  using FloatType = FloatingPoint;
+  using CoordinateViewType = std::span<const FloatType>;
+  using CoordinatesViewType = std::array<CoordinateViewType, static_cast<std::size_t>(Dimensions)>;
+  using ConnectivityTableType = ConnectivityTable<IndexType>;
+  using InverseConnectivityType = InverseConnectivity<Dimensions, UnsignedInteger>;
+  using ComputationalMeshType = ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>;
+
+  struct PartitionType {
+    std::vector<IndexType> localToGlobal;
+    std::size_t numberOfOwnedCells{0};
+    std::vector<IndexType> neighbours;
+    ConnectivityTableType sendLists;
+    ConnectivityTableType receiveLists;
+  };
+
+  struct GraphType {
+    std::vector<std::size_t> offsets{0};
+    std::vector<IndexType> adjacency;
+    std::vector<std::size_t> edgeWeights;
+    std::vector<std::size_t> vertexWeights;
+    auto size() const -> std::size_t { return vertexWeights.size(); }
+  };
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  MeshPartitioning(AIM::Enum::Partitioning method, std::size_t numberOfPartitions,
+    const CoordinatesViewType& coordinates, const ConnectivityTableType& cells);
+  MeshPartitioning(const ComputationalMeshType& mesh);
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  static auto getMethodFromString(const std::string& method) -> AIM::Enum::Partitioning;
+  static auto partitionGraph(const GraphType& graph, std::size_t numberOfPartitions) -> std::vector<IndexType>;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getNumberOfPartitions() const -> std::size_t { return partitions_.size(); }
+  auto getCellPartition() const -> std::span<const IndexType> { return cellPartition_; }
+  auto getPartition(std::size_t partition) const -> const PartitionType& { return partitions_[partition]; }
+  auto getPartitions() const -> const std::vector<PartitionType>& { return partitions_; }
+  auto getEdgeCut() const -> std::size_t { return edgeCut_; }
+  auto getImbalance() const -> double { return imbalance_; }
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  static auto readMethod() -> AIM::Enum::Partitioning;
+  static auto readNumberOfPartitions(std::size_t numberOfCells) -> std::size_t;
+  static auto getCoordinates(const ComputationalMeshType& mesh) -> CoordinatesViewType;
+  static auto buildDualGraph(const ConnectivityTableType& cells) -> GraphType;
+  static auto coarsen(const GraphType& graph, std::vector<IndexType>& coarseNode) -> GraphType;
+  static auto bisectRecursively(const GraphType& graph, std::vector<IndexType> nodes, std::size_t firstPartition,
+    std::size_t numberOfPartitions, std::vector<IndexType>& partition) -> void;
+  static auto refine(const GraphType& graph, std::size_t numberOfPartitions, std::vector<IndexType>& partition) -> void;
+  auto partitionByCoordinateBisection(const CoordinatesViewType& coordinates, const ConnectivityTableType& cells,
+    std::size_t numberOfPartitions) -> void;
+  auto partitionByMultilevelGraph(const GraphType& graph, std::size_t numberOfPartitions) -> void;
+  auto buildPartitions(const GraphType& graph, std::size_t numberOfPartitions) -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  // allowed ratio between the largest partition and the average partition size during refinement
+  static constexpr double imbalanceTolerance_{1.03};
+
+  // the graph is coarsened until it has fewer nodes than this factor times the number of partitions (at least 128)
+  static constexpr std::size_t coarsestNodesPerPartition_{20};
+  static constexpr std::size_t maximumRefinementPasses_{8};
+
+  std::vector<IndexType> cellPartition_;
+  std::vector<PartitionType> partitions_;
+  std::size_t edgeCut_{0};
+  double imbalance_{1.0};
+  /// @}
+};
+
+/// \name Deduction guide, so that the dimension and types are taken from the computational mesh
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+MeshPartitioning(const ComputationalMesh<Dimensions, UnsignedInteger, FloatingPoint>&)
+  -> MeshPartitioning<Dimensions, UnsignedInteger, FloatingPoint>;
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "meshPartitioning.tpp"
@@ -0,0 +1,113 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <utility>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/meshPrefetch/meshPrefetch.hpp"
+#include "src/parameterFileReading/parameterRegistry.hpp"
+#include "src/types/enums.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+MeshPrefetch<Dimensions, UnsignedInteger, FloatingPoint>::MeshPrefetch()
+  : meshReader_(std::make_unique<MeshReaderType>()) {
+  readParameters();
+
+  // the connectivity table is scheduled first as it takes longest to read and convert
+  connectivityTable_ = schedule([this]() { return meshReader_->readConnectivityTable(); });
+  MeshReaderType::forEachCoordinate([this](auto index) {
+    coordinates_[decltype(index)::value] =
+      schedule([this]() { return meshReader_->template readCoordinate<decltype(index)::value>(); });
+  });
+  boundaryConditionInfo_ = schedule([this]() { return meshReader_->readBoundaryConditions(); });
+  boundaryConditionConnectivity_ = schedule([this]() { return meshReader_->readBoundaryConditionConnectivity(); });
+  boundaryFaceConnectivity_ = schedule([this]() { return meshReader_->readBoundaryFaceConnectivity(); });
+
+  launch();
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+MeshPrefetch<Dimensions, UnsignedInteger, FloatingPoint>::~MeshPrefetch() {
+  // the reader must not be destroyed while background threads are still using it
+  for (auto &worker : workers_)
+    if (worker.valid())
+      worker.wait();
+}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPrefetch<Dimensions, UnsignedInteger, FloatingPoint>::wait() const -> void {
+  for (const auto &worker : workers_)
+    if (worker.valid())
+      worker.wait();
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPrefetch<Dimensions, UnsignedInteger, FloatingPoint>::readParameters() -> void {
+  auto parameters = AIM::Parameters::ParameterRegistry{"input/aim.json"};
+  auto useParallelLoading = parameters.declare<bool>("/mesh/parallelLoading", false);
+  parameters.validate();
+
+  useParallelLoading_ = parameters.get(useParallelLoading);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshPrefetch<Dimensions, UnsignedInteger, FloatingPoint>::launch() -> void {
+  if (useParallelLoading_) {
+    for (auto &task : tasks_)
+      workers_.push_back(std::async(std::launch::async, std::move(task)));
+  } else {
+    workers_.push_back(std::async(std::launch::async, [tasks = std::move(tasks_)]() mutable {
+      for (auto &task : tasks)
+        task();
+    }));
+  }
+  tasks_.clear();
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+// explicit instantiation of the supported mesh dimensions, index and floating point types
+template class MeshPrefetch<AIM::Enum::Dimension::Two, std::uint32_t, float>;
+template class MeshPrefetch<AIM::Enum::Dimension::Two, std::uint32_t, double>;
+template class MeshPrefetch<AIM::Enum::Dimension::Two, std::uint64_t, float>;
+template class MeshPrefetch<AIM::Enum::Dimension::Two, std::uint64_t, double>;
+template class MeshPrefetch<AIM::Enum::Dimension::Three, std::uint32_t, float>;
+template class MeshPrefetch<AIM::Enum::Dimension::Three, std::uint32_t, double>;
+template class MeshPrefetch<AIM::Enum::Dimension::Three, std::uint64_t, float>;
+template class MeshPrefetch<AIM::Enum::Dimension::Three, std::uint64_t, double>;
+
+}  // namespace Mesh
+}  // end namespace AIM
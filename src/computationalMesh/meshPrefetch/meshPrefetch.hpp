@@ -0,0 +1,136 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <array>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/types/types.hpp"
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class MeshPrefetch
+ * \brief Starts reading the mesh in the background on construction and hands out futures for each mesh component
+ * \ingroup mesh
+ *
+ * Reading the mesh is typically the most expensive part of the start-up phase. Instead of blocking on the mesh I/O
+ * after the parameters have been read and the solver has been set up, a MeshPrefetch object can be created as early as
+ * possible. Its constructor opens the mesh file and immediately schedules the reads of the coordinates, the
+ * connectivity table and the boundary data on background threads, so that the rest of the start-up phase overlaps with
+ * the disk reads. Each mesh component is exposed as a std::shared_future that becomes ready as soon as that component
+ * has been read. If "/mesh/parallelLoading" is set to true in the parameter file, each component is read on its own
+ * thread, otherwise all components are read one after another on a single background thread.
+ *
+ * Exceptions thrown while reading are stored in the futures and rethrown when get() is called on them. The destructor
+ * waits for all outstanding reads, the futures themselves remain valid after the MeshPrefetch object is destroyed.
+ *
+ * \code
+ * auto meshPrefetch = AIM::Mesh::MeshPrefetch<AIM::Enum::Dimension::Two>{};
+ *
+ * // set up the rest of the solver while the mesh is read in the background
+ * ...
+ *
+ * // either consume the individual components (blocks until the component is available) ...
+ * auto x = meshPrefetch.getCoordinate<AIM::Enum::Coordinate::X>().get();
+ *
+ * // ... or construct the computational mesh from it
+ * auto mesh = AIM::Mesh::ComputationalMesh{meshPrefetch};
+ * \endcode
+ */
+
+template <int Dimensions, typename UnsignedInteger = AIM::Types::UInt, typename FloatingPoint = AIM::Types::FloatType>
+class MeshPrefetch {
+  /// \name Custom types used in this class
+  /// @{
+public:
+  template <typename ValueType>
+  using FutureType = std::shared_future<ValueType>;
+  using MeshReaderType = MeshReader<Dimensions, UnsignedInteger, FloatingPoint>;
+  using CoordinateType = typename MeshReaderType::CoordinateType;
+  using ConnectivityTableType = typename MeshReaderType::ConnectivityTableType;
+  using BoundaryConditionType = typename MeshReaderType::BoundaryConditionType;
+  using BoundaryConditionConnectivityType = typename MeshReaderType::BoundaryConditionConnectivityType;
+  using BoundaryFaceConnectivityType = typename MeshReaderType::BoundaryFaceConnectivityType;
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  MeshPrefetch();
+  MeshPrefetch(const MeshPrefetch& other) = delete;
+  ~MeshPrefetch();
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  auto wait() const -> void;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getMeshReader() const -> const MeshReaderType& { return *meshReader_; }
+  template <int Index>
+  auto getCoordinate() const -> FutureType<CoordinateType>;
+  auto getConnectivityTable() const -> FutureType<ConnectivityTableType> { return connectivityTable_; }
+  auto getBoundaryConditionInfo() const -> FutureType<BoundaryConditionType> { return boundaryConditionInfo_; }
+  auto getBoundaryConditionConnectivity() const -> FutureType<BoundaryConditionConnectivityType> {
+    return boundaryConditionConnectivity_;
+  }
+  auto getBoundaryFaceConnectivity() const -> FutureType<BoundaryFaceConnectivityType> {
+    return boundaryFaceConnectivity_;
+  }
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const MeshPrefetch& other) -> MeshPrefetch& = delete;
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  auto readParameters() -> void;
+  template <typename ReadFunction>
+  auto schedule(ReadFunction&& read) -> FutureType<std::invoke_result_t<ReadFunction>>;
+  auto launch() -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  bool useParallelLoading_{false};
+  std::unique_ptr<MeshReaderType> meshReader_;
+
+  std::array<FutureType<CoordinateType>, static_cast<std::size_t>(Dimensions)> coordinates_;
+  FutureType<ConnectivityTableType> connectivityTable_;
+  FutureType<BoundaryConditionType> boundaryConditionInfo_;
+  FutureType<BoundaryConditionConnectivityType> boundaryConditionConnectivity_;
+  FutureType<BoundaryFaceConnectivityType> boundaryFaceConnectivity_;
+
+  std::vector<std::packaged_task<void()>> tasks_;
+  std::vector<std::future<void>> workers_;
+  /// @}
+};
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "meshPrefetch.tpp"
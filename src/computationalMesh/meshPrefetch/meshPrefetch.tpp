@@ -0,0 +1,61 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <future>
+#include <type_traits>
+#include <utility>
+
+// third-party include headers
+
+// AIM include headers
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+
+/// @}
+
+/// \name Getters and setters
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+template <int Index>
+auto MeshPrefetch<Dimensions, UnsignedInteger, FloatingPoint>::getCoordinate() const -> FutureType<CoordinateType> {
+  static_assert(Index >= 0 && Index < Dimensions, "coordinate index must be smaller than the mesh dimension");
+  return coordinates_[Index];
+}
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+template <typename ReadFunction>
+auto MeshPrefetch<Dimensions, UnsignedInteger, FloatingPoint>::schedule(
+  ReadFunction&& read) -> FutureType<std::invoke_result_t<ReadFunction>> {
+  auto task = std::packaged_task<std::invoke_result_t<ReadFunction>()>{std::forward<ReadFunction>(read)};
+  auto future = task.get_future().share();
+  tasks_.emplace_back(std::move(task));
+  return future;
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Mesh
+}  // end namespace AIM
@@ -4,95 +4,205 @@
 
 // c++ include headers
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <exception>
 #include <filesystem>
+#include <future>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 // third-party include headers
 #include "cgnslib.h"
 
 // AIM include headers
+#include "src/computationalMesh/cgnsFileHandle/cgnsFileHandle.hpp"
+#include "src/computationalMesh/cgnsFileHandlePool/cgnsFileHandlePool.hpp"
 #include "src/computationalMesh/meshReading/meshReading.hpp"
-#include "src/parameterFileReading/parameterFileReading.hpp"
+#include "src/parameterFileReading/parameterRegistry.hpp"
 #include "src/types/enums.hpp"
 #include "src/types/types.hpp"
 #include "src/utilities/fileChecker/fileChecker.hpp"
+#include "src/utilities/hardwareCounters/hardwareCounters.hpp"
+#include "src/utilities/instrumentation/instrumentation.hpp"
+#include "src/utilities/scratchArena/scratchArena.hpp"
 
 namespace AIM {
 namespace Mesh {
 
 /// \name Constructors and destructors
 /// @{
-MeshReader::MeshReader(short int dimensions) : dimensions_(dimensions) {
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::MeshReader() {
+  AIM_INSTRUMENT_SCOPE("MeshReader::setup");
   readParameters();
-  assert(dimensions_ == AIM::Enum::Dimension::Two && "Currently only 2D meshes are supported");
+  if (useDirectHDF5Reading_ && HDF5BulkReader::isHDF5File(meshFile_))
+    hdf5Reader_ = std::make_shared<const HDF5BulkReader>(meshFile_);
 
-  auto errorCode = cg_open(meshFile_.string().c_str(), CG_MODE_READ, &fileIndex_);
-  assert(errorCode == 0 && "Error reading CGNS file");
+  fileHandlePool_ = std::make_shared<CGNSFileHandlePool>(meshFile_);
+  auto fileHandle = fileHandlePool_->acquire();
+  auto fileIndex = fileHandle.getIndex();
+  auto lock = std::unique_lock{CGNSFileHandle::getLibraryMutex()};
 
-  assert(getNumberOfBases() == 1 && "Currently only single-base mesh is supported");
-  assert(getNumberOfZones() == 1 && "Currently only single-zone mesh is supported");
+  readZones(fileIndex);
+  readZoneBoundaries(fileIndex);
+  auto interfaceVertices = readInterfaceVertices(fileIndex);
+  lock.unlock();
 
-  numberOfVertices_ = getNumberOfVertices();
-  numberOfCells_ = getNumberOfCells();
-  numberOfBCs_ = getNumberOfBoundaryConditions();
-  numberOfFamilies_ = getNumberOfFamilies();
+  // vertices are only renumbered if zones share vertices, otherwise they are simply concatenated zone by zone
+  numberOfVertices_ = zones_.back().firstVertex + zones_.back().numberOfVertices;
+  if (!interfaceVertices.empty()) {
+    auto vertexMap = mergeInterfaceVertices(numberOfVertices_, interfaceVertices);
+    numberOfVertices_ = vertexMap.empty() ? 0 : static_cast<std::size_t>(*std::ranges::max_element(vertexMap)) + 1;
+    vertexMap_ = std::make_shared<const std::vector<IndexType>>(std::move(vertexMap));
+  }
+  checkIndexTypeIsWideEnough(numberOfVertices_, "vertices");
 }
-
-// TODO: add error checking, if destructor called twice, error will be raised
-MeshReader::~MeshReader() { cg_close(fileIndex_); }
 /// @}
 
 /// \name API interface that exposes behaviour to the caller
 /// @{
-auto MeshReader::readConnectivityTable() -> ConnectivityTableType {
-  auto connectivity = MeshReader::ConnectivityTableType{};
-  connectivity.reserve(numberOfCells_);
-
-  auto numberOfSections = getNumberOfSections();
-  for (AIM::Types::UInt section = 0; section < numberOfSections; ++section) {
-    auto cellType = getCellType(section);
-    if (dimensions_ == AIM::Enum::Dimension::Two) {
-      if (cellType == CGNS_ENUMV(TRI_3)) addCurrentCellTypeToConnectivityTable(section, 3u, connectivity);
-      if (cellType == CGNS_ENUMV(QUAD_4)) addCurrentCellTypeToConnectivityTable(section, 4u, connectivity);
-    } else if (dimensions_ == AIM::Enum::Dimension::Three) {
-      throw std::runtime_error("currently 3D mesh reading is not implemented");
-    }
-  }
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readConnectivityTable() -> ConnectivityTableType {
+  AIM_PROFILE_SCOPE("MeshReader::readConnectivityTable");
+  if (zones_.size() == 1 && !vertexMap_)
+    return readZoneConnectivityTable(zones_.front());
 
-  return connectivity;
+  auto zoneCells = std::vector<ConnectivityTableType>(zones_.size());
+  forEachZoneConcurrently([this, &zoneCells](std::size_t zone) {
+    zoneCells[zone] = readZoneConnectivityTable(zones_[zone]);
+  });
+  return mergeZoneConnectivityTables(zoneCells);
 }
 
-auto MeshReader::readBoundaryConditions() -> BoundaryConditionType {
-  auto bc = BoundaryConditionType{};
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readBoundaryConditions() -> BoundaryConditionType {
+  AIM_INSTRUMENT_SCOPE("MeshReader::readBoundaryConditions");
+  auto bc = BoundaryConditionType(numberOfBCs_);
+  auto fileHandle = fileHandlePool_->acquire();
+  auto fileIndex = fileHandle.getIndex();
+  auto lock = std::scoped_lock{CGNSFileHandle::getLibraryMutex()};
 
-  for (AIM::Types::UInt boundary = 0; boundary < numberOfBCs_; ++boundary) {
-    auto [boundaryConditionType, boundaryName, _] = getCurrentBoundaryType(boundary);
-    if (boundaryConditionType == CGNS_ENUMV(FamilySpecified)) {
-      auto familyBCType = getCurrentFamilyType(boundary);
-      if (familyBCType == CGNS_ENUMV(BCWall))
-        bc.push_back(std::make_pair(AIM::Enum::BoundaryCondition::Wall, boundaryName));
-      if (familyBCType == CGNS_ENUMV(BCSymmetryPlane))
-        bc.push_back(std::make_pair(AIM::Enum::BoundaryCondition::Symmetry, boundaryName));
-      if (familyBCType == CGNS_ENUMV(BCInflow))
-        bc.push_back(std::make_pair(AIM::Enum::BoundaryCondition::Inlet, boundaryName));
-      if (familyBCType == CGNS_ENUMV(BCOutflow))
-        bc.push_back(std::make_pair(AIM::Enum::BoundaryCondition::Outlet, boundaryName));
-    }
+  // boundaries merged from several zones take their type from the first zone they appear in
+  auto isRead = std::vector<bool>(numberOfBCs_, false);
+  for (const auto &[zone, boundary, mergedBoundary] : zoneBoundaries_) {
+    if (isRead[mergedBoundary])
+      continue;
+    isRead[mergedBoundary] = true;
+    auto [boundaryConditionType, boundaryName, _] = getCurrentBoundaryType(fileIndex, zones_[zone], boundary);
+    if (boundaryConditionType == CGNS_ENUMV(FamilySpecified))
+      boundaryConditionType = getCurrentFamilyType(fileIndex, zones_[zone], boundary);
+    bc[mergedBoundary] = std::make_pair(toBoundaryCondition(boundaryConditionType), boundaryName);
   }
 
   return bc;
 }
-auto MeshReader::readBoundaryConditionConnectivity() -> BoundaryConditionConnectivityType {
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readBoundaryConditionConnectivity()
+  -> BoundaryConditionConnectivityType {
+  AIM_INSTRUMENT_SCOPE("MeshReader::readBoundaryConditionConnectivity");
   auto bcc = BoundaryConditionConnectivityType(numberOfBCs_);
-  for (AIM::Types::UInt boundary = 0; boundary < numberOfBCs_; ++boundary)
-    writeBoundaryConnectivityIntoArray(boundary, bcc);
+  auto numberOfZonesPerBoundary = std::vector<std::size_t>(numberOfBCs_, 0);
+  for (const auto &[zone, boundary, mergedBoundary] : zoneBoundaries_)
+    ++numberOfZonesPerBoundary[mergedBoundary];
+
+  // element ranges of boundaries that are merged from several zones are expanded, so that they can be concatenated
+  auto fileHandle = fileHandlePool_->acquire();
+  auto fileIndex = fileHandle.getIndex();
+  auto lock = std::scoped_lock{CGNSFileHandle::getLibraryMutex()};
+  for (const auto &[zone, boundary, mergedBoundary] : zoneBoundaries_) {
+    auto expandRanges = numberOfZonesPerBoundary[mergedBoundary] > 1;
+    for (auto element : readBoundaryElements(fileIndex, zones_[zone], boundary, expandRanges))
+      bcc[mergedBoundary].push_back(element + zones_[zone].elementOffset);
+  }
   return bcc;
 }
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readBoundaryFaceConnectivity()
+  -> BoundaryFaceConnectivityType {
+  AIM_INSTRUMENT_SCOPE("MeshReader::readBoundaryFaceConnectivity");
+  if (zones_.size() == 1 && !vertexMap_ && numberOfBCs_ == zones_.front().numberOfBCs)
+    return readZoneBoundaryFaceConnectivity(zones_.front());
+
+  auto zoneFaces = std::vector<BoundaryFaceConnectivityType>(zones_.size());
+  forEachZoneConcurrently([this, &zoneFaces](std::size_t zone) {
+    zoneFaces[zone] = readZoneBoundaryFaceConnectivity(zones_[zone]);
+  });
+
+  auto boundaryFaces = BoundaryFaceConnectivityType(numberOfBCs_);
+  for (const auto &[zone, boundary, mergedBoundary] : zoneBoundaries_) {
+    auto toMerged = std::views::transform([this, &zoneInfo = zones_[zone]](IndexType vertex) {
+      return toMergedVertex(zoneInfo, vertex);
+    });
+    for (const auto &face : zoneFaces[zone][boundary])
+      boundaryFaces[mergedBoundary].addCell(face | toMerged);
+  }
+  return boundaryFaces;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::mergeInterfaceVertices(
+  std::size_t numberOfVertices, const InterfaceVerticesType& interfaceVertices) -> std::vector<IndexType> {
+  // vertices connected through interfaces form sets, each set is represented by its lowest vertex (union-find)
+  auto scratch = AIM::Utilities::ScratchScope{};
+  auto representative = std::pmr::vector<std::size_t>(numberOfVertices, scratch.getResource());
+  std::iota(representative.begin(), representative.end(), std::size_t{0});
+  auto find = [&representative](std::size_t vertex) {
+    while (representative[vertex] != vertex) {
+      representative[vertex] = representative[representative[vertex]];
+      vertex = representative[vertex];
+    }
+    return vertex;
+  };
+  for (const auto &[vertex, donorVertex] : interfaceVertices) {
+    if (vertex >= numberOfVertices || donorVertex >= numberOfVertices)
+      throw std::runtime_error("interface vertex " + std::to_string(std::max(vertex, donorVertex)) +
+                               " is out of range, the mesh has " + std::to_string(numberOfVertices) + " vertices");
+    auto first = find(vertex);
+    auto second = find(donorVertex);
+    if (first < second)
+      representative[second] = first;
+    else
+      representative[first] = second;
+  }
+
+  // representatives are numbered in their original order, all other vertices take the number of their representative,
+  // which always comes before them and is therefore already numbered
+  auto vertexMap = std::vector<IndexType>(numberOfVertices);
+  auto numberOfMergedVertices = std::size_t{0};
+  for (std::size_t vertex = 0; vertex < numberOfVertices; ++vertex) {
+    auto root = find(vertex);
+    vertexMap[vertex] = root == vertex ? static_cast<IndexType>(numberOfMergedVertices++) : vertexMap[root];
+  }
+  return vertexMap;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readMeshFileName() -> std::filesystem::path {
+  auto parameters = AIM::Parameters::ParameterRegistry{"input/aim.json"};
+  auto meshFile =
+    parameters.declare<std::filesystem::path>("/mesh/filename", std::filesystem::path{"input/mesh.cgns"});
+  parameters.validate();
+
+  AIM::Utilities::FileChecker::checkIfFileExists(parameters.get(meshFile));
+  return parameters.get(meshFile);
+}
 /// @}
 
 /// \name Getters and setters
@@ -107,68 +217,493 @@ auto MeshReader::readBoundaryConditionConnectivity() -> BoundaryConditionConnect
 
 /// \name Private or protected implementation details, not exposed to the caller
 /// @{
-auto MeshReader::readParameters() -> void {
-  auto inputFile = std::filesystem::path{"input/aim.json"};
-  auto parameter = std::string{"/mesh/filename"};
-  auto defaultValue = std::filesystem::path{"input/mesh.cgns"};
-  meshFile_ = AIM::Parameters::ParameterFileReading::readParameterOrGetDefaultValue<std::filesystem::path>(
-    inputFile, parameter, defaultValue);
-  AIM::Utilities::FileChecker::checkIfFileExists(meshFile_);
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readZoneConnectivityTable(const ZoneInfoType& zone)
+  -> ConnectivityTableType {
+  AIM_INSTRUMENT_SCOPE("readZoneConnectivityTable");
+  auto fileHandle = fileHandlePool_->acquire();
+  auto fileIndex = fileHandle.getIndex();
+  auto lock = std::unique_lock{CGNSFileHandle::getLibraryMutex()};
+  auto cellSections = getCellSections(fileIndex, zone);
+  auto mixedSections = getMixedSections(fileIndex, zone);
+  auto numberOfCells = std::size_t{0};
+  auto numberOfIndices = std::size_t{0};
+  auto largestSectionSize = std::size_t{0};
+  for (const auto &[section, numberOfVerticesPerCell, elementSize] : cellSections) {
+    numberOfCells += elementSize / numberOfVerticesPerCell;
+    numberOfIndices += elementSize;
+    largestSectionSize = std::max(largestSectionSize, elementSize);
+  }
+
+  checkIndexTypeIsWideEnough(numberOfIndices, "connectivity entries");
+
+  // cells of mixed sections are sorted into the groups of the homogeneous sections, so all raw CGNS integers are kept
+  // until every section is read
+  if (!mixedSections.empty()) {
+    auto rawIndices = std::vector<AIM::Types::CGNSInt>(numberOfIndices);
+    auto indexOffset = std::size_t{0};
+    for (const auto &[section, numberOfVerticesPerCell, elementSize] : cellSections) {
+      readElementsIntoBuffer(fileIndex, zone, section, std::span{rawIndices}.subspan(indexOffset, elementSize), lock);
+      indexOffset += elementSize;
+    }
+
+    auto mixedElements = std::vector<std::vector<AIM::Types::CGNSInt>>{};
+    for (const auto &[section, elementSize] : mixedSections) {
+      mixedElements.emplace_back(elementSize);
+      readElementsIntoBuffer(fileIndex, zone, section, mixedElements.back(), lock);
+    }
+    lock.unlock();
+    return groupCellsByElementType(cellSections, rawIndices.data(), mixedElements);
+  }
+
+  // otherwise, the indices array is allocated with its final size and each section is read into its own part of it,
+  // in the order returned by getCellSections(), i.e. grouped by element type. Raw CGNS integers that are not wider
+  // than the index type fit into that part and are converted in place once the file is no longer needed. Wider
+  // integers don't fit, they are read into a buffer of the size of the largest section and narrowed right away
+  auto indices = std::vector<IndexType>(numberOfIndices);
+  auto sectionBuffer = std::vector<AIM::Types::CGNSInt>{};
+  if constexpr (sizeof(AIM::Types::CGNSInt) > sizeof(IndexType))
+    sectionBuffer.resize(largestSectionSize);
+
+  auto indexOffset = std::size_t{0};
+  for (const auto &[section, numberOfVerticesPerCell, elementSize] : cellSections) {
+    auto sectionIndices = std::span{indices}.subspan(indexOffset, elementSize);
+    if constexpr (sizeof(AIM::Types::CGNSInt) > sizeof(IndexType)) {
+      auto rawIndices = std::span{sectionBuffer}.first(elementSize);
+      readElementsIntoBuffer(fileIndex, zone, section, rawIndices, lock);
+      convertToZeroBasedIndices(rawIndices, sectionIndices);
+    } else {
+      auto rawIndices = reinterpret_cast<AIM::Types::CGNSInt *>(sectionIndices.data());
+      readElementsIntoBuffer(fileIndex, zone, section, std::span{rawIndices, elementSize}, lock);
+    }
+    indexOffset += elementSize;
+  }
+
+  // all data is read from the file, the remaining work does not require the CGNS library and can overlap with reads
+  // issued from other threads
+  lock.unlock();
+
+  auto offsets = std::vector<IndexType>(numberOfCells + 1);
+  auto cellOffset = std::size_t{0};
+  indexOffset = 0;
+  for (const auto &[section, numberOfVerticesPerCell, elementSize] : cellSections) {
+    auto numberOfElements = elementSize / numberOfVerticesPerCell;
+    for (std::size_t i = 1; i <= numberOfElements; ++i)
+      offsets[cellOffset + i] = static_cast<IndexType>(indexOffset + i * numberOfVerticesPerCell);
+    if constexpr (sizeof(AIM::Types::CGNSInt) <= sizeof(IndexType))
+      convertToZeroBasedIndicesInPlace(std::span{indices}.subspan(indexOffset, elementSize));
+    cellOffset += numberOfElements;
+    indexOffset += elementSize;
+  }
+  return ConnectivityTableType{std::move(offsets), std::move(indices)};
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readZoneBoundaryFaceConnectivity(
+  const ZoneInfoType& zone) -> BoundaryFaceConnectivityType {
+  AIM_INSTRUMENT_SCOPE("readZoneBoundaryFaceConnectivity");
+  auto scratch = AIM::Utilities::ScratchScope{};
+  auto fileHandle = fileHandlePool_->acquire();
+  auto fileIndex = fileHandle.getIndex();
+  auto lock = std::unique_lock{CGNSFileHandle::getLibraryMutex()};
+
+  // all face sections are read at once, boundary elements are then looked up by their element index
+  // mixed sections are stored with zero vertices per face, their faces are located through the element offsets below
+  auto numberOfSections = getNumberOfSections(fileIndex, zone);
+  auto faceSections =
+    std::pmr::vector<std::tuple<AIM::Types::CGNSInt, AIM::Types::CGNSInt, AIM::Types::UInt>>{scratch.getResource()};
+  auto faceElements = std::pmr::vector<std::pmr::vector<AIM::Types::CGNSInt>>{scratch.getResource()};
+  faceSections.reserve(numberOfSections);
+  faceElements.reserve(numberOfSections);
+  for (AIM::Types::UInt section = 0; section < numberOfSections; ++section) {
+    auto faceType = getCellType(fileIndex, zone, section);
+    auto numberOfVerticesPerFace = getNumberOfVerticesPerFace(faceType);
+    if (numberOfVerticesPerFace > 0 || faceType == CGNS_ENUMV(MIXED)) {
+      auto elementSize = faceType == CGNS_ENUMV(MIXED)
+        ? getElementDataSize(fileIndex, zone, section)
+        : getNumberOfConnectivitiesForCellType(fileIndex, zone, section, numberOfVerticesPerFace);
+      auto firstElement = getFirstElementOfSection(fileIndex, zone, section);
+      auto lastElement = numberOfVerticesPerFace > 0
+        ? firstElement + static_cast<AIM::Types::CGNSInt>(elementSize / numberOfVerticesPerFace) - 1
+        : firstElement;
+      faceSections.emplace_back(firstElement, lastElement, numberOfVerticesPerFace);
+      faceElements.emplace_back(elementSize);
+      readElementsIntoBuffer(fileIndex, zone, section, faceElements.back(), lock);
+    }
+  }
+
+  auto boundaryElements = std::vector<std::vector<AIM::Types::CGNSInt>>(zone.numberOfBCs);
+  for (AIM::Types::UInt boundary = 0; boundary < zone.numberOfBCs; ++boundary)
+    boundaryElements[boundary] = readBoundaryElements(fileIndex, zone, boundary, true);
+  lock.unlock();
+
+  auto mixedElementOffsets = std::vector<std::vector<std::size_t>>(faceSections.size());
+  for (std::size_t section = 0; section < faceSections.size(); ++section) {
+    auto &[firstElement, lastElement, numberOfVerticesPerFace] = faceSections[section];
+    if (numberOfVerticesPerFace == 0) {
+      mixedElementOffsets[section] = getMixedElementOffsets(faceElements[section]);
+      lastElement = firstElement + static_cast<AIM::Types::CGNSInt>(mixedElementOffsets[section].size()) - 2;
+    }
+  }
+
+  auto toZeroBased = std::views::transform([](AIM::Types::CGNSInt vertex) { return vertex - 1; });
+  auto boundaryFaces = BoundaryFaceConnectivityType(zone.numberOfBCs);
+  for (std::size_t boundary = 0; boundary < boundaryElements.size(); ++boundary) {
+    for (const auto &element : boundaryElements[boundary]) {
+      auto section = std::size_t{0};
+      while (section < faceSections.size() && !(std::get<0>(faceSections[section]) <= element &&
+                                                   element <= std::get<1>(faceSections[section])))
+        ++section;
+      if (section == faceSections.size())
+        throw std::runtime_error("boundary element " + std::to_string(element) + " is not part of any face section");
+
+      const auto &[firstElement, lastElement, numberOfVerticesPerFace] = faceSections[section];
+      auto localElement = static_cast<std::size_t>(element - firstElement);
+      if (numberOfVerticesPerFace > 0) {
+        auto face = std::span{faceElements[section]}.subspan(
+          localElement * numberOfVerticesPerFace, numberOfVerticesPerFace);
+        boundaryFaces[boundary].addCell(face | toZeroBased);
+      } else {
+        // the first entry of each element in a mixed section is its element type, followed by its vertices
+        auto begin = mixedElementOffsets[section][localElement];
+        auto end = mixedElementOffsets[section][localElement + 1];
+        auto faceType = static_cast<CGNS_ENUMT(ElementType_t)>(faceElements[section][begin]);
+        if (getNumberOfVerticesPerFace(faceType) == 0)
+          throw std::runtime_error("boundary element " + std::to_string(element) + " is not a face element");
+        auto face = std::span{faceElements[section]}.subspan(begin + 1, end - begin - 1);
+        boundaryFaces[boundary].addCell(face | toZeroBased);
+      }
+    }
+  }
+  return boundaryFaces;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readParameters() -> void {
+  auto parameters = AIM::Parameters::ParameterRegistry{"input/aim.json"};
+  auto useDirectHDF5Reading = parameters.declare<bool>("/mesh/directHDF5Reading", true);
+  parameters.validate();
+
+  meshFile_ = readMeshFileName();
+  useDirectHDF5Reading_ = parameters.get(useDirectHDF5Reading);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readZones(int fileIndex) -> void {
+  AIM_INSTRUMENT_SCOPE("readZones");
+  auto firstVertex = std::size_t{0};
+  auto elementOffset = AIM::Types::CGNSInt{0};
+  auto numberOfBases = getNumberOfBases(fileIndex);
+  auto hasMatchingBase = false;
+  for (int base = 1; base <= static_cast<int>(numberOfBases); ++base) {
+    // bases of a different dimension (e.g. a surface mesh stored next to the volume mesh) are not part of the mesh
+    if (getCellDimension(fileIndex, base) != Dimensions)
+      continue;
+    hasMatchingBase = true;
+    auto numberOfZones = getNumberOfZones(fileIndex, base);
+    for (int zone = 1; zone <= static_cast<int>(numberOfZones); ++zone) {
+      if (!isUnstructured(fileIndex, base, zone))
+        throw std::runtime_error("zone " + getZoneName(fileIndex, base, zone) + " is structured, only unstructured "
+                                 "zones are supported");
+      auto &zoneInfo = zones_.emplace_back();
+      zoneInfo.base = base;
+      zoneInfo.zone = zone;
+      zoneInfo.name = getZoneName(fileIndex, base, zone);
+      zoneInfo.numberOfVertices = getNumberOfVertices(fileIndex, base, zone);
+      zoneInfo.firstVertex = firstVertex;
+      zoneInfo.elementOffset = elementOffset;
+      zoneInfo.numberOfBCs = getNumberOfBoundaryConditions(fileIndex, base, zone);
+      if (hdf5Reader_) {
+        zoneInfo.path = "/" + getBaseName(fileIndex, base) + "/" + zoneInfo.name;
+        auto numberOfSections = getNumberOfSections(fileIndex, zoneInfo);
+        for (AIM::Types::UInt section = 0; section < numberOfSections; ++section)
+          zoneInfo.sectionNames.push_back(getSectionName(fileIndex, zoneInfo, section));
+      }
+      firstVertex += zoneInfo.numberOfVertices;
+      elementOffset += static_cast<AIM::Types::CGNSInt>(getNumberOfElements(fileIndex, zoneInfo));
+    }
+  }
+  if (!hasMatchingBase)
+    throw std::runtime_error("mesh file " + meshFile_.string() + " does not contain a base with cell dimension " +
+                             std::to_string(Dimensions));
+  if (zones_.empty())
+    throw std::runtime_error("mesh file " + meshFile_.string() + " does not contain any zones");
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readZoneBoundaries(int fileIndex) -> void {
+  AIM_INSTRUMENT_SCOPE("readZoneBoundaries");
+  // boundaries are merged by name, in the order in which they first appear
+  auto boundaryNames = std::vector<std::string>{};
+  for (std::size_t zone = 0; zone < zones_.size(); ++zone) {
+    for (AIM::Types::UInt boundary = 0; boundary < zones_[zone].numberOfBCs; ++boundary) {
+      auto boundaryName = std::get<1>(getCurrentBoundaryType(fileIndex, zones_[zone], boundary));
+      auto mergedBoundary = static_cast<std::size_t>(
+        std::ranges::find(boundaryNames, boundaryName) - boundaryNames.begin());
+      if (mergedBoundary == boundaryNames.size())
+        boundaryNames.push_back(boundaryName);
+      zoneBoundaries_.emplace_back(zone, boundary, mergedBoundary);
+    }
+  }
+  numberOfBCs_ = static_cast<AIM::Types::UInt>(boundaryNames.size());
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readInterfaceVertices(int fileIndex)
+  -> InterfaceVerticesType {
+  AIM_INSTRUMENT_SCOPE("readInterfaceVertices");
+  auto interfaceVertices = InterfaceVerticesType{};
+  auto addInterface = [&interfaceVertices](const ZoneInfoType &zone, const ZoneInfoType &donorZone,
+                        std::vector<AIM::Types::CGNSInt> points, std::vector<AIM::Types::CGNSInt> donorPoints,
+                        bool isRange, bool isDonorRange) {
+    // ranges only store the first and last vertex, expand them into a list of vertices. Donor ranges may run backwards
+    auto expand = [](std::vector<AIM::Types::CGNSInt> &range) {
+      auto first = range[0];
+      auto last = range[1];
+      auto step = last >= first ? AIM::Types::CGNSInt{1} : AIM::Types::CGNSInt{-1};
+      range.resize(static_cast<std::size_t>((last - first) * step + 1));
+      for (std::size_t i = 0; i < range.size(); ++i)
+        range[i] = first + static_cast<AIM::Types::CGNSInt>(i) * step;
+    };
+    if (isRange && points.size() == 2) expand(points);
+    if (isDonorRange && donorPoints.size() == 2) expand(donorPoints);
+    if (points.size() != donorPoints.size())
+      throw std::runtime_error("interface between zone " + zone.name + " and " + donorZone.name + " has " +
+                               std::to_string(points.size()) + " vertices on one side, but " +
+                               std::to_string(donorPoints.size()) + " on the other");
+    for (std::size_t i = 0; i < points.size(); ++i)
+      interfaceVertices.emplace_back(zone.firstVertex + static_cast<std::size_t>(points[i] - 1),
+        donorZone.firstVertex + static_cast<std::size_t>(donorPoints[i] - 1));
+  };
+
+  for (const auto &zone : zones_) {
+    // general connectivity, only vertex-based 1-to-1 interfaces describe shared vertices
+    auto numberOfConnectivities = int{0};
+    throwOnCGNSError(cg_nconns(fileIndex, zone.base, zone.zone, &numberOfConnectivities),
+      "could not read number of connectivities of zone " + zone.name);
+    for (int connectivity = 1; connectivity <= numberOfConnectivities; ++connectivity) {
+      char connectivityName[33]{}, donorName[65]{};
+      auto location = CGNS_ENUMT(GridLocation_t){};
+      auto connectivityType = CGNS_ENUMT(GridConnectivityType_t){};
+      auto pointSetType = CGNS_ENUMT(PointSetType_t){};
+      auto donorPointSetType = CGNS_ENUMT(PointSetType_t){};
+      auto donorZoneType = CGNS_ENUMT(ZoneType_t){};
+      auto donorDataType = CGNS_ENUMT(DataType_t){};
+      auto numberOfPoints = AIM::Types::CGNSInt{0};
+      auto numberOfDonorPoints = AIM::Types::CGNSInt{0};
+      throwOnCGNSError(cg_conn_info(fileIndex, zone.base, zone.zone, connectivity, connectivityName, &location,
+                         &connectivityType, &pointSetType, &numberOfPoints, donorName, &donorZoneType,
+                         &donorPointSetType, &donorDataType, &numberOfDonorPoints),
+        "could not read connectivity " + std::to_string(connectivity) + " of zone " + zone.name);
+      if (location != CGNS_ENUMV(Vertex) || connectivityType != CGNS_ENUMV(Abutting1to1))
+        continue;
+      float center[3], angle[3], translation[3];
+      if (cg_conn_periodic_read(fileIndex, zone.base, zone.zone, connectivity, center, angle, translation) == CG_OK)
+        continue;
+
+      // donor points are requested in the width of the buffer, the library converts them from the width in the file
+      auto points = std::vector<AIM::Types::CGNSInt>(static_cast<std::size_t>(numberOfPoints));
+      auto donorPoints = std::vector<AIM::Types::CGNSInt>(static_cast<std::size_t>(numberOfDonorPoints));
+      throwOnCGNSError(cg_conn_read(fileIndex, zone.base, zone.zone, connectivity, points.data(), cgnsIntDataType_,
+                         donorPoints.data()),
+        "could not read vertices of connectivity " + std::string(connectivityName) + " of zone " + zone.name);
+      addInterface(zone, zones_[findZone(zone.base, donorName)], std::move(points), std::move(donorPoints),
+        pointSetType == CGNS_ENUMV(PointRange), donorPointSetType == CGNS_ENUMV(PointRangeDonor));
+    }
+
+    // 1-to-1 connectivity, which uses vertex ranges. The index dimension of unstructured zones is one
+    auto numberOfOneToOneConnectivities = int{0};
+    throwOnCGNSError(cg_n1to1(fileIndex, zone.base, zone.zone, &numberOfOneToOneConnectivities),
+      "could not read number of 1-to-1 connectivities of zone " + zone.name);
+    for (int connectivity = 1; connectivity <= numberOfOneToOneConnectivities; ++connectivity) {
+      char connectivityName[33]{}, donorName[65]{};
+      auto range = std::vector<AIM::Types::CGNSInt>(2);
+      auto donorRange = std::vector<AIM::Types::CGNSInt>(2);
+      int transform[1]{};
+      throwOnCGNSError(cg_1to1_read(fileIndex, zone.base, zone.zone, connectivity, connectivityName, donorName,
+                         range.data(), donorRange.data(), transform),
+        "could not read 1-to-1 connectivity " + std::to_string(connectivity) + " of zone " + zone.name);
+      float center[3], angle[3], translation[3];
+      if (cg_1to1_periodic_read(fileIndex, zone.base, zone.zone, connectivity, center, angle, translation) == CG_OK)
+        continue;
+      addInterface(zone, zones_[findZone(zone.base, donorName)], std::move(range), std::move(donorRange), true, true);
+    }
+  }
+  return interfaceVertices;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::throwOnCGNSError(int errorCode, const std::string& message)
+  -> void {
+  if (errorCode != CG_OK)
+    throw std::runtime_error(message + " (" + std::string(cg_get_error()) + ")");
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::findZone(int base, const std::string& name) const
+  -> std::size_t {
+  // donor zones in other bases are referenced as BaseName/ZoneName, zones of the same base are preferred
+  auto zoneName = name.substr(name.find_last_of('/') + 1);
+  auto zone =
+    std::ranges::find_if(zones_, [&](const auto &info) { return info.base == base && info.name == zoneName; });
+  if (zone == zones_.end())
+    zone = std::ranges::find_if(zones_, [&](const auto &info) { return info.name == zoneName; });
+  if (zone == zones_.end())
+    throw std::runtime_error("donor zone " + name + " does not exist");
+  return static_cast<std::size_t>(zone - zones_.begin());
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::toMergedVertex(
+  const ZoneInfoType& zone, std::size_t vertex) const -> IndexType {
+  auto concatenatedVertex = zone.firstVertex + vertex;
+  return vertexMap_ ? (*vertexMap_)[concatenatedVertex] : static_cast<IndexType>(concatenatedVertex);
 }
 
-auto MeshReader::getNumberOfBases() -> AIM::Types::UInt {
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::mergeZoneConnectivityTables(
+  const std::vector<ConnectivityTableType>& zoneCells) -> ConnectivityTableType {
+  // the cells of each zone are grouped by element type. The merged table keeps this grouping, i.e. all cells of one
+  // element type (from all zones) come before the cells of the next type
+  constexpr auto maximumNumberOfVerticesPerCell = std::size_t{8};
+  auto numberOfCells = std::size_t{0};
+  auto numberOfIndices = std::size_t{0};
+  for (const auto &cells : zoneCells) {
+    numberOfCells += cells.size();
+    numberOfIndices += cells.getNumberOfIndices();
+  }
+  checkIndexTypeIsWideEnough(numberOfIndices, "connectivity entries");
+
+  auto merged = ConnectivityTableType{};
+  merged.reserve(numberOfCells, numberOfIndices);
+  for (std::size_t numberOfVerticesPerCell = 1; numberOfVerticesPerCell <= maximumNumberOfVerticesPerCell;
+       ++numberOfVerticesPerCell) {
+    for (std::size_t zone = 0; zone < zoneCells.size(); ++zone) {
+      auto toMerged = std::views::transform([this, zone](IndexType vertex) {
+        return toMergedVertex(zones_[zone], vertex);
+      });
+      for (const auto &cell : zoneCells[zone])
+        if (cell.size() == numberOfVerticesPerCell)
+          merged.addCell(cell | toMerged);
+    }
+  }
+  return merged;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getNumberOfBases(int fileIndex) -> AIM::Types::UInt {
   auto numberOfBases = int{0};
-  auto errorCode = cg_nbases(fileIndex_, &numberOfBases);
+  auto errorCode = cg_nbases(fileIndex, &numberOfBases);
   assert(errorCode == 0 && "Could not read number of bases from file");
   return static_cast<AIM::Types::UInt>(numberOfBases);
 }
 
-auto MeshReader::getNumberOfZones() -> AIM::Types::UInt {
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getNumberOfZones(
+  int fileIndex, int base) -> AIM::Types::UInt {
   auto numberOfZones = int{0};
-  auto errorCode = cg_nzones(fileIndex_, 1, &numberOfZones);
-  assert(errorCode == 0 && "Could not read number of bases from file");
+  auto errorCode = cg_nzones(fileIndex, base, &numberOfZones);
+  assert(errorCode == 0 && "Could not read number of zones from base");
   return static_cast<AIM::Types::UInt>(numberOfZones);
 }
 
-auto MeshReader::getNumberOfVertices() -> AIM::Types::UInt {
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getCellDimension(int fileIndex, int base) -> int {
+  char baseName[33]{};
+  auto cellDimension = int{0};
+  auto physicalDimension = int{0};
+  auto errorCode = cg_base_read(fileIndex, base, baseName, &cellDimension, &physicalDimension);
+  assert(errorCode == 0 && "Could not read base");
+  return cellDimension;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getBaseName(int fileIndex, int base) -> std::string {
+  char baseName[33]{};
+  auto cellDimension = int{0};
+  auto physicalDimension = int{0};
+  auto errorCode = cg_base_read(fileIndex, base, baseName, &cellDimension, &physicalDimension);
+  assert(errorCode == 0 && "Could not read base");
+  return std::string(baseName);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::isUnstructured(int fileIndex, int base, int zone) -> bool {
+  auto zoneType = CGNS_ENUMT(ZoneType_t){};
+  auto errorCode = cg_zone_type(fileIndex, base, zone, &zoneType);
+  assert(errorCode == 0 && "Could not read zone type");
+  return zoneType == CGNS_ENUMV(Unstructured);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getZoneName(
+  int fileIndex, int base, int zone) -> std::string {
+  AIM::Types::CGNSInt gridSizeProperties[3][3]{};
+  char zoneName[33]{};
+  auto errorCode = cg_zone_read(fileIndex, base, zone, zoneName, gridSizeProperties[0]);
+  assert(errorCode == 0 && "Could not read zone name");
+  return std::string(zoneName);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getNumberOfVertices(
+  int fileIndex, int base, int zone) -> std::size_t {
   AIM::Types::CGNSInt gridSizeProperties[3][1]{};
   char zoneName[64];
-  auto errorCode = cg_zone_read(fileIndex_, 1, 1, zoneName, gridSizeProperties[0]);
+  auto errorCode = cg_zone_read(fileIndex, base, zone, zoneName, gridSizeProperties[0]);
   assert(errorCode == 0 && "Could not read number of vertices from zone");
-  return static_cast<AIM::Types::UInt>(gridSizeProperties[0][0]);
+  return static_cast<std::size_t>(gridSizeProperties[0][0]);
 }
 
-auto MeshReader::getNumberOfCells() -> AIM::Types::UInt {
-  AIM::Types::CGNSInt gridSizeProperties[3][1]{};
-  char zoneName[64];
-  auto errorCode = cg_zone_read(fileIndex_, 1, 1, zoneName, gridSizeProperties[0]);
-  assert(errorCode == 0 && "Could not read number of cells from zone");
-  return static_cast<AIM::Types::UInt>(gridSizeProperties[1][0]);
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getNumberOfElements(
+  int fileIndex, const ZoneInfoType& zone) -> std::size_t {
+  // element indices are unique within a zone and cover cells and boundary elements of all sections
+  auto numberOfElements = AIM::Types::CGNSInt{0};
+  auto numberOfSections = getNumberOfSections(fileIndex, zone);
+  for (AIM::Types::UInt section = 0; section < numberOfSections; ++section)
+    numberOfElements = std::max(numberOfElements, getElementRangeOfSection(fileIndex, zone, section).second);
+  return static_cast<std::size_t>(numberOfElements);
 }
 
-auto MeshReader::getNumberOfSections() -> AIM::Types::UInt {
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getNumberOfSections(
+  int fileIndex, const ZoneInfoType& zone) -> AIM::Types::UInt {
   auto numberOfSections = int{0};
-  auto errorCode = cg_nsections(fileIndex_, 1, 1, &numberOfSections);
+  auto errorCode = cg_nsections(fileIndex, zone.base, zone.zone, &numberOfSections);
   assert(errorCode == 0 && "Could not read number of sections from file");
   assert(numberOfSections > 0 && "No sections found, but required to set up connectivity table!");
   return static_cast<AIM::Types::UInt>(numberOfSections);
 }
 
-auto MeshReader::getNumberOfBoundaryConditions() -> AIM::Types::UInt {
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getNumberOfBoundaryConditions(
+  int fileIndex, int base, int zone) -> AIM::Types::UInt {
   auto numBCs = int{0};
-  auto errorCode = cg_nbocos(fileIndex_, 1, 1, &numBCs);
+  auto errorCode = cg_nbocos(fileIndex, base, zone, &numBCs);
   assert(errorCode == 0 && "Could not read number of boundary conditions from file");
   return static_cast<AIM::Types::UInt>(numBCs);
 }
 
-auto MeshReader::getNumberOfFamilies() -> AIM::Types::UInt {
-  auto numFamilies = int{0};
-  auto errorCode = cg_nfamilies(fileIndex_, 1, &numFamilies);
-  assert(errorCode == 0 && "Could not read number of families from file");
-  return static_cast<AIM::Types::UInt>(numFamilies);
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getCellType(
+  int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section) -> CGNS_ENUMT(ElementType_t) {
+  auto begin = AIM::Types::CGNSInt{0};
+  auto end = AIM::Types::CGNSInt{0};
+  char sectionName[33]{};
+  auto indexOfLastElement = int{0};
+  auto parentDataExist = int{0};
+  auto cellType = CGNS_ENUMT(ElementType_t){};
+
+  auto errorCode = cg_section_read(fileIndex, zone.base, zone.zone, static_cast<int>(section + 1), sectionName,
+    &cellType, &begin, &end, &indexOfLastElement, &parentDataExist);
+  assert(errorCode == 0 && "Could not read section from zone");
+  return cellType;
 }
 
-auto MeshReader::getCellType(AIM::Types::UInt section) -> CGNS_ENUMT(ElementType_t) {
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getSectionName(
+  int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section) -> std::string {
   auto begin = AIM::Types::CGNSInt{0};
   auto end = AIM::Types::CGNSInt{0};
   char sectionName[33]{};
@@ -176,49 +711,255 @@ auto MeshReader::getCellType(AIM::Types::UInt section) -> CGNS_ENUMT(ElementType
   auto parentDataExist = int{0};
   auto cellType = CGNS_ENUMT(ElementType_t){};
 
-  auto errorCode = cg_section_read(fileIndex_, 1, 1, static_cast<int>(section + 1), sectionName, &cellType, &begin,
-    &end, &indexOfLastElement, &parentDataExist);
+  auto errorCode = cg_section_read(fileIndex, zone.base, zone.zone, static_cast<int>(section + 1), sectionName,
+    &cellType, &begin, &end, &indexOfLastElement, &parentDataExist);
   assert(errorCode == 0 && "Could not read section from zone");
-  return cellType;
+  return std::string(sectionName);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getNumberOfVerticesPerCell(
+  CGNS_ENUMT(ElementType_t) cellType) -> AIM::Types::UInt {
+  if constexpr (Dimensions == AIM::Enum::Dimension::Two) {
+    if (cellType == CGNS_ENUMV(TRI_3)) return 3u;
+    if (cellType == CGNS_ENUMV(QUAD_4)) return 4u;
+  } else {
+    if (cellType == CGNS_ENUMV(TETRA_4)) return 4u;
+    if (cellType == CGNS_ENUMV(PYRA_5)) return 5u;
+    if (cellType == CGNS_ENUMV(PENTA_6)) return 6u;
+    if (cellType == CGNS_ENUMV(HEXA_8)) return 8u;
+  }
+  return 0u;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getNumberOfVerticesPerFace(
+  CGNS_ENUMT(ElementType_t) faceType) -> AIM::Types::UInt {
+  if constexpr (Dimensions == AIM::Enum::Dimension::Two) {
+    if (faceType == CGNS_ENUMV(BAR_2)) return 2u;
+  } else {
+    if (faceType == CGNS_ENUMV(TRI_3)) return 3u;
+    if (faceType == CGNS_ENUMV(QUAD_4)) return 4u;
+  }
+  return 0u;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getCellSections(
+  int fileIndex, const ZoneInfoType& zone) -> CellSectionsType {
+  auto cellSections = CellSectionsType{};
+  auto numberOfSections = getNumberOfSections(fileIndex, zone);
+  for (AIM::Types::UInt section = 0; section < numberOfSections; ++section) {
+    auto numberOfVerticesPerCell = getNumberOfVerticesPerCell(getCellType(fileIndex, zone, section));
+    if (numberOfVerticesPerCell > 0) {
+      auto elementSize = getNumberOfConnectivitiesForCellType(fileIndex, zone, section, numberOfVerticesPerCell);
+      cellSections.emplace_back(section, numberOfVerticesPerCell, elementSize);
+    }
+  }
+
+  // within a given dimension, the number of vertices identifies the element type. Sorting the sections by it groups
+  // the cells by element type (see AIM::Mesh::ElementBlocks), sections of the same type keep their order in the file
+  std::ranges::stable_sort(cellSections, {}, [](const auto &cellSection) { return std::get<1>(cellSection); });
+  return cellSections;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getMixedSections(
+  int fileIndex, const ZoneInfoType& zone) -> std::vector<std::pair<AIM::Types::UInt, std::size_t>> {
+  auto mixedSections = std::vector<std::pair<AIM::Types::UInt, std::size_t>>{};
+  auto numberOfSections = getNumberOfSections(fileIndex, zone);
+  for (AIM::Types::UInt section = 0; section < numberOfSections; ++section)
+    if (getCellType(fileIndex, zone, section) == CGNS_ENUMV(MIXED))
+      mixedSections.emplace_back(section, getElementDataSize(fileIndex, zone, section));
+  return mixedSections;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getMixedElementOffsets(
+  std::span<const AIM::Types::CGNSInt> elements) -> std::vector<std::size_t> {
+  // each element of a mixed section stores its element type first, followed by its vertices. Only the linear cell
+  // and face types of the mesh dimension are supported, the size of other element types is not known
+  auto offsets = std::vector<std::size_t>{0};
+  while (offsets.back() < elements.size()) {
+    auto elementType = static_cast<CGNS_ENUMT(ElementType_t)>(elements[offsets.back()]);
+    auto numberOfVertices = std::max(getNumberOfVerticesPerCell(elementType), getNumberOfVerticesPerFace(elementType));
+    if (numberOfVertices == 0)
+      throw std::runtime_error("element type " + std::to_string(elements[offsets.back()]) +
+                               " in mixed element section is not supported");
+    offsets.push_back(offsets.back() + 1 + numberOfVertices);
+  }
+  assert(offsets.back() == elements.size() && "last element of mixed element section is incomplete");
+  return offsets;
 }
 
-auto MeshReader::addCurrentCellTypeToConnectivityTable(
-  AIM::Types::UInt section, AIM::Types::UInt numberOfVerticesPerCell, ConnectivityTableType &connectivity) -> void {
-  auto numberOfConnectivities = getNumberOfConnectivitiesForCellType(section, numberOfVerticesPerCell);
-  writeConnectivityTable(section, numberOfConnectivities, numberOfVerticesPerCell, connectivity);
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::groupCellsByElementType(
+  const CellSectionsType& cellSections, const AIM::Types::CGNSInt* sectionIndices,
+  const std::vector<std::vector<AIM::Types::CGNSInt>>& mixedElements) -> ConnectivityTableType {
+  // cells of mixed sections are sorted into the groups of cells with the same number of vertices (i.e. the same element
+  // type), after the cells of the homogeneous sections. First, the size of each group is determined
+  constexpr auto maximumNumberOfVerticesPerCell = std::size_t{8};
+  auto mixedElementOffsets = std::vector<std::vector<std::size_t>>{};
+  auto numberOfIndicesPerGroup = std::array<std::size_t, maximumNumberOfVerticesPerCell + 1>{};
+  for (const auto &[section, numberOfVerticesPerCell, elementSize] : cellSections)
+    numberOfIndicesPerGroup[numberOfVerticesPerCell] += elementSize;
+  for (const auto &elements : mixedElements) {
+    mixedElementOffsets.push_back(getMixedElementOffsets(elements));
+    const auto &offsets = mixedElementOffsets.back();
+    for (std::size_t element = 0; element + 1 < offsets.size(); ++element) {
+      auto numberOfVerticesPerCell =
+        getNumberOfVerticesPerCell(static_cast<CGNS_ENUMT(ElementType_t)>(elements[offsets[element]]));
+      numberOfIndicesPerGroup[numberOfVerticesPerCell] += numberOfVerticesPerCell;
+    }
+  }
+
+  auto groupOffsets = std::array<std::size_t, maximumNumberOfVerticesPerCell + 2>{};
+  std::partial_sum(numberOfIndicesPerGroup.begin(), numberOfIndicesPerGroup.end(), groupOffsets.begin() + 1);
+  auto numberOfIndices = groupOffsets.back();
+  checkIndexTypeIsWideEnough(numberOfIndices, "connectivity entries");
+
+  // then, the vertices of each cell are copied to the next free position of its group and converted to zero-based
+  auto indices = std::vector<IndexType>(numberOfIndices);
+  auto position = groupOffsets;
+  auto sectionOffset = std::size_t{0};
+  for (const auto &[section, numberOfVerticesPerCell, elementSize] : cellSections) {
+    for (std::size_t index = 0; index < elementSize; ++index)
+      indices[position[numberOfVerticesPerCell]++] = static_cast<IndexType>(sectionIndices[sectionOffset + index] - 1);
+    sectionOffset += elementSize;
+  }
+  for (std::size_t mixedSection = 0; mixedSection < mixedElements.size(); ++mixedSection) {
+    const auto &elements = mixedElements[mixedSection];
+    const auto &offsets = mixedElementOffsets[mixedSection];
+    for (std::size_t element = 0; element + 1 < offsets.size(); ++element) {
+      auto numberOfVerticesPerCell =
+        getNumberOfVerticesPerCell(static_cast<CGNS_ENUMT(ElementType_t)>(elements[offsets[element]]));
+      if (numberOfVerticesPerCell == 0)
+        continue;
+      for (auto index = offsets[element] + 1; index < offsets[element + 1]; ++index)
+        indices[position[numberOfVerticesPerCell]++] = static_cast<IndexType>(elements[index] - 1);
+    }
+  }
+
+  auto offsets = std::vector<IndexType>{0};
+  for (std::size_t numberOfVerticesPerCell = 1; numberOfVerticesPerCell <= maximumNumberOfVerticesPerCell;
+       ++numberOfVerticesPerCell)
+    for (auto index = groupOffsets[numberOfVerticesPerCell]; index < groupOffsets[numberOfVerticesPerCell + 1];
+         index += numberOfVerticesPerCell)
+      offsets.push_back(static_cast<IndexType>(index + numberOfVerticesPerCell));
+  return ConnectivityTableType{std::move(offsets), std::move(indices)};
 }
 
-auto MeshReader::getNumberOfConnectivitiesForCellType(
-  AIM::Types::UInt section, AIM::Types::UInt numberOfVerticesPerCell) -> AIM::Types::UInt {
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getNumberOfConnectivitiesForCellType(
+  int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section, AIM::Types::UInt numberOfVerticesPerCell)
+  -> std::size_t {
   auto elementSize = AIM::Types::CGNSInt{0};
-  auto errorCode = cg_ElementDataSize(fileIndex_, 1, 1, static_cast<int>(section + 1), &elementSize);
+  auto errorCode = cg_ElementDataSize(fileIndex, zone.base, zone.zone, static_cast<int>(section + 1), &elementSize);
   assert(errorCode == 0 && "Could not read element size from section");
-  assert(static_cast<AIM::Types::UInt>(elementSize) % numberOfVerticesPerCell == 0 &&
+  assert(static_cast<std::size_t>(elementSize) % numberOfVerticesPerCell == 0 &&
          "error reading elements, number of connectivities not divisible by number of vertices per cell");
-  return static_cast<AIM::Types::UInt>(elementSize);
+  return static_cast<std::size_t>(elementSize);
 }
 
-auto MeshReader::writeConnectivityTable(AIM::Types::UInt section, AIM::Types::UInt elementSize,
-  AIM::Types::UInt numberOfVerticesPerCell, ConnectivityTableType &connectivity) -> void {
-  auto parentData = AIM::Types::CGNSInt{0};
-  auto temp = std::vector<AIM::Types::CGNSInt>{};
-  temp.resize(elementSize);
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getElementDataSize(
+  int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section) -> std::size_t {
+  auto elementSize = AIM::Types::CGNSInt{0};
+  auto errorCode = cg_ElementDataSize(fileIndex, zone.base, zone.zone, static_cast<int>(section + 1), &elementSize);
+  assert(errorCode == 0 && "Could not read element size from section");
+  return static_cast<std::size_t>(elementSize);
+}
 
-  auto errorCode = cg_elements_read(fileIndex_, 1, 1, static_cast<int>(section + 1), &temp[0], &parentData);
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readElementsIntoBuffer(int fileIndex,
+  const ZoneInfoType& zone, AIM::Types::UInt section, std::span<AIM::Types::CGNSInt> buffer,
+  std::unique_lock<std::mutex>& lock) -> void {
+  AIM_INSTRUMENT_SCOPE("readElements");
+  AIM_INSTRUMENT_COUNT("bytes", buffer.size_bytes());
+  if (hdf5Reader_) {
+    // the HDF5 reader only takes the library mutex for its HDF5 calls, the data is copied without holding it
+    lock.unlock();
+    hdf5Reader_->readNode(zone.path + "/" + zone.sectionNames[section] + "/ElementConnectivity", buffer);
+    lock.lock();
+    return;
+  }
+  auto errorCode =
+    cg_elements_read(fileIndex, zone.base, zone.zone, static_cast<int>(section + 1), buffer.data(), nullptr);
   assert(errorCode == 0 && "Could not read elements from current section");
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getElementRangeOfSection(
+  int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section)
+  -> std::pair<AIM::Types::CGNSInt, AIM::Types::CGNSInt> {
+  auto begin = AIM::Types::CGNSInt{0};
+  auto end = AIM::Types::CGNSInt{0};
+  char sectionName[33]{};
+  auto indexOfLastElement = int{0};
+  auto parentDataExist = int{0};
+  auto cellType = CGNS_ENUMT(ElementType_t){};
+
+  auto errorCode = cg_section_read(fileIndex, zone.base, zone.zone, static_cast<int>(section + 1), sectionName,
+    &cellType, &begin, &end, &indexOfLastElement, &parentDataExist);
+  assert(errorCode == 0 && "Could not read section from zone");
+  return {begin, end};
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getFirstElementOfSection(
+  int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section) -> AIM::Types::CGNSInt {
+  return getElementRangeOfSection(fileIndex, zone, section).first;
+}
 
-  auto numberOfElements = elementSize / numberOfVerticesPerCell;
-  for (AIM::Types::UInt i = 0; i < numberOfElements; ++i) {
-    auto offset = i * numberOfVerticesPerCell;
-    auto localElementConnectivity = std::vector<AIM::Types::UInt>{};
-    localElementConnectivity.reserve(numberOfElements);
-    for (AIM::Types::UInt vertex = 0; vertex < numberOfVerticesPerCell; ++vertex)
-      localElementConnectivity.push_back(static_cast<AIM::Types::UInt>(temp[offset + vertex]));
-    connectivity.push_back(localElementConnectivity);
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readElementRangeIntoBuffer(
+  int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section, AIM::Types::CGNSInt firstElement,
+  AIM::Types::CGNSInt lastElement, AIM::Types::CGNSInt *buffer) -> void {
+  auto errorCode = cg_elements_partial_read(
+    fileIndex, zone.base, zone.zone, static_cast<int>(section + 1), firstElement, lastElement, buffer, nullptr);
+  assert(errorCode == 0 && "Could not read element range from current section");
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::convertToZeroBasedIndices(
+  std::span<const AIM::Types::CGNSInt> rawIndices, std::span<IndexType> indices) -> void {
+  assert(rawIndices.size() == indices.size() && "raw and converted indices must have the same size");
+  for (std::size_t i = 0; i < indices.size(); ++i)
+    indices[i] = static_cast<IndexType>(rawIndices[i] - 1);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::convertToZeroBasedIndicesInPlace(
+  std::span<IndexType> indices) -> void {
+  // only used if the raw CGNS integers fit into the index array, wider integers are narrowed by
+  // convertToZeroBasedIndices()
+  if constexpr (sizeof(AIM::Types::CGNSInt) == sizeof(IndexType)) {
+    for (auto &index : indices)
+      index -= 1u;
+  } else if constexpr (sizeof(AIM::Types::CGNSInt) < sizeof(IndexType)) {
+    // the raw CGNS integers occupy the front of the array, they are widened back to front, so that each raw integer is
+    // read before it is overwritten
+    auto rawBytes = reinterpret_cast<const unsigned char *>(indices.data());
+    for (std::size_t i = indices.size(); i > 0; --i) {
+      auto rawIndex = AIM::Types::CGNSInt{0};
+      std::memcpy(&rawIndex, rawBytes + (i - 1) * sizeof(AIM::Types::CGNSInt), sizeof(AIM::Types::CGNSInt));
+      indices[i - 1] = static_cast<IndexType>(rawIndex - 1);
+    }
   }
 }
 
-auto MeshReader::getCurrentBoundaryType(AIM::Types::UInt boundary)
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::checkIndexTypeIsWideEnough(
+  std::size_t numberOfEntries, const std::string &entries) -> void {
+  if (numberOfEntries > static_cast<std::size_t>(std::numeric_limits<IndexType>::max()))
+    throw std::runtime_error("mesh has " + std::to_string(numberOfEntries) + " " + entries +
+                             ", which can't be indexed with a " + std::to_string(8 * sizeof(IndexType)) +
+                             "-bit index type, use 64-bit indices instead");
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getCurrentBoundaryType(
+  int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt boundary)
   -> std::tuple<CGNS_ENUMT(BCType_t), std::string, AIM::Types::UInt> {
   int indexOfNormalVector[3], numberOfDatasets;
   char boundaryName[64];
@@ -227,32 +968,100 @@ auto MeshReader::getCurrentBoundaryType(AIM::Types::UInt boundary)
   CGNS_ENUMT(DataType_t) normalVectorType;
   AIM::Types::CGNSInt normalVectorsExistFlag, numberOfBoundaryElements{0};
 
-  auto errorCode =
-    cg_boco_info(fileIndex_, 1, 1, static_cast<int>(boundary + 1), boundaryName, &boundaryElementType, &pointSetType,
-      &numberOfBoundaryElements, indexOfNormalVector, &normalVectorsExistFlag, &normalVectorType, &numberOfDatasets);
+  auto errorCode = cg_boco_info(fileIndex, zone.base, zone.zone, static_cast<int>(boundary + 1), boundaryName,
+    &boundaryElementType, &pointSetType, &numberOfBoundaryElements, indexOfNormalVector, &normalVectorsExistFlag,
+    &normalVectorType, &numberOfDatasets);
   assert(errorCode == 0 && "Could not read boundary condition from boundary node");
   return {boundaryElementType, std::string(boundaryName), static_cast<AIM::Types::UInt>(numberOfBoundaryElements)};
 }
 
-auto MeshReader::getCurrentFamilyType(AIM::Types::UInt boundary) -> CGNS_ENUMT(BCType_t) {
-  char familyBCName[64];
-  CGNS_ENUMT(BCType_t) ifamilytype;
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::toBoundaryCondition(CGNS_ENUMT(BCType_t) type) -> int {
+  switch (type) {
+    case CGNS_ENUMV(BCWall): return AIM::Enum::BoundaryCondition::Wall;
+    case CGNS_ENUMV(BCInflow): return AIM::Enum::BoundaryCondition::Inlet;
+    case CGNS_ENUMV(BCOutflow): return AIM::Enum::BoundaryCondition::Outlet;
+    case CGNS_ENUMV(BCSymmetryPlane): return AIM::Enum::BoundaryCondition::Symmetry;
+    default: return AIM::Enum::BoundaryCondition::Unassigned;
+  }
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::getCurrentFamilyType(
+  int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt boundary) -> CGNS_ENUMT(BCType_t) {
+  // families are stored per base, the family of a boundary is looked up by the name stored in its boundary node
+  char familyName[33]{};
+  auto errorCode = cg_goto(fileIndex, zone.base, "Zone_t", zone.zone, "ZoneBC_t", 1, "BC_t",
+    static_cast<int>(boundary + 1), "end");
+  assert(errorCode == 0 && "Could not navigate to boundary node");
+  if (cg_famname_read(familyName) != CG_OK)
+    throw std::runtime_error("boundary " + std::to_string(boundary + 1) + " of zone " + zone.name +
+                             " is family specified, but does not reference a family");
 
-  auto errorCode = cg_fambc_read(fileIndex_, 1, static_cast<int>(boundary + 2), 1, familyBCName, &ifamilytype);
-  assert(errorCode == 0 && "Could not read boundary condition from family node");
-  return ifamilytype;
+  auto numberOfFamilies = int{0};
+  errorCode = cg_nfamilies(fileIndex, zone.base, &numberOfFamilies);
+  assert(errorCode == 0 && "Could not read number of families from file");
+  for (int family = 1; family <= numberOfFamilies; ++family) {
+    char currentFamilyName[33]{};
+    auto numberOfFamilyBCs = int{0};
+    auto numberOfGeometries = int{0};
+    errorCode =
+      cg_family_read(fileIndex, zone.base, family, currentFamilyName, &numberOfFamilyBCs, &numberOfGeometries);
+    assert(errorCode == 0 && "Could not read family node");
+    if (std::string(currentFamilyName) == familyName && numberOfFamilyBCs > 0) {
+      char familyBCName[33]{};
+      auto familyType = CGNS_ENUMT(BCType_t){};
+      errorCode = cg_fambc_read(fileIndex, zone.base, family, 1, familyBCName, &familyType);
+      assert(errorCode == 0 && "Could not read boundary condition from family node");
+      return familyType;
+    }
+  }
+  throw std::runtime_error("family " + std::string(familyName) + " does not define a boundary condition");
 }
 
-auto MeshReader::writeBoundaryConnectivityIntoArray(AIM::Types::UInt boundary, BoundaryConditionConnectivityType &bcc)
-  -> void {
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readBoundaryElements(
+  int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt boundary, bool expandRanges)
+  -> std::vector<AIM::Types::CGNSInt> {
+  int indexOfNormalVector[3], numberOfDatasets;
+  char boundaryName[64];
+  CGNS_ENUMT(BCType_t) boundaryElementType;
+  CGNS_ENUMT(PointSetType_t) pointSetType;
+  CGNS_ENUMT(DataType_t) normalVectorType;
+  AIM::Types::CGNSInt normalVectorsExistFlag, numberOfPoints{0};
+
+  auto errorCode = cg_boco_info(fileIndex, zone.base, zone.zone, static_cast<int>(boundary + 1), boundaryName,
+    &boundaryElementType, &pointSetType, &numberOfPoints, indexOfNormalVector, &normalVectorsExistFlag,
+    &normalVectorType, &numberOfDatasets);
+  assert(errorCode == 0 && "Could not read boundary condition from boundary node");
+
+  auto points = std::vector<AIM::Types::CGNSInt>(static_cast<std::size_t>(numberOfPoints));
   auto normalVectorList = int{0};
-  auto boundaryConnectivityTable = std::vector<AIM::Types::CGNSInt>{};
-  auto [boundaryElementType, boundaryName, numberOfBoundaryElements] = getCurrentBoundaryType(boundary);
-  boundaryConnectivityTable.resize(numberOfBoundaryElements);
-  cg_boco_read(fileIndex_, 1, 1, static_cast<int>(boundary + 1), &boundaryConnectivityTable[0], &normalVectorList);
-  bcc[boundary] = boundaryConnectivityTable;
+  errorCode =
+    cg_boco_read(fileIndex, zone.base, zone.zone, static_cast<int>(boundary + 1), points.data(), &normalVectorList);
+  assert(errorCode == 0 && "Could not read boundary condition elements from boundary node");
+
+  // ranges only store the first and last element, expand them into a list of elements
+  auto isRange = pointSetType == CGNS_ENUMV(PointRange) || pointSetType == CGNS_ENUMV(ElementRange);
+  if (expandRanges && isRange && points.size() == 2) {
+    auto first = points[0];
+    auto last = points[1];
+    points.resize(static_cast<std::size_t>(last - first + 1));
+    std::iota(points.begin(), points.end(), first);
+  }
+  return points;
 }
 /// @}
 
+// explicit instantiation of the supported mesh dimensions, index and floating point types
+template class MeshReader<AIM::Enum::Dimension::Two, std::uint32_t, float>;
+template class MeshReader<AIM::Enum::Dimension::Two, std::uint32_t, double>;
+template class MeshReader<AIM::Enum::Dimension::Two, std::uint64_t, float>;
+template class MeshReader<AIM::Enum::Dimension::Two, std::uint64_t, double>;
+template class MeshReader<AIM::Enum::Dimension::Three, std::uint32_t, float>;
+template class MeshReader<AIM::Enum::Dimension::Three, std::uint32_t, double>;
+template class MeshReader<AIM::Enum::Dimension::Three, std::uint64_t, float>;
+template class MeshReader<AIM::Enum::Dimension::Three, std::uint64_t, double>;
+
 }  // namespace Mesh
 }  // end namespace AIM
\ No newline at end of file
@@ -5,7 +5,12 @@
 #pragma once
 
 // c++ include headers
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -15,6 +20,10 @@
 #include "cgnslib.h"
 
 // AIM include headers
+#include "src/computationalMesh/cgnsFileHandlePool/cgnsFileHandlePool.hpp"
+#include "src/computationalMesh/connectivityTable/connectivityTable.hpp"
+#include "src/computationalMesh/hdf5BulkReading/hdf5BulkReading.hpp"
+#include "src/types/enums.hpp"
 #include "src/types/types.hpp"
 
 // concept definition
@@ -26,19 +35,23 @@ namespace Mesh {
  * \brief This class processes a CGNS file from which the mesh properties are read
  * \ingroup mesh
  *
- * This class provides a wrapper around the cgns file format and reads mesh data from these files. The constructor takes
- * two arguments, the first being the location of the mesh and the second the dimensionality of the mesh. Then, the user
- * can load different aspects from the file. No data is stored in this class and it is the responsibility of the calling
- * method to store the data after calling it (i.e. there are no getter or setter methods implemented). The example below
- * shows how this class may be used.
+ * This class provides a wrapper around the cgns file format and reads mesh data from these files. The dimensionality of
+ * the mesh is provided as a template argument, so that dimension-specific code paths (e.g. reading the z-coordinate)
+ * are resolved at compile time and 2D meshes do not carry any 3D-specific code or data. The location of the mesh is
+ * read from the parameter file ("/mesh/filename"), readMeshFileName() resolves it without opening the file. Then, the
+ * user can load different aspects from the file. No data is stored in this class and it is the responsibility of the
+ * calling method to store the data after calling it (i.e. there are no getter or setter methods implemented). The
+ * example below shows how this class may be used.
  *
  * \code
  * // 2D mesh file
- * auto meshReader = AIM::Mesh::MeshReader{std::filesystem::path("path/to/file.cgns"), AIM::Enum::Dimension::Two};
+ * auto meshReader = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>{};
  * // 3D mesh file
- * auto meshReader = AIM::Mesh::MeshReader{std::filesystem::path("path/to/file.cgns"), AIM::Enum::Dimension::Three};
+ * auto meshReader = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Three>{};
+ * // 3D mesh file with 64-bit indices and coordinates stored in single precision
+ * auto meshReader = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Three, std::uint64_t, float>{};
  * ...
- * // read coordinates
+ * // read coordinates, the z-coordinate can only be read from 3D meshes
  * auto x = meshReader.readCoordinate<AIM::Enum::Coordinate::X>();
  * auto y = meshReader.readCoordinate<AIM::Enum::Coordinate::Y>();
  * auto z = meshReader.readCoordinate<AIM::Enum::Coordinate::Z>();
@@ -55,8 +68,16 @@ namespace Mesh {
  *
  * The coordinate arrays require a template index parameter to identify which coordinate to read (i.e x = 0, y = 1, and
  * z = 2). This can be circumvented by using a built-in enum to aid documentation, i.e. AIM::Enum::Coordinate::X,
- * AIM::Enum::Coordinate::Y or AIM::Enum::Coordinate::Z. It is a one dimensional array of type std::vector<FloatType>
- * where FloatType is typically a wrapper around double, but can be set to float in the src/types/types.hpp file.
+ * AIM::Enum::Coordinate::Y or AIM::Enum::Coordinate::Z. It is a one dimensional array of type std::vector<FloatType>.
+ *
+ * The index type of the connectivity table (IndexType, 32-bit or 64-bit unsigned) and the storage precision of the
+ * coordinates (FloatType, float or double) are template parameters as well and default to AIM::Types::UInt and
+ * AIM::Types::FloatType (see src/types/types.hpp). Narrow types halve the memory footprint and bandwidth of the mesh
+ * arrays, coordinates are converted by the CGNS library while reading. A std::runtime_error is thrown if the mesh has
+ * more vertices or connectivity entries than can be represented by the index type, instead of silently truncating.
+ *
+ * To write dimension-independent code, forEachCoordinate() calls a function once for each coordinate direction of the
+ * mesh, passing the coordinate index as a std::integral_constant so that it can be used as a template argument.
  *
  * \code
  * // loop over coordinates
@@ -67,11 +88,18 @@ namespace Mesh {
  * // loop using classical for loop
  * for (int i = 0; i < x.size(); ++i)
  *   std::cout << "coordinate x[" << i << "]: " << x[i] << std::endl;
+ *
+ * // read all coordinates of the mesh, independent of its dimension
+ * meshReader.forEachCoordinate([&meshReader](auto index) {
+ *   auto coordinate = meshReader.template readCoordinate<decltype(index)::value>();
+ * });
  * \endcode
  *
- * The connectivity table is a 2D vector with the first index being the number of cells in the mesh and the second index
- * being the number of vertices for the current cell type. For example, if we have a mesh with two elements, one tri and
- * one quad element, we may have the following structure:
+ * The connectivity table is stored in a flat (compressed sparse row) format, see AIM::Mesh::ConnectivityTable.
+ * Indexing into it with the cell index returns a std::span over the vertex indices of that cell, so that it can be used
+ * like a 2D array with the first index being the cell and the second index being the vertex of the current cell type.
+ * For example, if we have a mesh with two elements, one tri and one quad element, we may have the following structure
+ * (vertex indices are zero-based, i.e. they can be used directly to index into the coordinate arrays):
  *
  * \code
  * auto connectivityTable = meshReader.readConnectivityTable();
@@ -92,10 +120,20 @@ namespace Mesh {
  * auto cell_1_vertex_3 = connectivityTable[1][3];
  * \endcode
  *
+ * Cells are grouped by element type in the connectivity table, independent of the order of the element sections in
+ * the file: triangles come before quads in 2D meshes, tetrahedra before pyramids, prisms (penta) and hexahedra in 3D
+ * meshes. Sections of the same element type keep their order. Cells of MIXED element sections, which store the element
+ * type of each cell in front of its vertices, are sorted into these groups as well, after the cells of homogeneous
+ * sections of the same type. This allows the connectivity table to be split into homogeneous blocks with a fixed
+ * number of vertices per cell, see AIM::Mesh::ElementBlocks. Only linear element types are supported, i.e. TRI_3 and
+ * QUAD_4 for 2D and TETRA_4, PYRA_5, PENTA_6 and HEXA_8 for 3D meshes.
+ *
  * The boundary conditions are read into two different arrays. The first will provide information about the type
  * and boundary name and is stored in a std::vector<std::pair<int, std::string>>. The first index of the pair is an int
  * whose boundary condition can be queried using the build in enums. The second argument is the name of the boundary
- * condition assigned at the meshing stage. Example usage:
+ * condition assigned at the meshing stage. There is one entry per boundary, in the same order as the connectivity read
+ * below. Boundaries whose type, either set directly or through their family, is not one of the supported types are
+ * reported as AIM::Enum::BoundaryCondition::Unassigned. Example usage:
  *
  * \code
  * auto bc = meshReader.readBoundaryConditions();
@@ -130,23 +168,109 @@ namespace Mesh {
  *   std::cout << std::endl;
  * }
  * \endcode
+ *
+ * The element indices above refer to the boundary elements stored in the CGNS file (bar elements for 2D meshes, tri
+ * and quad elements for 3D meshes). Their vertices can be read with readBoundaryFaceConnectivity(), which returns one
+ * connectivity table per boundary condition, in the same order as readBoundaryConditionConnectivity(). The vertex
+ * indices are zero-based, like the ones of the cell connectivity table. Boundary conditions defined through an element
+ * range are expanded into the individual elements. Boundary elements may also be stored in MIXED element sections.
+ *
+ * \code
+ * auto boundaryFaces = meshReader.readBoundaryFaceConnectivity();
+ * for (const auto &face : boundaryFaces[0])
+ *   std::cout << "face of the first boundary between vertex " << face[0] << " and " << face[1] << std::endl;
+ * \endcode
+ *
+ * For meshes that do not fit into memory at once, the coordinates and the connectivity table can also be streamed in
+ * chunks of a fixed size. Only a single chunk is held in memory at any time, and it is passed to a user-provided
+ * function together with the (zero-based) index of its first vertex or cell. The chunk is reused for the next call, so
+ * its content has to be copied or processed before the function returns. Chunks of the connectivity table may contain
+ * cells from more than one element section, all chunks apart from the last one contain exactly chunkSize entries.
+ * Cells are streamed in the same order as returned by readConnectivityTable(). MIXED element sections can't be
+ * streamed, as their cells have to be regrouped by element type, a std::runtime_error is thrown for them instead.
+ *
+ * \code
+ * meshReader.readCoordinateInChunks<AIM::Enum::Coordinate::X>(1024, [](std::size_t firstVertex, auto x) {
+ *   for (std::size_t i = 0; i < x.size(); ++i)
+ *     std::cout << "coordinate x[" << firstVertex + i << "]: " << x[i] << std::endl;
+ * });
+ *
+ * meshReader.readConnectivityTableInChunks(1024, [](std::size_t firstCell, const auto &connectivityTable) {
+ *   for (std::size_t i = 0; i < connectivityTable.size(); ++i)
+ *     std::cout << "cell " << firstCell + i << " has " << connectivityTable[i].size() << " vertices" << std::endl;
+ * });
+ * \endcode
+ *
+ * Meshes may consist of more than one (unstructured) zone, stored in one or more bases whose cell dimension matches the
+ * mesh dimension. Bases of any other dimension are skipped, and reading fails only if no base matches. All zones of the
+ * matching bases are merged into a single mesh: vertices and cells are numbered zone by zone, in the order of the zones
+ * in the file, and cells are grouped by element type across all zones. Vertices shared between zones are merged into a
+ * single vertex, as described by the vertex-based 1-to-1 (Abutting1to1) general connectivity and the 1-to-1
+ * connectivity of the zones. A merged vertex takes the position of its first occurrence, periodic interfaces are not
+ * merged. Boundaries with the same name in different zones are merged into a single boundary. The element indices
+ * returned by readBoundaryConditionConnectivity() are made unique across zones by adding the number of elements of all
+ * previous zones to them. For multi-zone meshes, the read methods load each zone on its own thread, with its own file
+ * handle, and merge the zones once all of them are loaded. getNumberOfZones() returns the number of zones that were
+ * merged.
+ *
+ * If the mesh file was written with the HDF5 backend, the coordinates and element connectivities are read directly
+ * from their HDF5 datasets with an AIM::Mesh::HDF5BulkReader, bypassing the data conversions and copies of the CGNS
+ * library. All other data, as well as files written with the ADF backend, are read through the CGNS library. The
+ * direct path can be disabled with the parameter "/mesh/directHDF5Reading" (default: true).
+ *
+ * The mesh file is not opened by the MeshReader directly. Instead, each read method acquires an open file handle from
+ * an AIM::Mesh::CGNSFileHandlePool that is shared between all copies of a MeshReader, and returns it once it is done.
+ * Copies of a MeshReader are therefore cheap, never close the file twice and can be handed to other threads. The CGNS
+ * library is not thread-safe, not even for different files. All calls into the library are therefore serialised
+ * through AIM::Mesh::CGNSFileHandle::getLibraryMutex(), which makes it safe to call the read methods concurrently from
+ * different threads (on the same or on different MeshReader objects). The lock is only held while data is read from
+ * the file, any post-processing (e.g. converting the connectivity table to zero-based indices) happens after the lock
+ * has been released, so that it can overlap with reads issued by other threads.
+ *
+ * \code
+ * auto connectivityTable = std::async(std::launch::async, [&]() { return meshReader.readConnectivityTable(); });
+ * auto x = std::async(std::launch::async, [&]() { return meshReader.readCoordinate<AIM::Enum::Coordinate::X>(); });
+ * \endcode
  */
 
+template <int Dimensions, typename UnsignedInteger = AIM::Types::UInt, typename FloatingPoint = AIM::Types::FloatType>
 class MeshReader {
+  static_assert(Dimensions == AIM::Enum::Dimension::Two || Dimensions == AIM::Enum::Dimension::Three,
+    "meshes can only be two or three dimensional");
+  static_assert(AIM::Types::MeshIndexType<UnsignedInteger>, "mesh indices must be 32-bit or 64-bit unsigned");
+  static_assert(AIM::Types::MeshFloatType<FloatingPoint>, "mesh coordinates must be stored as float or double");
+
   /// \name Custom types used in this class
   /// @{
 public:
-  using CoordinateType = typename std::vector<AIM::Types::FloatType>;
-  using ConnectivityTableType = typename std::vector<std::vector<AIM::Types::UInt>>;
+  using IndexType = UnsignedInteger;
+  using FloatType = FloatingPoint;
+  using CoordinateType = typename std::vector<FloatType>;
+  using ConnectivityTableType = AIM::Mesh::ConnectivityTable<IndexType>;
   using BoundaryConditionType = typename std::vector<std::pair<int, std::string>>;
   using BoundaryConditionConnectivityType = typename std::vector<std::vector<AIM::Types::CGNSInt>>;
+  using BoundaryFaceConnectivityType = typename std::vector<ConnectivityTableType>;
+  using InterfaceVerticesType = typename std::vector<std::pair<std::size_t, std::size_t>>;
+
+private:
+  struct ZoneInfoType {
+    int base{1};
+    int zone{1};
+    std::string name;
+    std::string path;
+    std::vector<std::string> sectionNames;
+    std::size_t numberOfVertices{0};
+    std::size_t firstVertex{0};
+    AIM::Types::CGNSInt elementOffset{0};
+    AIM::Types::UInt numberOfBCs{0};
+  };
+  using CellSectionsType = std::vector<std::tuple<AIM::Types::UInt, AIM::Types::UInt, std::size_t>>;
   /// @}
 
   /// \name Constructors and destructors
   /// @{
 public:
-  MeshReader(short int dimensions);
-  ~MeshReader();
+  MeshReader();
   /// @}
 
   /// \name API interface that exposes behaviour to the caller
@@ -155,14 +279,26 @@ public:
   template <int Index>
   auto readCoordinate() -> CoordinateType;
   auto readConnectivityTable() -> ConnectivityTableType;
+  template <int Index, typename ChunkFunction>
+  auto readCoordinateInChunks(std::size_t chunkSize, ChunkFunction&& function) -> void;
+  template <typename ChunkFunction>
+  auto readConnectivityTableInChunks(std::size_t chunkSize, ChunkFunction&& function) -> void;
   auto readBoundaryConditions() -> BoundaryConditionType;
   auto readBoundaryConditionConnectivity() -> BoundaryConditionConnectivityType;
+  auto readBoundaryFaceConnectivity() -> BoundaryFaceConnectivityType;
+  template <typename Function>
+  static constexpr auto forEachCoordinate(Function&& function) -> void;
+  static auto mergeInterfaceVertices(std::size_t numberOfVertices, const InterfaceVerticesType& interfaceVertices)
+    -> std::vector<IndexType>;
+  static auto readMeshFileName() -> std::filesystem::path;
   /// @}
 
   /// \name Getters and setters
   /// @{
 public:
-  auto getDimensions() const -> short int { return dimensions_; }
+  static constexpr auto getDimensions() -> short int { return Dimensions; }
+  auto getMeshFile() const -> const std::filesystem::path& { return meshFile_; }
+  auto getNumberOfZones() const -> std::size_t { return zones_.size(); }
   /// @}
 
   /// \name Overloaded operators
@@ -174,36 +310,81 @@ public:
   /// @{
 private:
   auto readParameters() -> void;
-  auto getNumberOfBases() -> AIM::Types::UInt;
-  auto getNumberOfZones() -> AIM::Types::UInt;
-  auto getNumberOfVertices() -> AIM::Types::UInt;
-  auto getNumberOfCells() -> AIM::Types::UInt;
-  auto getNumberOfSections() -> AIM::Types::UInt;
-  auto getNumberOfBoundaryConditions() -> AIM::Types::UInt;
-  auto getNumberOfFamilies() -> AIM::Types::UInt;
-  auto getCellType(AIM::Types::UInt section) -> CGNS_ENUMT(ElementType_t);
-  auto addCurrentCellTypeToConnectivityTable(
-    AIM::Types::UInt section, AIM::Types::UInt numberOfVerticesPerCell, ConnectivityTableType& connectivity) -> void;
-  auto getNumberOfConnectivitiesForCellType(AIM::Types::UInt section, AIM::Types::UInt numVerticesPerCell)
-    -> AIM::Types::UInt;
-  auto writeConnectivityTable(AIM::Types::UInt section, AIM::Types::UInt elementSize,
-    AIM::Types::UInt numberOfVerticesPerCell, ConnectivityTableType& connectivity) -> void;
-  auto getCurrentBoundaryType(AIM::Types::UInt boundary)
+  template <int Index>
+  auto readZoneCoordinate(const ZoneInfoType& zone, FloatType* buffer) -> void;
+  template <int Index>
+  auto readCoordinateRangeIntoBuffer(int fileIndex, const ZoneInfoType& zone, std::size_t firstVertex,
+    std::size_t numberOfVertices, FloatType* buffer) -> void;
+  auto readZoneConnectivityTable(const ZoneInfoType& zone) -> ConnectivityTableType;
+  auto readZoneBoundaryFaceConnectivity(const ZoneInfoType& zone) -> BoundaryFaceConnectivityType;
+  template <typename ZoneFunction>
+  auto forEachZoneConcurrently(ZoneFunction&& function) -> void;
+  auto readZones(int fileIndex) -> void;
+  auto readZoneBoundaries(int fileIndex) -> void;
+  auto readInterfaceVertices(int fileIndex) -> InterfaceVerticesType;
+  auto findZone(int base, const std::string& name) const -> std::size_t;
+  auto toMergedVertex(const ZoneInfoType& zone, std::size_t vertex) const -> IndexType;
+  auto getNumberOfBases(int fileIndex) -> AIM::Types::UInt;
+  auto getNumberOfZones(int fileIndex, int base) -> AIM::Types::UInt;
+  auto getCellDimension(int fileIndex, int base) -> int;
+  auto getBaseName(int fileIndex, int base) -> std::string;
+  auto getSectionName(int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section) -> std::string;
+  auto isUnstructured(int fileIndex, int base, int zone) -> bool;
+  auto getZoneName(int fileIndex, int base, int zone) -> std::string;
+  auto getNumberOfVertices(int fileIndex, int base, int zone) -> std::size_t;
+  auto getNumberOfElements(int fileIndex, const ZoneInfoType& zone) -> std::size_t;
+  auto getNumberOfSections(int fileIndex, const ZoneInfoType& zone) -> AIM::Types::UInt;
+  auto getNumberOfBoundaryConditions(int fileIndex, int base, int zone) -> AIM::Types::UInt;
+  auto getCellType(int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section) -> CGNS_ENUMT(ElementType_t);
+  auto getNumberOfVerticesPerCell(CGNS_ENUMT(ElementType_t) cellType) -> AIM::Types::UInt;
+  auto getNumberOfVerticesPerFace(CGNS_ENUMT(ElementType_t) faceType) -> AIM::Types::UInt;
+  auto getCellSections(int fileIndex, const ZoneInfoType& zone) -> CellSectionsType;
+  auto getNumberOfConnectivitiesForCellType(int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section,
+    AIM::Types::UInt numVerticesPerCell) -> std::size_t;
+  auto getMixedSections(int fileIndex, const ZoneInfoType& zone)
+    -> std::vector<std::pair<AIM::Types::UInt, std::size_t>>;
+  auto getMixedElementOffsets(std::span<const AIM::Types::CGNSInt> elements) -> std::vector<std::size_t>;
+  auto groupCellsByElementType(const CellSectionsType& cellSections, const AIM::Types::CGNSInt* sectionIndices,
+    const std::vector<std::vector<AIM::Types::CGNSInt>>& mixedElements) -> ConnectivityTableType;
+  auto mergeZoneConnectivityTables(const std::vector<ConnectivityTableType>& zoneCells) -> ConnectivityTableType;
+  auto getElementDataSize(int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section) -> std::size_t;
+  auto readElementsIntoBuffer(int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section,
+    std::span<AIM::Types::CGNSInt> buffer, std::unique_lock<std::mutex>& lock) -> void;
+  auto getElementRangeOfSection(int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section)
+    -> std::pair<AIM::Types::CGNSInt, AIM::Types::CGNSInt>;
+  auto getFirstElementOfSection(int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section)
+    -> AIM::Types::CGNSInt;
+  auto readElementRangeIntoBuffer(int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt section,
+    AIM::Types::CGNSInt firstElement, AIM::Types::CGNSInt lastElement, AIM::Types::CGNSInt* buffer) -> void;
+  static auto convertToZeroBasedIndices(std::span<const AIM::Types::CGNSInt> rawIndices, std::span<IndexType> indices)
+    -> void;
+  static auto convertToZeroBasedIndicesInPlace(std::span<IndexType> indices) -> void;
+  static auto checkIndexTypeIsWideEnough(std::size_t numberOfEntries, const std::string& entries) -> void;
+  static auto throwOnCGNSError(int errorCode, const std::string& message) -> void;
+  auto getCurrentBoundaryType(int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt boundary)
     -> std::tuple<CGNS_ENUMT(BCType_t), std::string, AIM::Types::UInt>;
-  auto getCurrentFamilyType(AIM::Types::UInt boundary) -> CGNS_ENUMT(BCType_t);
-  auto writeBoundaryConnectivityIntoArray(AIM::Types::UInt boundary, BoundaryConditionConnectivityType& bcc) -> void;
+  auto getCurrentFamilyType(int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt boundary)
+    -> CGNS_ENUMT(BCType_t);
+  static auto toBoundaryCondition(CGNS_ENUMT(BCType_t) type) -> int;
+  auto readBoundaryElements(int fileIndex, const ZoneInfoType& zone, AIM::Types::UInt boundary, bool expandRanges)
+    -> std::vector<AIM::Types::CGNSInt>;
   /// @}
 
   /// \name Encapsulated data (private or protected variables)
   /// @{
 private:
-  const short int dimensions_{0};
   std::filesystem::path meshFile_{""};
-  int fileIndex_{0};
-  AIM::Types::UInt numberOfVertices_{0};
-  AIM::Types::UInt numberOfCells_{0};
+  std::shared_ptr<CGNSFileHandlePool> fileHandlePool_;
+  std::vector<ZoneInfoType> zones_;
+  std::vector<std::tuple<std::size_t, AIM::Types::UInt, std::size_t>> zoneBoundaries_;
+  std::shared_ptr<const std::vector<IndexType>> vertexMap_;
+  std::shared_ptr<const HDF5BulkReader> hdf5Reader_;
+  bool useDirectHDF5Reading_{true};
+  static constexpr const char* coordinateNames_[] = {"CoordinateX", "CoordinateY", "CoordinateZ"};
+  static constexpr auto cgnsIntDataType_ =
+    sizeof(AIM::Types::CGNSInt) == 8 ? CGNS_ENUMV(LongInteger) : CGNS_ENUMV(Integer);
+  std::size_t numberOfVertices_{0};
   AIM::Types::UInt numberOfBCs_{0};
-  AIM::Types::UInt numberOfFamilies_{0};
   /// @}
 };
 
@@ -3,14 +3,30 @@
 // (c) by Tom-Robin Teschner 2021. This file is distribuited under the MIT license.
 
 // c++ include headers
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <future>
 #include <iostream>
+#include <mutex>
+#include <ranges>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 // third-party include headers
 #include "cgnslib.h"
 
 // AIM include headers
+#include "src/computationalMesh/cgnsFileHandle/cgnsFileHandle.hpp"
+#include "src/computationalMesh/hdf5BulkReading/hdf5BulkReading.hpp"
+#include "src/types/enums.hpp"
 #include "src/types/types.hpp"
+#include "src/utilities/instrumentation/instrumentation.hpp"
 
 namespace AIM {
 namespace Mesh {
@@ -22,19 +38,157 @@ namespace Mesh {
 
 /// \name API interface that exposes behaviour to the caller
 /// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
 template <int Index>
-auto MeshReader::readCoordinate() -> MeshReader::CoordinateType {
-  AIM::Types::CGNSInt begin{1}, end{static_cast<AIM::Types::CGNSInt>(numberOfVertices_)};
-  auto coordinate = MeshReader::CoordinateType(numberOfVertices_);
-  auto coordinateName = std::vector<std::string>{"CoordinateX", "CoordinateY", "CoordinateZ"};
-  auto name = coordinateName[Index].c_str();
-
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readCoordinate() -> CoordinateType {
+  static_assert(Index >= 0 && Index < Dimensions, "coordinate index must be smaller than the mesh dimension");
+  AIM_INSTRUMENT_SCOPE("MeshReader::readCoordinate");
+  auto coordinate = CoordinateType(numberOfVertices_);
   assert(coordinate.size() > 0 && "Coordinate does not have any entries");
-  auto errorCode = cg_coord_read(fileIndex_, 1, 1, name, CGNS_ENUMV(RealDouble), &begin, &end, &coordinate[0]);
-  assert(errorCode == 0 && "Could not read coordinates from zone");
+  if (zones_.size() == 1 && !vertexMap_) {
+    readZoneCoordinate<Index>(zones_.front(), coordinate.data());
+    return coordinate;
+  }
 
+  // without shared vertices, the zones are written directly into their slice of the concatenated coordinate array
+  if (!vertexMap_) {
+    forEachZoneConcurrently([this, &coordinate](std::size_t zone) {
+      readZoneCoordinate<Index>(zones_[zone], coordinate.data() + zones_[zone].firstVertex);
+    });
+    return coordinate;
+  }
+
+  // shared vertices are read once per zone. They are scattered in reverse, so that the first occurrence is kept
+  auto zoneCoordinates = CoordinateType(zones_.back().firstVertex + zones_.back().numberOfVertices);
+  forEachZoneConcurrently([this, &zoneCoordinates](std::size_t zone) {
+    readZoneCoordinate<Index>(zones_[zone], zoneCoordinates.data() + zones_[zone].firstVertex);
+  });
+  for (std::size_t vertex = zoneCoordinates.size(); vertex-- > 0;)
+    coordinate[(*vertexMap_)[vertex]] = zoneCoordinates[vertex];
   return coordinate;
 }
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+template <int Index, typename ChunkFunction>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readCoordinateInChunks(
+  std::size_t chunkSize, ChunkFunction &&function) -> void {
+  static_assert(Index >= 0 && Index < Dimensions, "coordinate index must be smaller than the mesh dimension");
+  assert(chunkSize > 0 && "chunk size must be larger than zero");
+  AIM_INSTRUMENT_SCOPE("MeshReader::readCoordinateInChunks");
+  auto numberOfVertices = static_cast<std::size_t>(numberOfVertices_);
+  auto chunk = CoordinateType(std::min(chunkSize, numberOfVertices));
+  auto fileHandle = fileHandlePool_->acquire();
+
+  if (zones_.size() == 1 && !vertexMap_) {
+    for (std::size_t firstVertex = 0; firstVertex < numberOfVertices; firstVertex += chunkSize) {
+      auto numberOfVerticesInChunk = std::min(chunkSize, numberOfVertices - firstVertex);
+      readCoordinateRangeIntoBuffer<Index>(
+        fileHandle.getIndex(), zones_.front(), firstVertex, numberOfVerticesInChunk, chunk.data());
+      function(firstVertex, std::span<const FloatType>{chunk.data(), numberOfVerticesInChunk});
+    }
+    return;
+  }
+
+  // zones are read slice by slice. Merged vertices are numbered in order of their first occurrence, so a vertex is
+  // passed on if it is the next merged vertex, all later occurrences of shared vertices are skipped
+  auto zoneSlice = CoordinateType(std::min(chunkSize, numberOfVertices));
+  auto numberOfVerticesInChunk = std::size_t{0};
+  auto nextVertex = std::size_t{0};
+  for (const auto &zone : zones_) {
+    for (std::size_t firstVertex = 0; firstVertex < zone.numberOfVertices; firstVertex += zoneSlice.size()) {
+      auto numberOfVerticesInSlice = std::min(zoneSlice.size(), zone.numberOfVertices - firstVertex);
+      readCoordinateRangeIntoBuffer<Index>(
+        fileHandle.getIndex(), zone, firstVertex, numberOfVerticesInSlice, zoneSlice.data());
+      for (std::size_t vertex = 0; vertex < numberOfVerticesInSlice; ++vertex) {
+        if (vertexMap_ && (*vertexMap_)[zone.firstVertex + firstVertex + vertex] != nextVertex)
+          continue;
+        chunk[numberOfVerticesInChunk++] = zoneSlice[vertex];
+        ++nextVertex;
+        if (numberOfVerticesInChunk == chunk.size()) {
+          function(nextVertex - numberOfVerticesInChunk, std::span<const FloatType>{chunk.data(), chunk.size()});
+          numberOfVerticesInChunk = 0;
+        }
+      }
+    }
+  }
+
+  if (numberOfVerticesInChunk > 0)
+    function(nextVertex - numberOfVerticesInChunk, std::span<const FloatType>{chunk.data(), numberOfVerticesInChunk});
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+template <typename ChunkFunction>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readConnectivityTableInChunks(
+  std::size_t chunkSize, ChunkFunction &&function) -> void {
+  assert(chunkSize > 0 && "chunk size must be larger than zero");
+  AIM_INSTRUMENT_SCOPE("MeshReader::readConnectivityTableInChunks");
+
+  auto fileHandle = fileHandlePool_->acquire();
+  auto fileIndex = fileHandle.getIndex();
+  auto lock = std::unique_lock{CGNSFileHandle::getLibraryMutex()};
+
+  // sections of all zones are visited grouped by element type, matching the order of readConnectivityTable()
+  auto cellSections = std::vector<std::tuple<std::size_t, AIM::Types::UInt, AIM::Types::UInt, std::size_t>>{};
+  auto firstElementOfSections = std::vector<AIM::Types::CGNSInt>{};
+  auto maxNumberOfVerticesPerCell = std::size_t{0};
+  for (std::size_t zone = 0; zone < zones_.size(); ++zone) {
+    if (!getMixedSections(fileIndex, zones_[zone]).empty())
+      throw std::runtime_error("mixed element sections can't be read in chunks, use readConnectivityTable() instead");
+    for (const auto &[section, numberOfVerticesPerCell, elementSize] : getCellSections(fileIndex, zones_[zone])) {
+      cellSections.emplace_back(zone, section, numberOfVerticesPerCell, elementSize);
+      maxNumberOfVerticesPerCell = std::max(maxNumberOfVerticesPerCell, std::size_t{numberOfVerticesPerCell});
+    }
+  }
+  std::ranges::stable_sort(cellSections, {}, [](const auto &section) { return std::get<2>(section); });
+  for (const auto &[zone, section, numberOfVerticesPerCell, elementSize] : cellSections)
+    firstElementOfSections.push_back(getFirstElementOfSection(fileIndex, zones_[zone], section));
+  lock.unlock();
+
+  auto chunk = ConnectivityTableType{};
+  chunk.reserve(chunkSize, chunkSize * maxNumberOfVerticesPerCell);
+  auto rawIndices = std::vector<AIM::Types::CGNSInt>(chunkSize * maxNumberOfVerticesPerCell);
+  auto firstCellOfChunk = std::size_t{0};
+
+  for (std::size_t i = 0; i < cellSections.size(); ++i) {
+    const auto &[zone, section, numberOfVerticesPerCell, elementSize] = cellSections[i];
+    auto numberOfElements = std::size_t{elementSize / numberOfVerticesPerCell};
+    auto toMerged = std::views::transform([this, &zoneInfo = zones_[zone]](AIM::Types::CGNSInt vertex) {
+      return toMergedVertex(zoneInfo, static_cast<std::size_t>(vertex - 1));
+    });
+
+    for (std::size_t element = 0; element < numberOfElements;) {
+      auto numberOfElementsToRead = std::min(numberOfElements - element, chunkSize - chunk.size());
+      auto firstElement = firstElementOfSections[i] + static_cast<AIM::Types::CGNSInt>(element);
+      auto lastElement = firstElement + static_cast<AIM::Types::CGNSInt>(numberOfElementsToRead) - 1;
+
+      lock.lock();
+      readElementRangeIntoBuffer(fileIndex, zones_[zone], section, firstElement, lastElement, rawIndices.data());
+      lock.unlock();
+
+      for (std::size_t cell = 0; cell < numberOfElementsToRead; ++cell)
+        chunk.addCell(std::span{rawIndices}.subspan(cell * numberOfVerticesPerCell, numberOfVerticesPerCell) |
+                      toMerged);
+      element += numberOfElementsToRead;
+
+      if (chunk.size() == chunkSize) {
+        function(firstCellOfChunk, std::as_const(chunk));
+        firstCellOfChunk += chunk.size();
+        chunk.clear();
+      }
+    }
+  }
+
+  if (!chunk.empty())
+    function(firstCellOfChunk, std::as_const(chunk));
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+template <typename Function>
+constexpr auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::forEachCoordinate(Function &&function) -> void {
+  [&function]<int... Index>(std::integer_sequence<int, Index...>) {
+    (function(std::integral_constant<int, Index>{}), ...);
+  }(std::make_integer_sequence<int, Dimensions>{});
+}
 /// @}
 
 /// \name Getters and setters
@@ -49,7 +203,52 @@ auto MeshReader::readCoordinate() -> MeshReader::CoordinateType {
 
 /// \name Private or protected implementation details, not exposed to the caller
 /// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+template <int Index>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readZoneCoordinate(
+  const ZoneInfoType& zone, FloatType *buffer) -> void {
+  AIM_INSTRUMENT_SCOPE("readZoneCoordinate");
+  AIM_INSTRUMENT_COUNT("bytes", zone.numberOfVertices * sizeof(FloatType));
+  if (hdf5Reader_) {
+    hdf5Reader_->readNode(
+      zone.path + "/GridCoordinates/" + coordinateNames_[Index], std::span{buffer, zone.numberOfVertices});
+    return;
+  }
+  auto fileHandle = fileHandlePool_->acquire();
+  readCoordinateRangeIntoBuffer<Index>(fileHandle.getIndex(), zone, 0, zone.numberOfVertices, buffer);
+}
 
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+template <int Index>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::readCoordinateRangeIntoBuffer(
+  int fileIndex, const ZoneInfoType& zone, std::size_t firstVertex, std::size_t numberOfVertices, FloatType *buffer)
+  -> void {
+  AIM::Types::CGNSInt begin{static_cast<AIM::Types::CGNSInt>(firstVertex + 1)};
+  AIM::Types::CGNSInt end{static_cast<AIM::Types::CGNSInt>(firstVertex + numberOfVertices)};
+
+  // the CGNS library converts the coordinates into the requested storage precision while reading
+  constexpr auto dataType = std::is_same_v<FloatType, float> ? CGNS_ENUMV(RealSingle) : CGNS_ENUMV(RealDouble);
+
+  auto lock = std::scoped_lock{CGNSFileHandle::getLibraryMutex()};
+  auto errorCode =
+    cg_coord_read(fileIndex, zone.base, zone.zone, coordinateNames_[Index], dataType, &begin, &end, buffer);
+  assert(errorCode == 0 && "Could not read coordinates from zone");
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+template <typename ZoneFunction>
+auto MeshReader<Dimensions, UnsignedInteger, FloatingPoint>::forEachZoneConcurrently(ZoneFunction&& function) -> void {
+  // the first zone is processed on the calling thread, all others on their own thread. Each acquires its own file
+  // handle, calls into the CGNS library are serialised, but the post-processing of different zones overlaps
+  auto workers = std::vector<std::future<void>>{};
+  for (std::size_t zone = 1; zone < zones_.size(); ++zone)
+    workers.push_back(std::async(std::launch::async, [&function, zone]() { function(zone); }));
+  function(std::size_t{0});
+
+  // exceptions thrown on any of the worker threads are rethrown here
+  for (auto &worker : workers)
+    worker.get();
+}
 /// @}
 
 /// \name Encapsulated data (private or protected variables)
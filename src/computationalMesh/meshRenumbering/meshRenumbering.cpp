@@ -0,0 +1,361 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/inverseConnectivity/inverseConnectivity.hpp"
+#include "src/computationalMesh/meshRenumbering/meshRenumbering.hpp"
+#include "src/types/enums.hpp"
+
+namespace AIM {
+namespace Mesh {
+
+/// \name Constructors and destructors
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::MeshRenumbering(AIM::Enum::Renumbering method)
+  : method_(method) {}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::getMethodFromString(
+  const std::string& method) -> AIM::Enum::Renumbering {
+  if (method == "none")
+    return AIM::Enum::Renumbering::NoRenumbering;
+  if (method == "reverseCuthillMcKee")
+    return AIM::Enum::Renumbering::ReverseCuthillMcKee;
+  if (method == "hilbert")
+    return AIM::Enum::Renumbering::HilbertCurve;
+  if (method == "morton")
+    return AIM::Enum::Renumbering::MortonCurve;
+  throw std::runtime_error("unknown mesh renumbering method: " + method +
+                           " (expected none, reverseCuthillMcKee, hilbert or morton)");
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::computeStatistics(
+  const ConnectivityTableType& cells) -> StatisticsType {
+  auto identity = PermutationType(cells.size());
+  std::iota(identity.begin(), identity.end(), IndexType{0});
+  return computeStatistics(buildCellAdjacency(cells), identity);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::renumber(
+  const CoordinatesViewType& coordinates, const ConnectivityTableType& cells) -> void {
+  auto adjacency = buildCellAdjacency(cells);
+  cellOrder_.resize(cells.size());
+  std::iota(cellOrder_.begin(), cellOrder_.end(), IndexType{0});
+  statisticsBefore_ = computeStatistics(adjacency, cellOrder_);
+
+  switch (method_) {
+    case AIM::Enum::Renumbering::NoRenumbering: break;
+    case AIM::Enum::Renumbering::ReverseCuthillMcKee: cellOrder_ = reverseCuthillMcKee(adjacency); break;
+    case AIM::Enum::Renumbering::HilbertCurve:
+    case AIM::Enum::Renumbering::MortonCurve: cellOrder_ = spaceFillingCurve(coordinates, cells, method_); break;
+  }
+
+  // cells stay grouped by element type (see AIM::Mesh::ElementBlocks), the new order only applies within each group
+  std::ranges::stable_sort(cellOrder_, {}, [&cells](IndexType cell) { return cells.getNumberOfVerticesForCell(cell); });
+
+  statisticsAfter_ = computeStatistics(adjacency, invert(cellOrder_));
+  orderVerticesByFirstReference(cells, coordinates[AIM::Enum::Coordinate::X].size());
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::permuteCoordinate(
+  CoordinateViewType coordinate) const -> std::vector<FloatType> {
+  auto permutedCoordinate = std::vector<FloatType>(coordinate.size());
+  for (std::size_t vertex = 0; vertex < permutedCoordinate.size(); ++vertex)
+    permutedCoordinate[vertex] = coordinate[vertexOrder_[vertex]];
+  return permutedCoordinate;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::permuteConnectivityTable(
+  const ConnectivityTableType& cells) const -> ConnectivityTableType {
+  auto toNewVertex = std::views::transform([this](IndexType vertex) { return vertexMap_[vertex]; });
+  auto permutedCells = ConnectivityTableType{};
+  permutedCells.reserve(cells.size(), cells.getNumberOfIndices());
+  for (const auto &cell : cellOrder_)
+    permutedCells.addCell(cells[cell] | toNewVertex);
+  return permutedCells;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::permuteBoundaryFaces(
+  const BoundaryFaceConnectivityType& boundaryFaces) const -> BoundaryFaceConnectivityType {
+  auto toNewVertex = std::views::transform([this](IndexType vertex) { return vertexMap_[vertex]; });
+  auto permutedBoundaryFaces = BoundaryFaceConnectivityType(boundaryFaces.size());
+  for (std::size_t boundary = 0; boundary < boundaryFaces.size(); ++boundary) {
+    const auto &faces = boundaryFaces[boundary];
+    permutedBoundaryFaces[boundary].reserve(faces.size(), faces.getNumberOfIndices());
+    for (const auto &face : faces)
+      permutedBoundaryFaces[boundary].addCell(face | toNewVertex);
+  }
+  return permutedBoundaryFaces;
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::buildCellAdjacency(
+  const ConnectivityTableType& cells) -> ConnectivityTableType {
+  // face neighbours, as used by the flux loops and the partitioning, built in parallel by the inverse connectivity
+  return InverseConnectivity<Dimensions, UnsignedInteger>{cells}.getCellToCell();
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::computeStatistics(
+  const ConnectivityTableType& adjacency, const PermutationType& cellMap) -> StatisticsType {
+  // the profile sums, for each row of the adjacency matrix, the distance from the diagonal to the first non-zero entry
+  auto statistics = StatisticsType{};
+  for (std::size_t cell = 0; cell < adjacency.size(); ++cell) {
+    auto row = static_cast<std::size_t>(cellMap[cell]);
+    auto firstColumn = row;
+    for (const auto &neighbour : adjacency[cell]) {
+      auto column = static_cast<std::size_t>(cellMap[neighbour]);
+      statistics.bandwidth = std::max(statistics.bandwidth, row > column ? row - column : column - row);
+      firstColumn = std::min(firstColumn, column);
+    }
+    statistics.profile += row - firstColumn;
+  }
+  return statistics;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::invert(
+  const PermutationType& order) -> PermutationType {
+  auto inverse = PermutationType(order.size());
+  for (std::size_t index = 0; index < order.size(); ++index)
+    inverse[order[index]] = static_cast<IndexType>(index);
+  return inverse;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::reverseCuthillMcKee(
+  const ConnectivityTableType& adjacency) -> PermutationType {
+  auto degree = [&adjacency](IndexType cell) { return adjacency.getNumberOfVerticesForCell(cell); };
+  auto byDegree = [&degree](IndexType lhs, IndexType rhs) {
+    return std::pair{degree(lhs), lhs} < std::pair{degree(rhs), rhs};
+  };
+
+  // each connected component is traversed separately, starting from its cell with the lowest degree
+  auto seeds = PermutationType(adjacency.size());
+  std::iota(seeds.begin(), seeds.end(), IndexType{0});
+  std::ranges::sort(seeds, byDegree);
+
+  auto order = PermutationType{};
+  order.reserve(adjacency.size());
+  auto visited = std::vector<bool>(adjacency.size(), false);
+  auto levels = std::vector<std::size_t>(adjacency.size(), std::numeric_limits<std::size_t>::max());
+  auto neighbours = PermutationType{};
+  for (const auto &seed : seeds) {
+    if (visited[seed])
+      continue;
+    auto start = findPseudoPeripheralCell(adjacency, seed, levels);
+    visited[start] = true;
+    order.push_back(start);
+    for (auto head = order.size() - 1; head < order.size(); ++head) {
+      neighbours.clear();
+      for (const auto &neighbour : adjacency[order[head]])
+        if (!visited[neighbour]) {
+          visited[neighbour] = true;
+          neighbours.push_back(neighbour);
+        }
+      std::ranges::sort(neighbours, byDegree);
+      order.insert(order.end(), neighbours.begin(), neighbours.end());
+    }
+  }
+  std::ranges::reverse(order);
+  return order;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::findPseudoPeripheralCell(
+  const ConnectivityTableType& adjacency, IndexType start, std::vector<std::size_t>& levels) -> IndexType {
+  // George-Liu: repeat breadth-first searches from the lowest-degree cell of the last level while the number of levels
+  // (the eccentricity of the root) keeps increasing
+  auto unvisited = std::numeric_limits<std::size_t>::max();
+  auto queue = PermutationType{};
+  auto breadthFirstSearch = [&](IndexType root) {
+    queue.assign(1, root);
+    levels[root] = 0;
+    for (std::size_t head = 0; head < queue.size(); ++head)
+      for (const auto &neighbour : adjacency[queue[head]])
+        if (levels[neighbour] == unvisited) {
+          levels[neighbour] = levels[queue[head]] + 1;
+          queue.push_back(neighbour);
+        }
+
+    auto eccentricity = levels[queue.back()];
+    auto candidate = queue.back();
+    for (const auto &cell : queue) {
+      if (levels[cell] == eccentricity &&
+          adjacency.getNumberOfVerticesForCell(cell) < adjacency.getNumberOfVerticesForCell(candidate))
+        candidate = cell;
+      levels[cell] = unvisited;
+    }
+    return std::pair{eccentricity, candidate};
+  };
+
+  auto root = start;
+  auto [eccentricity, candidate] = breadthFirstSearch(root);
+  while (candidate != root) {
+    auto [candidateEccentricity, nextCandidate] = breadthFirstSearch(candidate);
+    if (candidateEccentricity <= eccentricity)
+      break;
+    root = candidate;
+    eccentricity = candidateEccentricity;
+    candidate = nextCandidate;
+  }
+  return root;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::spaceFillingCurve(
+  const CoordinatesViewType& coordinates, const ConnectivityTableType& cells,
+  AIM::Enum::Renumbering curve) -> PermutationType {
+  constexpr auto numberOfDimensions = static_cast<std::size_t>(Dimensions);
+  using PositionType = std::array<std::uint32_t, numberOfDimensions>;
+
+  auto centroids = std::vector<std::array<double, numberOfDimensions>>(cells.size());
+  auto lower = std::array<double, numberOfDimensions>{};
+  auto upper = std::array<double, numberOfDimensions>{};
+  lower.fill(std::numeric_limits<double>::max());
+  upper.fill(std::numeric_limits<double>::lowest());
+  for (std::size_t cell = 0; cell < cells.size(); ++cell) {
+    for (std::size_t dimension = 0; dimension < numberOfDimensions; ++dimension) {
+      auto sum = 0.0;
+      for (const auto &vertex : cells[cell])
+        sum += static_cast<double>(coordinates[dimension][vertex]);
+      centroids[cell][dimension] = sum / static_cast<double>(cells[cell].size());
+      lower[dimension] = std::min(lower[dimension], centroids[cell][dimension]);
+      upper[dimension] = std::max(upper[dimension], centroids[cell][dimension]);
+    }
+  }
+
+  // centroids are quantised onto a uniform grid spanning their bounding box before computing the curve index
+  constexpr auto maximumPosition = static_cast<double>((std::uint64_t{1} << bitsPerDirection_) - 1);
+  auto keys = std::vector<std::pair<std::uint64_t, IndexType>>(cells.size());
+  for (std::size_t cell = 0; cell < cells.size(); ++cell) {
+    auto position = PositionType{};
+    for (std::size_t dimension = 0; dimension < numberOfDimensions; ++dimension) {
+      auto extent = upper[dimension] - lower[dimension];
+      auto scaled = extent > 0.0 ? (centroids[cell][dimension] - lower[dimension]) / extent * maximumPosition : 0.0;
+      position[dimension] = static_cast<std::uint32_t>(std::clamp(scaled, 0.0, maximumPosition));
+    }
+    auto key = curve == AIM::Enum::Renumbering::HilbertCurve ? hilbertKey(position) : mortonKey(position);
+    keys[cell] = {key, static_cast<IndexType>(cell)};
+  }
+  std::ranges::sort(keys);
+
+  auto order = PermutationType(cells.size());
+  std::ranges::transform(keys, order.begin(), [](const auto &key) { return key.second; });
+  return order;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::mortonKey(
+  std::array<std::uint32_t, static_cast<std::size_t>(Dimensions)> position) -> std::uint64_t {
+  auto key = std::uint64_t{0};
+  for (auto bit = bitsPerDirection_; bit-- > 0;)
+    for (const auto &coordinate : position)
+      key = (key << 1) | ((coordinate >> bit) & 1u);
+  return key;
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::hilbertKey(
+  std::array<std::uint32_t, static_cast<std::size_t>(Dimensions)> position) -> std::uint64_t {
+  // Skilling's algorithm (AIP Conference Proceedings 707, 2004): transform the position into the transposed Hilbert
+  // index in place, then interleave its bits just like a Morton key
+  auto &x = position;
+  const auto last = x.size() - 1;
+  for (auto q = std::uint32_t{1} << (bitsPerDirection_ - 1); q > 1; q >>= 1) {
+    auto p = q - 1;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+      if (x[i] & q)
+        x[0] ^= p;
+      else {
+        auto t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  for (std::size_t i = 1; i < x.size(); ++i)
+    x[i] ^= x[i - 1];
+  auto t = std::uint32_t{0};
+  for (auto q = std::uint32_t{1} << (bitsPerDirection_ - 1); q > 1; q >>= 1)
+    if (x[last] & q)
+      t ^= q - 1;
+  for (auto &coordinate : x)
+    coordinate ^= t;
+
+  return mortonKey(x);
+}
+
+template <int Dimensions, typename UnsignedInteger, typename FloatingPoint>
+auto MeshRenumbering<Dimensions, UnsignedInteger, FloatingPoint>::orderVerticesByFirstReference(
+  const ConnectivityTableType& cells, std::size_t numberOfVertices) -> void {
+  auto unnumbered = std::numeric_limits<IndexType>::max();
+  auto nextVertex = IndexType{0};
+  vertexMap_.assign(numberOfVertices, unnumbered);
+  for (const auto &cell : cellOrder_)
+    for (const auto &vertex : cells[cell])
+      if (vertexMap_[vertex] == unnumbered)
+        vertexMap_[vertex] = nextVertex++;
+  for (auto &vertex : vertexMap_)
+    if (vertex == unnumbered)
+      vertex = nextVertex++;
+  vertexOrder_ = invert(vertexMap_);
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+// explicit instantiation of the supported mesh dimensions, index and floating point types
+template class MeshRenumbering<AIM::Enum::Dimension::Two, std::uint32_t, float>;
+template class MeshRenumbering<AIM::Enum::Dimension::Two, std::uint32_t, double>;
+template class MeshRenumbering<AIM::Enum::Dimension::Two, std::uint64_t, float>;
+template class MeshRenumbering<AIM::Enum::Dimension::Two, std::uint64_t, double>;
+template class MeshRenumbering<AIM::Enum::Dimension::Three, std::uint32_t, float>;
+template class MeshRenumbering<AIM::Enum::Dimension::Three, std::uint32_t, double>;
+template class MeshRenumbering<AIM::Enum::Dimension::Three, std::uint64_t, float>;
+template class MeshRenumbering<AIM::Enum::Dimension::Three, std::uint64_t, double>;
+
+}  // namespace Mesh
+}  // end namespace AIM
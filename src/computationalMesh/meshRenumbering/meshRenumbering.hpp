@@ -0,0 +1,155 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/computationalMesh/connectivityTable/connectivityTable.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+// concept definition
+
+namespace AIM {
+namespace Mesh {
+
+/**
+ * \class MeshRenumbering
+ * \brief Computes a cache-friendly order of the cells and vertices and permutes the mesh arrays accordingly
+ * \ingroup mesh
+ *
+ * Cells and vertices are stored in the order the mesh generator wrote them into the CGNS file, which often places
+ * neighbouring cells far apart in memory. Loops that gather vertex data for each cell (or scatter fluxes into
+ * neighbouring cells) then miss the cache on almost every access. This class computes a new cell order using one of the
+ * following methods (see AIM::Enum::Renumbering):
+ *
+ * - ReverseCuthillMcKee: breadth-first traversal of the cell adjacency graph (cells sharing a face, see
+ *   AIM::Mesh::InverseConnectivity::getCellToCell()), starting from a pseudo-peripheral cell and visiting neighbours in
+ *   order of increasing degree. The result is reversed, which minimises the bandwidth and profile of the cell adjacency
+ *   matrix.
+ * - HilbertCurve / MortonCurve: cells are sorted along a space-filling curve through their centroids, which keeps
+ *   cells that are close in space close in memory, independent of the mesh connectivity.
+ *
+ * Cells of different element types are not mixed by the new order, it is applied within each group of cells of the same
+ * element type, so that the renumbered mesh can still be split into homogeneous blocks (see AIM::Mesh::ElementBlocks).
+ * Vertices are then renumbered in the order in which they are first referenced by the renumbered cells, so that the
+ * vertices of neighbouring cells are close in memory as well. Vertices not referenced by any cell keep their relative
+ * order and are placed last. The bandwidth and profile of the cell adjacency matrix are computed before and after the
+ * renumbering, so that the effect of the chosen method can be reported.
+ *
+ * The permutations are stored as new-to-old maps, i.e. getCellOrder()[newCell] returns the original index of the cell.
+ * The permute*() methods return renumbered copies of the mesh arrays. Boundary faces store vertex indices and are
+ * updated, the boundary condition connectivity stores CGNS element indices of the boundary elements and is unaffected.
+ *
+ * \code
+ * auto renumbering = AIM::Mesh::MeshRenumbering<AIM::Enum::Dimension::Two>{AIM::Enum::Renumbering::HilbertCurve};
+ * renumbering.renumber({x, y}, connectivityTable);
+ *
+ * auto renumberedX = renumbering.permuteCoordinate(x);
+ * auto renumberedConnectivityTable = renumbering.permuteConnectivityTable(connectivityTable);
+ * std::cout << "bandwidth reduced from " << renumbering.getStatisticsBefore().bandwidth << " to "
+ *           << renumbering.getStatisticsAfter().bandwidth << std::endl;
+ * \endcode
+ */
+
+template <int Dimensions, typename UnsignedInteger = AIM::Types::UInt, typename FloatingPoint = AIM::Types::FloatType>
+class MeshRenumbering {
+  static_assert(AIM::Types::MeshIndexType<UnsignedInteger>, "mesh indices must be 32-bit or 64-bit unsigned");
+  static_assert(AIM::Types::MeshFloatType<FloatingPoint>, "mesh coordinates must be stored as float or double");
+
+  /// \name Custom types used in this class
+  /// @{
+public:
+  using IndexType = UnsignedInteger;
+  using FloatType = FloatingPoint;
+  using CoordinateViewType = std::span<const FloatType>;
+  using CoordinatesViewType = std::array<CoordinateViewType, static_cast<std::size_t>(Dimensions)>;
+  using ConnectivityTableType = ConnectivityTable<IndexType>;
+  using BoundaryFaceConnectivityType = typename std::vector<ConnectivityTableType>;
+  using PermutationType = std::vector<IndexType>;
+
+  struct StatisticsType {
+    std::size_t bandwidth{0};
+    std::size_t profile{0};
+  };
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  MeshRenumbering(AIM::Enum::Renumbering method = AIM::Enum::Renumbering::NoRenumbering);
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  static auto getMethodFromString(const std::string& method) -> AIM::Enum::Renumbering;
+  static auto computeStatistics(const ConnectivityTableType& cells) -> StatisticsType;
+  auto renumber(const CoordinatesViewType& coordinates, const ConnectivityTableType& cells) -> void;
+  auto permuteCoordinate(CoordinateViewType coordinate) const -> std::vector<FloatType>;
+  auto permuteConnectivityTable(const ConnectivityTableType& cells) const -> ConnectivityTableType;
+  auto permuteBoundaryFaces(const BoundaryFaceConnectivityType& boundaryFaces) const -> BoundaryFaceConnectivityType;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getMethod() const -> AIM::Enum::Renumbering { return method_; }
+  auto getCellOrder() const -> const PermutationType& { return cellOrder_; }
+  auto getVertexOrder() const -> const PermutationType& { return vertexOrder_; }
+  auto getStatisticsBefore() const -> const StatisticsType& { return statisticsBefore_; }
+  auto getStatisticsAfter() const -> const StatisticsType& { return statisticsAfter_; }
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  static auto buildCellAdjacency(const ConnectivityTableType& cells) -> ConnectivityTableType;
+  static auto computeStatistics(const ConnectivityTableType& adjacency, const PermutationType& cellMap)
+    -> StatisticsType;
+  static auto invert(const PermutationType& order) -> PermutationType;
+  static auto reverseCuthillMcKee(const ConnectivityTableType& adjacency) -> PermutationType;
+  static auto findPseudoPeripheralCell(const ConnectivityTableType& adjacency, IndexType start,
+    std::vector<std::size_t>& levels) -> IndexType;
+  static auto spaceFillingCurve(const CoordinatesViewType& coordinates, const ConnectivityTableType& cells,
+    AIM::Enum::Renumbering curve) -> PermutationType;
+  static auto mortonKey(std::array<std::uint32_t, static_cast<std::size_t>(Dimensions)> position) -> std::uint64_t;
+  static auto hilbertKey(std::array<std::uint32_t, static_cast<std::size_t>(Dimensions)> position) -> std::uint64_t;
+  auto orderVerticesByFirstReference(const ConnectivityTableType& cells, std::size_t numberOfVertices) -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  // number of bits per coordinate direction used to quantise centroids, chosen so that a key fits into 64 bits
+  static constexpr std::uint32_t bitsPerDirection_{Dimensions == AIM::Enum::Dimension::Two ? 32u : 21u};
+
+  AIM::Enum::Renumbering method_;
+  PermutationType cellOrder_;
+  PermutationType vertexOrder_;
+  PermutationType vertexMap_;
+  StatisticsType statisticsBefore_;
+  StatisticsType statisticsAfter_;
+  /// @}
+};
+
+}  // namespace Mesh
+}  // end namespace AIM
+
+#include "meshRenumbering.tpp"
@@ -3,7 +3,14 @@
 // (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
 
 // c++ include headers
+#include <cstddef>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
 
 // third-party include headers
 
@@ -20,7 +27,25 @@ namespace Parameters {
 
 /// \name API interface that exposes behaviour to the caller
 /// @{
+auto ParameterFileReading::getJSONFile(const std::filesystem::path& file) -> std::shared_ptr<const nlohmann::json> {
+  AIM::Utilities::FileChecker::checkIfFileExists(file);
+  auto key = std::filesystem::absolute(file).lexically_normal().string();
+
+  // the timestamp of a file rewritten in quick succession may not change, so the cache is validated by the content.
+  // Reading and hashing the raw file is cheap compared to parsing it
+  auto content = readFileContent(file);
+  auto contentHash = std::hash<std::string>{}(content);
 
+  auto lock = std::lock_guard<std::mutex>{cacheMutex_};
+  auto cachedFile = cache_.find(key);
+  if (cachedFile != cache_.end() && cachedFile->second.fileSize == content.size() &&
+      cachedFile->second.contentHash == contentHash)
+    return cachedFile->second.jsonFile;
+
+  auto jsonFile = std::make_shared<const nlohmann::json>(nlohmann::json::parse(content));
+  cache_[key] = CachedFileType{content.size(), contentHash, jsonFile};
+  return jsonFile;
+}
 /// @}
 
 /// \name Getters and setters
@@ -35,12 +60,9 @@ namespace Parameters {
 
 /// \name Private or protected implementation details, not exposed to the caller
 /// @{
-auto ParameterFileReading::getJSONFile(const std::filesystem::path& file) -> nlohmann::json {
-  AIM::Utilities::FileChecker::checkIfFileExists(file);
-  std::ifstream rawFile(file);
-  auto jsonFile = nlohmann::json{};
-  rawFile >> jsonFile;
-  return jsonFile;
+auto ParameterFileReading::readFileContent(const std::filesystem::path& file) -> std::string {
+  auto rawFile = std::ifstream{file, std::ios::binary};
+  return std::string{std::istreambuf_iterator<char>{rawFile}, std::istreambuf_iterator<char>{}};
 }
 /// @}
 
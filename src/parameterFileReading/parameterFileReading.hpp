@@ -5,9 +5,13 @@
 #pragma once
 
 // c++ include headers
+#include <cstddef>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <unordered_map>
 
 // third-party include headers
 #include "nlohmann/json.hpp"
@@ -24,14 +28,18 @@ namespace Parameters {
  * \brief Read parameters from any input file in JSON format
  * \ingroup Parameters
  *
- * This class exposes only a single static method and can't be instantiated (constructors, move constructors and
- * assignment operator are deleted as there is no internal state that is stored by the class). The exposed method will
- * attempt to read a parameter from the provided input file and convert it to the type provided. Exception checking will
- * ensure that the parameter exists and that it can be converted to the specified type. Any unhandled exceptions will be
- * captured and the solver will terminate if it can't recover from this situation. A default value can optionally be
- * provided which will be used if the specified parameter can't be located in the input file. If a default value can be
- * prescribed, it should. The philosophy here is that the solver should be able to run with as small of an input script
- * as possible.
+ * This class exposes only static methods and can't be instantiated (constructors, move constructors and assignment
+ * operator are deleted). Each input file is parsed only once, the parsed JSON document is cached and shared by all
+ * subsequent lookups of the same file (on any thread), so that reading many parameters does not re-parse the file every
+ * time. The cache is keyed by the absolute path of the file and invalidated if the size or the content hash of the file
+ * changes, so that a file rewritten within the timestamp granularity of the filesystem is not missed. For reading many
+ * parameters at once, see ParameterRegistry, which also validates them in one batch. The
+ * readParameterOrGetDefaultValue() method will attempt to read a parameter from the provided input file and convert it
+ * to the type provided. Exception checking will ensure that the parameter exists and that it can be converted to the
+ * specified type. Any unhandled exceptions will be captured and the solver will terminate if it can't recover from this
+ * situation. A default value can optionally be provided which will be used if the specified parameter can't be located
+ * in the input file. If a default value can be prescribed, it should. The philosophy here is that the solver should be
+ * able to run with as small of an input script as possible.
  *
  * Example code:
  * \code
@@ -65,6 +73,7 @@ public:
   template <typename ParameterType>
   static auto readParameterOrGetDefaultValue(const std::filesystem::path& file, const std::string& parameter,
     const std::optional<ParameterType>& defaultValue) -> ParameterType;
+  static auto getJSONFile(const std::filesystem::path& file) -> std::shared_ptr<const nlohmann::json>;
   /// @}
 
   /// \name Getters and setters
@@ -81,7 +90,13 @@ public:
   /// \name Private or protected implementation details, not exposed to the caller
   /// @{
 private:
-  static auto getJSONFile(const std::filesystem::path& file) -> nlohmann::json;
+  struct CachedFileType {
+    std::size_t fileSize;
+    std::size_t contentHash;
+    std::shared_ptr<const nlohmann::json> jsonFile;
+  };
+
+  static auto readFileContent(const std::filesystem::path& file) -> std::string;
   template <typename ParameterType>
   static auto getParameterFromJSONFile(const nlohmann::json& jsonFile, const std::filesystem::path& file,
     const std::string& parameter, const std::optional<ParameterType>& defaultValue) -> ParameterType;
@@ -90,6 +105,8 @@ private:
   /// \name Encapsulated data (private or protected variables)
   /// @{
 private:
+  static inline std::mutex cacheMutex_;
+  static inline std::unordered_map<std::string, CachedFileType> cache_;
   /// @}
 };
 
@@ -28,7 +28,7 @@ template <typename ParameterType>
 auto ParameterFileReading::readParameterOrGetDefaultValue(const std::filesystem::path& inputFile,
   const std::string& parameter, const std::optional<ParameterType>& defaultValue) -> ParameterType {
   auto jsonFile = getJSONFile(inputFile);
-  auto parameterValue = getParameterFromJSONFile<ParameterType>(jsonFile, inputFile, parameter, defaultValue);
+  auto parameterValue = getParameterFromJSONFile<ParameterType>(*jsonFile, inputFile, parameter, defaultValue);
   return parameterValue;
 }
 /// @}
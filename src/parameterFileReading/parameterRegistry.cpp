@@ -0,0 +1,84 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+
+// third-party include headers
+#include "nlohmann/json.hpp"
+
+// AIM include headers
+#include "src/parameterFileReading/parameterFileReading.hpp"
+#include "src/parameterFileReading/parameterRegistry.hpp"
+
+namespace AIM {
+namespace Parameters {
+
+/// \name Constructors and destructors
+/// @{
+ParameterRegistry::ParameterRegistry(const std::filesystem::path& file)
+  : file_(file), jsonFile_(ParameterFileReading::getJSONFile(file)) {}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+auto ParameterRegistry::validate() -> void {
+  auto errors = std::stringstream{};
+  auto numberOfErrors = std::size_t{0};
+  for (auto &declaration : declarations_) {
+    if (!jsonFile_->contains(declaration.pointer)) {
+      if (declaration.defaultValue.has_value())
+        declaration.value = declaration.defaultValue;
+      else {
+        errors << "\n  parameter \"" << declaration.parameter << "\" not found and no default value is available";
+        ++numberOfErrors;
+      }
+      continue;
+    }
+
+    try {
+      declaration.value = declaration.convert(jsonFile_->at(declaration.pointer));
+    } catch (const nlohmann::json::exception& e) {
+      errors << "\n  parameter \"" << declaration.parameter << "\" has an invalid type: " << e.what();
+      ++numberOfErrors;
+      continue;
+    }
+    if (declaration.isValid && !declaration.isValid(declaration.value)) {
+      errors << "\n  parameter \"" << declaration.parameter << "\" has the value "
+             << jsonFile_->at(declaration.pointer).dump() << ", but it must " << declaration.requirement;
+      ++numberOfErrors;
+    }
+  }
+
+  if (numberOfErrors > 0)
+    throw std::runtime_error(
+      std::to_string(numberOfErrors) + " invalid parameter(s) in \"" + file_.string() + "\":" + errors.str());
+  isValidated_ = true;
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+auto ParameterRegistry::isValidated() const -> bool { return isValidated_; }
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Parameters
+}  // end namespace AIM
@@ -0,0 +1,134 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <any>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+// third-party include headers
+#include "nlohmann/json.hpp"
+
+// AIM include headers
+
+// concept definition
+
+namespace AIM {
+namespace Parameters {
+
+/**
+ * \class ParameterRegistry
+ * \brief Declares, validates and stores the typed parameters of a JSON input file
+ * \ingroup Parameters
+ *
+ * The registry works in two phases. First, all parameters of a component are declared with declare<ParameterType>(),
+ * which compiles the JSON pointer of the parameter once and returns a lightweight, typed handle. Then, validate()
+ * resolves all declared parameters in a single pass over the parsed input file: each parameter is converted to its
+ * declared type, or replaced by its default value if it is not present. All problems (missing parameters without a
+ * default value and parameters that can't be converted to their declared type) are collected and reported together in
+ * a single std::runtime_error, so that a broken input file can be fixed in one go rather than one parameter per run.
+ * A parameter may also be declared with a predicate and a description of the values it accepts (e.g. "be at least
+ * 0"). Values read from the file that do not satisfy the predicate are reported by validate() like any other invalid
+ * parameter. After validation, get() returns the stored value without any parsing, lookup or conversion, so it can be
+ * called inside loops.
+ *
+ * The input file is obtained from ParameterFileReading::getJSONFile(), i.e. it is parsed at most once and shared with
+ * all other registries and lookups of the same file.
+ *
+ * Example code:
+ * \code
+ * auto parameters = AIM::Parameters::ParameterRegistry{"input/aim.json"};
+ * auto meshFile = parameters.declare<std::filesystem::path>("/mesh/filename", std::filesystem::path{"mesh.cgns"});
+ * auto useCache = parameters.declare<bool>("/mesh/cache", false);
+ * auto renumbering = parameters.declare<std::string>("/mesh/renumbering", std::nullopt);
+ * auto numberOfThreads = parameters.declare<int>(
+ *   "/parallel/numberOfThreads", 0, [](int value) { return value >= 0; }, "be at least 0");
+ * parameters.validate();
+ *
+ * auto file = parameters.get(meshFile);
+ * \endcode
+ */
+
+class ParameterRegistry {
+  /// \name Custom types used in this class
+  /// @{
+public:
+  template <typename ParameterType>
+  class HandleType {
+  public:
+    using ValueType = ParameterType;
+
+  private:
+    explicit HandleType(std::size_t index) : index_(index) {}
+    std::size_t index_;
+    friend ParameterRegistry;
+  };
+
+private:
+  struct DeclarationType {
+    std::string parameter;
+    nlohmann::json::json_pointer pointer;
+    std::any defaultValue;
+    std::function<std::any(const nlohmann::json&)> convert;
+    std::function<bool(const std::any&)> isValid;
+    std::string requirement;
+    std::any value;
+  };
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  explicit ParameterRegistry(const std::filesystem::path& file);
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  template <typename ParameterType>
+  auto declare(const std::string& parameter, const std::optional<ParameterType>& defaultValue,
+    const std::function<bool(const ParameterType&)>& isValid = {}, const std::string& requirement = "")
+    -> HandleType<ParameterType>;
+  auto validate() -> void;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  template <typename ParameterType>
+  auto get(const HandleType<ParameterType>& handle) const -> const ParameterType&;
+  auto isValidated() const -> bool;
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  std::filesystem::path file_;
+  std::shared_ptr<const nlohmann::json> jsonFile_;
+  std::vector<DeclarationType> declarations_;
+  bool isValidated_{false};
+  /// @}
+};
+
+}  // namespace Parameters
+}  // end namespace AIM
+
+#include "parameterRegistry.tpp"
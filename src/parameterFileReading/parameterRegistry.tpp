@@ -0,0 +1,67 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <any>
+#include <cassert>
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+
+// third-party include headers
+#include "nlohmann/json.hpp"
+
+// AIM include headers
+
+namespace AIM {
+namespace Parameters {
+
+/// \name Constructors and destructors
+/// @{
+
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <typename ParameterType>
+auto ParameterRegistry::declare(const std::string& parameter, const std::optional<ParameterType>& defaultValue,
+  const std::function<bool(const ParameterType&)>& isValid, const std::string& requirement)
+  -> HandleType<ParameterType> {
+  auto convert = [](const nlohmann::json& value) -> std::any { return static_cast<ParameterType>(value); };
+  auto declaration = DeclarationType{
+    parameter, nlohmann::json::json_pointer{parameter}, std::any{}, convert, nullptr, requirement, std::any{}};
+  if (defaultValue.has_value())
+    declaration.defaultValue = defaultValue.value();
+  if (isValid)
+    declaration.isValid = [isValid](const std::any& value) { return isValid(*std::any_cast<ParameterType>(&value)); };
+  declarations_.push_back(std::move(declaration));
+
+  // parameters declared after validate() are only available once the registry has been validated again
+  isValidated_ = false;
+  return HandleType<ParameterType>{declarations_.size() - 1};
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+template <typename ParameterType>
+auto ParameterRegistry::get(const HandleType<ParameterType>& handle) const -> const ParameterType& {
+  assert(isValidated_ && "parameters have to be validated before they can be accessed");
+  return *std::any_cast<ParameterType>(&declarations_[handle.index_].value);
+}
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+
+/// @}
+
+}  // namespace Parameters
+}  // end namespace AIM
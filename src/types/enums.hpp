@@ -9,7 +9,10 @@ namespace Enum {
 
 enum Dimension { Two = 2, Three = 3 };
 enum Coordinate { X = 0, Y, Z };
-enum BoundaryCondition { Wall = 0, Inlet, Outlet, Symmetry };
+enum ElementType { Tri3 = 0, Quad4, Tetra4, Pyra5, Penta6, Hexa8 };
+enum BoundaryCondition { Wall = 0, Inlet, Outlet, Symmetry, Unassigned };
+enum Renumbering { NoRenumbering = 0, ReverseCuthillMcKee, HilbertCurve, MortonCurve };
+enum Partitioning { RecursiveCoordinateBisection = 0, MultilevelGraph };
 
 }  // namespace Enum
 }  // end namespace AIM
\ No newline at end of file
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <concepts>
+#include <cstdint>
+
 #include "cgnslib.h"
 
 namespace AIM {
@@ -13,10 +16,22 @@ namespace Types {
 using FloatType = double;
 
 // type used to store large integer numbers (e.g. number of elements / cells) or for indexing arrays
-using UInt = unsigned;
+using UInt = std::uint32_t;
 
 // wrapper around int defined in the CGNS library
 using CGNSInt = cgsize_t;
 
+// index types the mesh containers can be instantiated with. 32-bit indices halve the memory traffic of connectivity
+// heavy loops, 64-bit indices are required for meshes with more than 2^32 vertices or connectivity entries
+template <typename Type>
+concept MeshIndexType = std::same_as<Type, std::uint32_t> || std::same_as<Type, std::uint64_t>;
+
+// floating point types the mesh coordinates can be stored in
+template <typename Type>
+concept MeshFloatType = std::same_as<Type, float> || std::same_as<Type, double>;
+
+static_assert(MeshIndexType<UInt>, "the default index type must be a supported mesh index type");
+static_assert(MeshFloatType<FloatType>, "the default floating point type must be a supported mesh float type");
+
 }  // namespace Types
 }  // end namespace AIM
\ No newline at end of file
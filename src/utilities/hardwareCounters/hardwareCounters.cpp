@@ -0,0 +1,181 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+// third-party include headers
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// AIM include headers
+#include "src/utilities/hardwareCounters/hardwareCounters.hpp"
+#include "src/utilities/instrumentation/instrumentation.hpp"
+
+namespace AIM {
+namespace Utilities {
+
+/// \name Constructors and destructors
+/// @{
+HardwareCounters::ThreadCountersType::ThreadCountersType() {
+  fileDescriptors.fill(-1);
+  for (std::size_t index = 0; index < numberOfEvents; ++index) {
+    auto event = static_cast<Event>(index);
+    fileDescriptors[index] = openEvent(event, groupLeader);
+    if (fileDescriptors[index] < 0)
+      continue;
+    if (groupLeader < 0)
+      groupLeader = fileDescriptors[index];
+    groupOrder[numberOfCountedEvents++] = event;
+  }
+
+#ifdef __linux__
+  // the group is created disabled, so that all events start counting at the same time
+  if (groupLeader >= 0) {
+    ioctl(groupLeader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(groupLeader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+}
+
+HardwareCounters::ThreadCountersType::~ThreadCountersType() {
+#ifdef __linux__
+  for (auto fileDescriptor : fileDescriptors)
+    if (fileDescriptor >= 0)
+      close(fileDescriptor);
+#endif
+}
+
+ProfiledScope::ProfiledScope(const char *name) : timer_(name), start_(HardwareCounters::getSample()) {}
+
+ProfiledScope::~ProfiledScope() {
+  if (!start_)
+    return;
+  auto end = HardwareCounters::getSample();
+  if (!end)
+    return;
+  auto counts = HardwareCounters::getDifference(*start_, *end);
+  for (std::size_t index = 0; index < counts.size(); ++index) {
+    auto event = static_cast<HardwareCounters::Event>(index);
+    if (HardwareCounters::isCounted(event))
+      Instrumentation::addToCounter(HardwareCounters::getEventName(event), counts[index]);
+  }
+}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+auto HardwareCounters::getSample() -> std::optional<SampleType> {
+#ifdef __linux__
+  auto &threadCounters = getThreadCounters();
+  if (threadCounters.groupLeader < 0)
+    return std::nullopt;
+
+  // layout of PERF_FORMAT_GROUP with total times: number of events, time enabled, time running, one value per event
+  auto buffer = std::array<std::uint64_t, 3 + numberOfEvents>{};
+  auto bytesRead = read(threadCounters.groupLeader, buffer.data(), sizeof(buffer));
+  if (bytesRead < static_cast<ssize_t>(3 * sizeof(std::uint64_t)) || buffer[0] != threadCounters.numberOfCountedEvents)
+    return std::nullopt;
+
+  auto sample = SampleType{{}, buffer[1], buffer[2]};
+  for (std::size_t index = 0; index < threadCounters.numberOfCountedEvents; ++index)
+    sample.counts[threadCounters.groupOrder[index]] = buffer[3 + index];
+  return sample;
+#else
+  return std::nullopt;
+#endif
+}
+
+auto HardwareCounters::getDifference(const SampleType& start, const SampleType& end) -> CountsType {
+  // a multiplexed group only counts part of the time, the counts are extrapolated to the full time
+  auto timeEnabled = end.timeEnabled - start.timeEnabled;
+  auto timeRunning = end.timeRunning - start.timeRunning;
+  auto scaling = timeRunning > 0 && timeRunning < timeEnabled
+    ? static_cast<double>(timeEnabled) / static_cast<double>(timeRunning)
+    : 1.0;
+
+  auto counts = CountsType{};
+  for (std::size_t index = 0; index < counts.size(); ++index) {
+    auto difference = end.counts[index] >= start.counts[index] ? end.counts[index] - start.counts[index] : 0;
+    counts[index] = static_cast<std::uint64_t>(static_cast<double>(difference) * scaling);
+  }
+  return counts;
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+auto HardwareCounters::isAvailable() -> bool { return getThreadCounters().groupLeader >= 0; }
+
+auto HardwareCounters::isCounted(Event event) -> bool {
+  return getThreadCounters().fileDescriptors[static_cast<std::size_t>(event)] >= 0;
+}
+
+auto HardwareCounters::getEventName(Event event) -> const char * {
+  constexpr auto names = std::array<const char *, numberOfEvents>{
+    "instructions", "cycles", "L1DataCacheMisses", "lastLevelCacheMisses", "branchMisses"};
+  return names[static_cast<std::size_t>(event)];
+}
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+auto HardwareCounters::getThreadCounters() -> ThreadCountersType& {
+  thread_local auto threadCounters = ThreadCountersType{};
+  return threadCounters;
+}
+
+auto HardwareCounters::openEvent(Event event, int groupLeader) -> int {
+#ifdef __linux__
+  auto attributes = perf_event_attr{};
+  attributes.size = sizeof(perf_event_attr);
+  attributes.type = PERF_TYPE_HARDWARE;
+  switch (event) {
+    case Instructions: attributes.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+    case Cycles: attributes.config = PERF_COUNT_HW_CPU_CYCLES; break;
+    case L1DataCacheMisses:
+      attributes.type = PERF_TYPE_HW_CACHE;
+      attributes.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+      break;
+    case LastLevelCacheMisses: attributes.config = PERF_COUNT_HW_CACHE_MISSES; break;
+    case BranchMisses: attributes.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+  }
+
+  // only user-space events of the calling thread are counted, which is allowed for unprivileged users up to
+  // perf_event_paranoid = 2
+  if (groupLeader < 0)
+    attributes.disabled = 1;
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+  attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  auto fileDescriptor = syscall(SYS_perf_event_open, &attributes, 0, -1, groupLeader, 0);
+  return static_cast<int>(fileDescriptor);
+#else
+  static_cast<void>(event);
+  static_cast<void>(groupLeader);
+  return -1;
+#endif
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Utilities
+}  // end namespace AIM
@@ -0,0 +1,168 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/utilities/instrumentation/instrumentation.hpp"
+
+// concept definition
+
+// profiled scopes record the hardware counters of a region in addition to its time. Without
+// AIM_ENABLE_HARDWARE_COUNTERS they are plain instrumented scopes, i.e. they are removed entirely if instrumentation is
+// disabled as well
+#if defined(AIM_ENABLE_INSTRUMENTATION) && defined(AIM_ENABLE_HARDWARE_COUNTERS)
+#define AIM_PROFILE_SCOPE(name) \
+  const auto AIM_INSTRUMENT_CONCATENATE(aimProfiledScope, __LINE__) = AIM::Utilities::ProfiledScope { name }
+#else
+#define AIM_PROFILE_SCOPE(name) AIM_INSTRUMENT_SCOPE(name)
+#endif
+
+namespace AIM {
+namespace Utilities {
+
+/**
+ * \class HardwareCounters
+ * \brief Reads CPU hardware counters (instructions, cycles, cache and branch misses) of the calling thread
+ * \ingroup utilities
+ *
+ * The counters are opened with the Linux perf_event_open() system call the first time a thread reads them, as a single
+ * group that counts user-space events of the calling thread only. Reading a sample costs one read() system call, so
+ * the counters are meant for coarse regions such as mesh setup stages or complete kernels, not for individual loop
+ * iterations. If the CPU has fewer counter registers than events, the kernel multiplexes the group and
+ * getDifference() scales the counts by the fraction of time the group was actually counting.
+ *
+ * Hardware counters are frequently unavailable, e.g. on other operating systems, in containers and virtual machines,
+ * or if /proc/sys/kernel/perf_event_paranoid forbids access. Events the CPU does not support are skipped individually
+ * (isCounted() is false for them), and if no event can be opened at all getSample() returns std::nullopt. Callers
+ * never have to handle an error, they simply receive no counts.
+ *
+ * Regions are usually profiled with AIM_PROFILE_SCOPE(name), which adds the counts of all available events as counters
+ * (e.g. "instructions") below the scope in the AIM::Utilities::Instrumentation report. It requires AIM to be configured
+ * with AIM_ENABLE_INSTRUMENTATION and AIM_ENABLE_HARDWARE_COUNTERS.
+ *
+ * \code
+ * auto start = AIM::Utilities::HardwareCounters::getSample();
+ * kernel();
+ * auto end = AIM::Utilities::HardwareCounters::getSample();
+ * if (start && end) {
+ *   auto counts = AIM::Utilities::HardwareCounters::getDifference(*start, *end);
+ *   std::cout << counts[AIM::Utilities::HardwareCounters::CacheMisses] << " cache misses" << std::endl;
+ * }
+ * \endcode
+ */
+
+class HardwareCounters {
+  /// \name Custom types used in this class
+  /// @{
+public:
+  enum Event { Instructions = 0, Cycles, L1DataCacheMisses, LastLevelCacheMisses, BranchMisses };
+  static constexpr std::size_t numberOfEvents{5};
+  using CountsType = std::array<std::uint64_t, numberOfEvents>;
+
+  struct SampleType {
+    CountsType counts{};
+    std::uint64_t timeEnabled{0};
+    std::uint64_t timeRunning{0};
+  };
+
+private:
+  struct ThreadCountersType {
+    int groupLeader{-1};
+    std::array<int, numberOfEvents> fileDescriptors{};
+    // events in the order in which the kernel reports them for the group
+    std::array<Event, numberOfEvents> groupOrder{};
+    std::size_t numberOfCountedEvents{0};
+
+    ThreadCountersType();
+    ~ThreadCountersType();
+  };
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  HardwareCounters() = delete;
+  HardwareCounters(const HardwareCounters& other) = delete;
+  HardwareCounters(HardwareCounters&& other) = delete;
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  static auto getSample() -> std::optional<SampleType>;
+  static auto getDifference(const SampleType& start, const SampleType& end) -> CountsType;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  static auto isAvailable() -> bool;
+  static auto isCounted(Event event) -> bool;
+  static auto getEventName(Event event) -> const char *;
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const HardwareCounters& other) -> HardwareCounters& = delete;
+  auto operator=(HardwareCounters&& other) -> HardwareCounters& = delete;
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  static auto getThreadCounters() -> ThreadCountersType&;
+  static auto openEvent(Event event, int groupLeader) -> int;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+
+  /// @}
+};
+
+/**
+ * \class ProfiledScope
+ * \brief Instrumented scope that additionally records the hardware counters of the current thread
+ * \ingroup utilities
+ *
+ * Usually created through AIM_PROFILE_SCOPE(name), so that it is removed if profiling is disabled. The counts of all
+ * available events are added as counters below the scope, nothing is added if hardware counters are unavailable.
+ */
+
+class ProfiledScope {
+  /// \name Constructors and destructors
+  /// @{
+public:
+  explicit ProfiledScope(const char *name);
+  ProfiledScope(const ProfiledScope& other) = delete;
+  ~ProfiledScope();
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const ProfiledScope& other) -> ProfiledScope& = delete;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  // the timer is constructed first, so that the counters are recorded as its children and exclude its overhead
+  ScopedTimer timer_;
+  std::optional<HardwareCounters::SampleType> start_;
+  /// @}
+};
+
+}  // namespace Utilities
+}  // end namespace AIM
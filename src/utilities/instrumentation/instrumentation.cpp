@@ -0,0 +1,221 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// third-party include headers
+#include "nlohmann/json.hpp"
+
+// AIM include headers
+#include "src/utilities/instrumentation/instrumentation.hpp"
+
+namespace AIM {
+namespace Utilities {
+
+namespace {
+
+// nodes of all threads with the same path are merged into a single node of the report
+struct ReportNodeType {
+  bool isCounter{false};
+  std::uint64_t calls{0};
+  std::uint64_t total{0};
+  std::map<std::string, ReportNodeType> children;
+};
+
+auto toJSON(const ReportNodeType& reportNode) -> nlohmann::json {
+  auto json = nlohmann::json{{"calls", reportNode.calls}};
+  if (reportNode.isCounter)
+    json["value"] = reportNode.total;
+  else
+    json["seconds"] = static_cast<double>(reportNode.total) * 1e-9;
+  for (const auto &[name, child] : reportNode.children)
+    json["children"][name] = toJSON(child);
+  return json;
+}
+
+}  // namespace
+
+/// \name Constructors and destructors
+/// @{
+Instrumentation::ThreadDataType::ThreadDataType() {
+  // node 0 is the root of the tree, it is never reported
+  chunks[0].store(new NodeType[nodesPerChunk], std::memory_order_release);
+  numberOfNodes.store(1, std::memory_order_release);
+}
+
+Instrumentation::ThreadDataType::~ThreadDataType() {
+  for (auto &chunk : chunks)
+    delete[] chunk.load(std::memory_order_acquire);
+}
+
+Instrumentation::ThreadReleaseType::~ThreadReleaseType() {
+  // the tree of a finished thread stays in the registry and is handed to the next thread that needs one
+  if (threadData) {
+    threadData->currentNode = 0;
+    threadData->isInUse.store(false, std::memory_order_release);
+  }
+}
+
+ScopedTimer::ScopedTimer(const char *name)
+  : threadData_(Instrumentation::getThreadData()), parent_(threadData_.currentNode),
+    node_(threadData_.findOrAddChild(parent_, name, false)), start_(Instrumentation::ClockType::now()) {
+  threadData_.currentNode = node_;
+}
+
+ScopedTimer::~ScopedTimer() {
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Instrumentation::ClockType::now() - start_);
+  Instrumentation::addToNode(threadData_.getNode(node_), static_cast<std::uint64_t>(elapsed.count()));
+  threadData_.currentNode = parent_;
+}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+auto Instrumentation::addToCounter(const char *name, std::uint64_t value) -> void {
+  auto &threadData = getThreadData();
+  addToNode(threadData.getNode(threadData.findOrAddChild(threadData.currentNode, name, true)), value);
+}
+
+auto Instrumentation::getReport() -> std::string {
+  auto root = ReportNodeType{};
+  auto numberOfThreads = std::size_t{0};
+  for (auto threadData = getThreadDataList().load(std::memory_order_acquire); threadData;
+       threadData = threadData->next) {
+    ++numberOfThreads;
+    auto numberOfNodes = threadData->numberOfNodes.load(std::memory_order_acquire);
+    auto path = std::vector<const char *>{};
+    for (std::uint32_t index = 1; index < numberOfNodes; ++index) {
+      // the name and parent of a node are written before the node is published through numberOfNodes
+      path.clear();
+      for (auto node = index; node != 0; node = threadData->getNode(node).parent)
+        path.push_back(threadData->getNode(node).name);
+
+      auto *reportNode = &root;
+      for (auto name = path.rbegin(); name != path.rend(); ++name)
+        reportNode = &reportNode->children[*name];
+      const auto &node = threadData->getNode(index);
+      reportNode->isCounter = node.isCounter;
+      reportNode->calls += node.calls.load(std::memory_order_relaxed);
+      reportNode->total += node.total.load(std::memory_order_relaxed);
+    }
+  }
+
+  auto report = nlohmann::json{{"threads", numberOfThreads}, {"scopes", nlohmann::json::object()}};
+  for (const auto &[name, child] : root.children)
+    report["scopes"][name] = toJSON(child);
+  return report.dump(2);
+}
+
+auto Instrumentation::writeReport(const std::filesystem::path& file) -> void {
+  auto reportFile = std::ofstream(file);
+  if (!reportFile)
+    throw std::runtime_error("can't write instrumentation report to " + file.string());
+  reportFile << getReport() << std::endl;
+}
+
+auto Instrumentation::reset() -> void {
+  for (auto threadData = getThreadDataList().load(std::memory_order_acquire); threadData;
+       threadData = threadData->next) {
+    auto numberOfNodes = threadData->numberOfNodes.load(std::memory_order_acquire);
+    for (std::uint32_t index = 0; index < numberOfNodes; ++index) {
+      threadData->getNode(index).calls.store(0, std::memory_order_relaxed);
+      threadData->getNode(index).total.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+auto Instrumentation::ThreadDataType::getNode(std::uint32_t node) const -> NodeType& {
+  return chunks[node / nodesPerChunk].load(std::memory_order_acquire)[node % nodesPerChunk];
+}
+
+auto Instrumentation::ThreadDataType::findOrAddChild(std::uint32_t parent, const char *name, bool isCounter)
+  -> std::uint32_t {
+  // names are usually string literals, so comparing the pointers is enough in most cases
+  auto &children = getNode(parent).children;
+  for (auto child : children) {
+    const auto *childName = getNode(child).name;
+    if (childName == name || std::strcmp(childName, name) == 0)
+      return child;
+  }
+
+  auto node = numberOfNodes.load(std::memory_order_relaxed);
+  if (node == nodesPerChunk * maximumNumberOfChunks)
+    throw std::runtime_error("instrumentation registry is full, can't add " + std::string(name));
+  auto &chunk = chunks[node / nodesPerChunk];
+  if (!chunk.load(std::memory_order_relaxed))
+    chunk.store(new NodeType[nodesPerChunk], std::memory_order_release);
+
+  auto &newNode = getNode(node);
+  newNode.name = name;
+  newNode.parent = parent;
+  newNode.isCounter = isCounter;
+  children.push_back(node);
+  numberOfNodes.store(node + 1, std::memory_order_release);
+  return node;
+}
+
+auto Instrumentation::getThreadData() -> ThreadDataType& {
+  thread_local auto threadRelease = ThreadReleaseType{acquireThreadData()};
+  return *threadRelease.threadData;
+}
+
+auto Instrumentation::acquireThreadData() -> ThreadDataType * {
+  auto &list = getThreadDataList();
+  for (auto threadData = list.load(std::memory_order_acquire); threadData; threadData = threadData->next) {
+    auto isInUse = false;
+    if (threadData->isInUse.compare_exchange_strong(isInUse, true, std::memory_order_acquire))
+      return threadData;
+  }
+
+  // no tree of a finished thread is available, a new one is pushed onto the front of the list
+  auto *threadData = new ThreadDataType{};
+  threadData->next = list.load(std::memory_order_relaxed);
+  while (!list.compare_exchange_weak(threadData->next, threadData, std::memory_order_release))
+    ;
+  return threadData;
+}
+
+auto Instrumentation::getThreadDataList() -> std::atomic<ThreadDataType *>& {
+  // the trees are intentionally never freed, threads may still record measurements during static destruction
+  static auto list = std::atomic<ThreadDataType *>{nullptr};
+  return list;
+}
+
+auto Instrumentation::addToNode(NodeType& node, std::uint64_t value) -> void {
+  // each node is only written by its owning thread, plain loads and stores avoid the cost of atomic read-modify-writes
+  node.calls.store(node.calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  node.total.store(node.total.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Utilities
+}  // end namespace AIM
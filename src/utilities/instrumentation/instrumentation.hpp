@@ -0,0 +1,203 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+
+// concept definition
+
+// scoped timers and counters are compiled into the code only if AIM is configured with AIM_ENABLE_INSTRUMENTATION,
+// otherwise the macros expand to nothing and instrumented code has no overhead at all
+#define AIM_INSTRUMENT_CONCATENATE_IMPLEMENTATION(first, second) first##second
+#define AIM_INSTRUMENT_CONCATENATE(first, second) AIM_INSTRUMENT_CONCATENATE_IMPLEMENTATION(first, second)
+#ifdef AIM_ENABLE_INSTRUMENTATION
+#define AIM_INSTRUMENT_SCOPE(name) \
+  const auto AIM_INSTRUMENT_CONCATENATE(aimScopedTimer, __LINE__) = AIM::Utilities::ScopedTimer { name }
+#define AIM_INSTRUMENT_COUNT(name, value) AIM::Utilities::Instrumentation::addToCounter(name, value)
+#else
+#define AIM_INSTRUMENT_SCOPE(name) static_cast<void>(0)
+#define AIM_INSTRUMENT_COUNT(name, value) static_cast<void>(0)
+#endif
+
+namespace AIM {
+namespace Utilities {
+
+/**
+ * \class Instrumentation
+ * \brief Registry of hierarchical, thread-local timers and counters with a JSON report
+ * \ingroup utilities
+ *
+ * Code is instrumented with the AIM_INSTRUMENT_SCOPE(name) and AIM_INSTRUMENT_COUNT(name, value) macros. A scope
+ * measures the wall-clock time until the end of the enclosing block with a ScopedTimer, a counter accumulates values
+ * (e.g. the number of bytes read). Scopes nest, i.e. a scope or counter that is entered while another scope is active
+ * on the same thread becomes its child. The name has to be a string literal (or otherwise outlive the registry).
+ *
+ * Each thread accumulates into its own tree of nodes, so recording a measurement never takes a lock or modifies data
+ * shared with other threads. Nodes are stored in chunks that never move, and each accumulator is only written by its
+ * owning thread with relaxed atomic stores. getReport() can therefore walk the trees of all threads at any time,
+ * without locking, and merge nodes with the same path. Scopes that are entered on a different thread (e.g. in a
+ * std::async task) start a new hierarchy at the root of the report, and times of the same scope on several threads are
+ * summed up. Trees of finished threads are kept and reused by new threads, so that short-lived threads do not grow the
+ * registry. reset() sets all accumulators back to zero, it should only be called while no instrumented code is running,
+ * as measurements that are recorded at the same time may be lost or survive the reset.
+ *
+ * If AIM is configured without AIM_ENABLE_INSTRUMENTATION (the default), the macros are removed by the preprocessor.
+ * The classes themselves are always available, so that the report can be written unconditionally.
+ *
+ * \code
+ * auto readMesh() -> void {
+ *   AIM_INSTRUMENT_SCOPE("readMesh");
+ *   {
+ *     AIM_INSTRUMENT_SCOPE("coordinates");
+ *     ...
+ *     AIM_INSTRUMENT_COUNT("bytes", numberOfVertices * sizeof(double));
+ *   }
+ * }
+ *
+ * // {"threads": 1, "scopes": {"readMesh": {"calls": 1, "seconds": 0.1, "children": {"coordinates": {...}}}}}
+ * AIM::Utilities::Instrumentation::writeReport("instrumentation.json");
+ * \endcode
+ */
+
+class Instrumentation {
+  /// \name Custom types used in this class
+  /// @{
+public:
+  using ClockType = std::chrono::steady_clock;
+
+private:
+  struct NodeType {
+    const char *name{nullptr};
+    std::uint32_t parent{0};
+    bool isCounter{false};
+    std::atomic<std::uint64_t> calls{0};
+    // elapsed time in nanoseconds for scopes, accumulated value for counters
+    std::atomic<std::uint64_t> total{0};
+    // only accessed by the owning thread
+    std::vector<std::uint32_t> children;
+  };
+
+  struct ThreadDataType {
+    static constexpr std::size_t nodesPerChunk{256};
+    static constexpr std::size_t maximumNumberOfChunks{256};
+
+    std::array<std::atomic<NodeType *>, maximumNumberOfChunks> chunks{};
+    std::atomic<std::uint32_t> numberOfNodes{0};
+    std::atomic<bool> isInUse{true};
+    std::uint32_t currentNode{0};
+    ThreadDataType *next{nullptr};
+
+    ThreadDataType();
+    ~ThreadDataType();
+    auto getNode(std::uint32_t node) const -> NodeType&;
+    auto findOrAddChild(std::uint32_t parent, const char *name, bool isCounter) -> std::uint32_t;
+  };
+
+  struct ThreadReleaseType {
+    ThreadDataType *threadData{nullptr};
+    ~ThreadReleaseType();
+  };
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  Instrumentation() = delete;
+  Instrumentation(const Instrumentation& other) = delete;
+  Instrumentation(Instrumentation&& other) = delete;
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  static auto addToCounter(const char *name, std::uint64_t value) -> void;
+  static auto getReport() -> std::string;
+  static auto writeReport(const std::filesystem::path& file) -> void;
+  static auto reset() -> void;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  static constexpr auto isEnabled() -> bool {
+#ifdef AIM_ENABLE_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+  }
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const Instrumentation& other) -> Instrumentation& = delete;
+  auto operator=(Instrumentation&& other) -> Instrumentation& = delete;
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  static auto getThreadData() -> ThreadDataType&;
+  static auto acquireThreadData() -> ThreadDataType *;
+  static auto getThreadDataList() -> std::atomic<ThreadDataType *>&;
+  static auto addToNode(NodeType& node, std::uint64_t value) -> void;
+
+  friend class ScopedTimer;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+
+  /// @}
+};
+
+/**
+ * \class ScopedTimer
+ * \brief Measures the time until it goes out of scope and adds it to the current thread's instrumentation tree
+ * \ingroup utilities
+ *
+ * Usually created through AIM_INSTRUMENT_SCOPE(name), so that it is removed if instrumentation is disabled.
+ */
+
+class ScopedTimer {
+  /// \name Constructors and destructors
+  /// @{
+public:
+  explicit ScopedTimer(const char *name);
+  ScopedTimer(const ScopedTimer& other) = delete;
+  ~ScopedTimer();
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const ScopedTimer& other) -> ScopedTimer& = delete;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  Instrumentation::ThreadDataType& threadData_;
+  std::uint32_t parent_{0};
+  std::uint32_t node_{0};
+  Instrumentation::ClockType::time_point start_;
+  /// @}
+};
+
+}  // namespace Utilities
+}  // end namespace AIM
@@ -0,0 +1,116 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define AIM_HAS_MMAP
+#endif
+
+// third-party include headers
+
+// AIM include headers
+#include "src/utilities/memoryMappedFile/memoryMappedFile.hpp"
+
+namespace AIM {
+namespace Utilities {
+
+/// \name Constructors and destructors
+/// @{
+MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& file) {
+#ifdef AIM_HAS_MMAP
+  auto fileDescriptor = ::open(file.c_str(), O_RDONLY);
+  if (fileDescriptor < 0)
+    throw std::runtime_error("can't open file for memory mapping: " + file.string());
+
+  struct stat fileStatus {};
+  if (::fstat(fileDescriptor, &fileStatus) != 0) {
+    ::close(fileDescriptor);
+    throw std::runtime_error("can't determine size of file: " + file.string());
+  }
+  size_ = static_cast<std::size_t>(fileStatus.st_size);
+
+  if (size_ > 0) {
+    auto address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if (address == MAP_FAILED) {
+      ::close(fileDescriptor);
+      throw std::runtime_error("can't memory map file: " + file.string());
+    }
+    data_ = static_cast<const std::byte*>(address);
+    mapped_ = true;
+  }
+  // the mapping stays valid after the file descriptor is closed
+  ::close(fileDescriptor);
+#else
+  auto rawFile = std::ifstream(file, std::ios::binary | std::ios::ate);
+  if (!rawFile)
+    throw std::runtime_error("can't open file: " + file.string());
+  buffer_.resize(static_cast<std::size_t>(rawFile.tellg()));
+  rawFile.seekg(0);
+  rawFile.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+#endif
+}
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+  : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)),
+    mapped_(std::exchange(other.mapped_, false)), buffer_(std::move(other.buffer_)) {}
+
+MemoryMappedFile::~MemoryMappedFile() { unmap(); }
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+auto MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept -> MemoryMappedFile& {
+  if (this != &other) {
+    unmap();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    mapped_ = std::exchange(other.mapped_, false);
+    buffer_ = std::move(other.buffer_);
+  }
+  return *this;
+}
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+auto MemoryMappedFile::unmap() -> void {
+#ifdef AIM_HAS_MMAP
+  if (mapped_)
+    ::munmap(const_cast<std::byte*>(data_), size_);
+#endif
+  data_ = nullptr;
+  size_ = 0;
+  mapped_ = false;
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Utilities
+}  // end namespace AIM
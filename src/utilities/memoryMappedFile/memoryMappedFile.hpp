@@ -0,0 +1,92 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+
+// concept definition
+
+namespace AIM {
+namespace Utilities {
+
+/**
+ * \class MemoryMappedFile
+ * \brief Read-only, move-only RAII wrapper around a memory mapped file
+ * \ingroup utilities
+ *
+ * The file is mapped into memory on construction and unmapped on destruction. Pages are only loaded from disk once they
+ * are accessed, so opening even very large files is cheap and the operating system can share the pages between
+ * processes. On platforms without mmap support, the file is read into a buffer instead, so that the calling code does
+ * not need to distinguish between both cases. A std::runtime_error is thrown if the file can't be opened or mapped.
+ *
+ * \code
+ * auto file = AIM::Utilities::MemoryMappedFile{std::filesystem::path("path/to/file.bin")};
+ * auto bytes = file.getData();
+ * std::cout << "file size in bytes: " << bytes.size() << std::endl;
+ * \endcode
+ */
+
+class MemoryMappedFile {
+  /// \name Custom types used in this class
+  /// @{
+
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  MemoryMappedFile(const std::filesystem::path& file);
+  MemoryMappedFile(const MemoryMappedFile& other) = delete;
+  MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+  ~MemoryMappedFile();
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getData() const -> std::span<const std::byte> { return {data_, size_}; }
+  auto size() const -> std::size_t { return size_; }
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const MemoryMappedFile& other) -> MemoryMappedFile& = delete;
+  auto operator=(MemoryMappedFile&& other) noexcept -> MemoryMappedFile&;
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  auto unmap() -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  const std::byte* data_{nullptr};
+  std::size_t size_{0};
+  bool mapped_{false};
+  std::vector<std::byte> buffer_;
+  /// @}
+};
+
+}  // namespace Utilities
+}  // end namespace AIM
+
+#include "memoryMappedFile.tpp"
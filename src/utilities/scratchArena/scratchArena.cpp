@@ -0,0 +1,101 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/utilities/scratchArena/scratchArena.hpp"
+
+namespace AIM {
+namespace Utilities {
+
+/// \name Constructors and destructors
+/// @{
+ScratchArena::ScratchArena(std::size_t maximumRetainedCapacity) : maximumRetainedCapacity_(maximumRetainedCapacity) {
+  resetResource();
+}
+
+ScratchScope::ScratchScope() : arena_(ScratchArena::getThreadLocal()) { ++arena_.numberOfScopes_; }
+
+ScratchScope::~ScratchScope() {
+  if (--arena_.numberOfScopes_ == 0)
+    arena_.release();
+}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+auto ScratchArena::getThreadLocal() -> ScratchArena& {
+  thread_local auto arena = ScratchArena{};
+  return arena;
+}
+
+auto ScratchArena::release() -> void {
+  // everything allocated since the last release fits into the current buffer plus the blocks requested upstream
+  auto requiredCapacity = std::min(capacity_ + upstream_.allocatedBytes, maximumRetainedCapacity_);
+  resource_.reset();
+  if (requiredCapacity > capacity_) {
+    buffer_ = std::make_unique_for_overwrite<std::byte[]>(requiredCapacity);
+    capacity_ = requiredCapacity;
+  }
+  resetResource();
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+auto ScratchArena::getResource() -> std::pmr::memory_resource * { return &resource_.value(); }
+
+auto ScratchArena::getCapacity() const -> std::size_t { return capacity_; }
+
+auto ScratchArena::getNumberOfUpstreamAllocations() const -> std::size_t { return upstream_.numberOfAllocations; }
+
+auto ScratchScope::getResource() const -> std::pmr::memory_resource * { return arena_.getResource(); }
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+auto ScratchArena::resetResource() -> void {
+  upstream_.allocatedBytes = 0;
+  upstream_.numberOfAllocations = 0;
+  if (capacity_ > 0)
+    resource_.emplace(buffer_.get(), capacity_, &upstream_);
+  else
+    resource_.emplace(&upstream_);
+}
+
+auto ScratchArena::UpstreamResourceType::do_allocate(std::size_t bytes, std::size_t alignment) -> void * {
+  allocatedBytes += bytes;
+  ++numberOfAllocations;
+  return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+auto ScratchArena::UpstreamResourceType::do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment)
+  -> void {
+  std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+}
+
+auto ScratchArena::UpstreamResourceType::do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool {
+  return this == &other;
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Utilities
+}  // end namespace AIM
@@ -0,0 +1,152 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+// third-party include headers
+
+// AIM include headers
+
+// concept definition
+
+namespace AIM {
+namespace Utilities {
+
+/**
+ * \class ScratchArena
+ * \brief Monotonic arena for short-lived temporaries, usable through std::pmr containers
+ * \ingroup utilities
+ *
+ * Allocations are served from a single buffer by bumping a pointer (std::pmr::monotonic_buffer_resource), deallocation
+ * is a no-op, and all memory is given back at once by release(). If the buffer runs out, further blocks are requested
+ * from the global heap. release() then replaces them by one buffer large enough for everything that was allocated, up
+ * to maximumRetainedCapacity, so that a repeated workload (e.g. the same setup stage for every zone or chunk) is served
+ * from the retained buffer without any calls to the global allocator after the first pass. Larger peaks are returned
+ * to the heap, so that the arena does not pin the memory of a single large mesh for the lifetime of the thread.
+ *
+ * An arena is not thread-safe. Each thread has its own arena (getThreadLocal()), which is normally used through a
+ * ScratchScope. Containers allocated from the arena must not outlive the scope they were created in, so they are used
+ * for temporaries only and never returned to the caller.
+ */
+
+class ScratchArena {
+  /// \name Custom types used in this class
+  /// @{
+private:
+  // forwards to the global heap and records how much memory the monotonic resource requested beyond the buffer
+  class UpstreamResourceType : public std::pmr::memory_resource {
+  public:
+    std::size_t allocatedBytes{0};
+    std::size_t numberOfAllocations{0};
+
+  private:
+    auto do_allocate(std::size_t bytes, std::size_t alignment) -> void * override;
+    auto do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) -> void override;
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override;
+  };
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  explicit ScratchArena(std::size_t maximumRetainedCapacity = defaultMaximumRetainedCapacity);
+  ScratchArena(const ScratchArena& other) = delete;
+  ScratchArena(ScratchArena&& other) = delete;
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  static constexpr std::size_t defaultMaximumRetainedCapacity{std::size_t{256} << 20};
+
+  static auto getThreadLocal() -> ScratchArena&;
+  auto release() -> void;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getResource() -> std::pmr::memory_resource *;
+  auto getCapacity() const -> std::size_t;
+  auto getNumberOfUpstreamAllocations() const -> std::size_t;
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const ScratchArena& other) -> ScratchArena& = delete;
+  auto operator=(ScratchArena&& other) -> ScratchArena& = delete;
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  auto resetResource() -> void;
+
+  friend class ScratchScope;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  std::size_t maximumRetainedCapacity_;
+  std::size_t capacity_{0};
+  std::unique_ptr<std::byte[]> buffer_;
+  UpstreamResourceType upstream_;
+  std::optional<std::pmr::monotonic_buffer_resource> resource_;
+  std::size_t numberOfScopes_{0};
+  /// @}
+};
+
+/**
+ * \class ScratchScope
+ * \brief Gives access to the calling thread's ScratchArena and releases it when the outermost scope ends
+ * \ingroup utilities
+ *
+ * Scopes nest, e.g. if a function with a scope calls another one, or if a thread waiting in a parallel loop picks up a
+ * task that opens a scope. Memory is only released when the outermost scope on the thread is destroyed, so a scope has
+ * to be declared before the containers that use it.
+ *
+ * \code
+ * auto scratch = AIM::Utilities::ScratchScope{};
+ * auto records = std::pmr::vector<FaceRecordType>(numberOfFaces, scratch.getResource());
+ * \endcode
+ */
+
+class ScratchScope {
+  /// \name Constructors and destructors
+  /// @{
+public:
+  ScratchScope();
+  ScratchScope(const ScratchScope& other) = delete;
+  ~ScratchScope();
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getResource() const -> std::pmr::memory_resource *;
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const ScratchScope& other) -> ScratchScope& = delete;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  ScratchArena& arena_;
+  /// @}
+};
+
+}  // namespace Utilities
+}  // end namespace AIM
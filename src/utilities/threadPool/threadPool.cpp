@@ -0,0 +1,195 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+// third-party include headers
+
+// AIM include headers
+#include "src/parameterFileReading/parameterRegistry.hpp"
+#include "src/utilities/threadPool/threadPool.hpp"
+
+namespace AIM {
+namespace Utilities {
+
+/// \name Constructors and destructors
+/// @{
+ThreadPool::ThreadPool(std::size_t numberOfThreads) {
+  numberOfThreads = std::max(std::size_t{1}, numberOfThreads);
+  for (std::size_t queue = 0; queue < numberOfThreads; ++queue)
+    queues_.push_back(std::make_unique<TaskQueueType>());
+  for (std::size_t queue = 0; queue + 1 < numberOfThreads; ++queue)
+    workers_.emplace_back([this, queue]() { workerLoop(queue); });
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    auto lock = std::lock_guard<std::mutex>{sleepMutex_};
+    stop_ = true;
+  }
+  sleepCondition_.notify_all();
+  for (auto &worker : workers_)
+    worker.join();
+}
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+auto ThreadPool::getInstance() -> ThreadPool& {
+  static auto pool = ThreadPool{readNumberOfThreads()};
+  return pool;
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+auto ThreadPool::getNumberOfThreads() const -> std::size_t { return workers_.size() + 1; }
+
+auto ThreadPool::getGrainSize(std::size_t size, std::size_t grainSize) -> std::size_t {
+  if (grainSize != automaticGrainSize)
+    return grainSize;
+  return std::max(minimumGrainSize, (size + maximumNumberOfChunks - 1) / maximumNumberOfChunks);
+}
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+auto ThreadPool::readNumberOfThreads() -> std::size_t {
+  auto inputFile = std::filesystem::path{"input/aim.json"};
+  auto hardwareConcurrency = std::max(std::size_t{1}, static_cast<std::size_t>(std::thread::hardware_concurrency()));
+  if (!std::filesystem::exists(inputFile))
+    return hardwareConcurrency;
+
+  // zero (or a missing parameter) selects one thread per hardware thread
+  auto parameters = AIM::Parameters::ParameterRegistry{inputFile};
+  auto numberOfThreads = parameters.declare<int>(
+    "/parallel/numberOfThreads", 0, [](int value) { return value >= 0; }, "be at least 0");
+  parameters.validate();
+
+  auto requestedNumberOfThreads = static_cast<std::size_t>(parameters.get(numberOfThreads));
+  return requestedNumberOfThreads == 0 ? hardwareConcurrency : requestedNumberOfThreads;
+}
+
+auto ThreadPool::getCurrentWorker() -> CurrentWorkerType& {
+  thread_local auto currentWorker = CurrentWorkerType{};
+  return currentWorker;
+}
+
+auto ThreadPool::run(JobType& job) -> void {
+  auto numberOfChunks = (job.end - job.begin + job.grainSize - 1) / job.grainSize;
+  job.remainingChunks.store(numberOfChunks, std::memory_order_relaxed);
+
+  // the calling thread starts splitting the range and keeps executing tasks (of any loop) until its loop has finished
+  auto queue = getQueueOfCurrentThread();
+  execute(queue, TaskType{&job, 0, numberOfChunks});
+  while (job.remainingChunks.load(std::memory_order_acquire) > 0) {
+    if (auto task = tryGetTask(queue))
+      execute(queue, *task);
+    else
+      std::this_thread::yield();
+  }
+}
+
+auto ThreadPool::getQueueOfCurrentThread() -> std::size_t {
+  const auto &currentWorker = getCurrentWorker();
+  return currentWorker.pool == this ? currentWorker.queue : queues_.size() - 1;
+}
+
+auto ThreadPool::push(std::size_t queue, const TaskType& task) -> void {
+  {
+    auto lock = std::lock_guard<std::mutex>{queues_[queue]->mutex};
+    queues_[queue]->tasks.push_back(task);
+    numberOfQueuedTasks_.fetch_add(1);
+  }
+
+  // a worker going to sleep registers itself before checking for queued tasks, so either it sees this task or it is
+  // registered here and waiting on the condition variable by the time the sleep mutex can be acquired
+  if (numberOfSleepingWorkers_.load() > 0) {
+    { auto lock = std::lock_guard<std::mutex>{sleepMutex_}; }
+    sleepCondition_.notify_one();
+  }
+}
+
+auto ThreadPool::tryGetTask(std::size_t queue) -> std::optional<TaskType> {
+  if (numberOfQueuedTasks_.load() == 0)
+    return std::nullopt;
+
+  // own tasks are taken from the back, tasks of other threads are stolen from the front
+  for (std::size_t offset = 0; offset < queues_.size(); ++offset) {
+    auto &taskQueue = *queues_[(queue + offset) % queues_.size()];
+    auto lock = std::lock_guard<std::mutex>{taskQueue.mutex};
+    if (taskQueue.tasks.empty())
+      continue;
+    auto task = offset == 0 ? taskQueue.tasks.back() : taskQueue.tasks.front();
+    if (offset == 0)
+      taskQueue.tasks.pop_back();
+    else
+      taskQueue.tasks.pop_front();
+    numberOfQueuedTasks_.fetch_sub(1);
+    return task;
+  }
+  return std::nullopt;
+}
+
+auto ThreadPool::execute(std::size_t queue, TaskType task) -> void {
+  // the upper half of the range is left for other threads until a single chunk remains
+  while (task.lastChunk - task.firstChunk > 1) {
+    auto middle = task.firstChunk + (task.lastChunk - task.firstChunk) / 2;
+    push(queue, TaskType{task.job, middle, task.lastChunk});
+    task.lastChunk = middle;
+  }
+
+  auto &job = *task.job;
+  auto begin = job.begin + task.firstChunk * job.grainSize;
+  auto end = std::min(job.end, begin + job.grainSize);
+  try {
+    job.invoke(job.function, begin, end);
+  } catch (...) {
+    auto lock = std::lock_guard<std::mutex>{job.exceptionMutex};
+    if (!job.exception)
+      job.exception = std::current_exception();
+  }
+
+  // the job lives on the stack of the waiting thread, it must not be accessed after the last chunk is marked as done
+  job.remainingChunks.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+auto ThreadPool::workerLoop(std::size_t queue) -> void {
+  getCurrentWorker() = CurrentWorkerType{this, queue};
+  while (true) {
+    if (auto task = tryGetTask(queue)) {
+      execute(queue, *task);
+      continue;
+    }
+
+    auto lock = std::unique_lock<std::mutex>{sleepMutex_};
+    numberOfSleepingWorkers_.fetch_add(1);
+    sleepCondition_.wait(lock, [this]() { return stop_ || numberOfQueuedTasks_.load() > 0; });
+    numberOfSleepingWorkers_.fetch_sub(1);
+    if (stop_)
+      return;
+  }
+}
+/// @}
+
+/// \name Encapsulated data (private or protected variables)
+/// @{
+
+/// @}
+
+}  // namespace Utilities
+}  // end namespace AIM
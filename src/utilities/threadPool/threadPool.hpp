@@ -0,0 +1,173 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+#pragma once
+
+// c++ include headers
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+
+// concept definition
+
+namespace AIM {
+namespace Utilities {
+
+/**
+ * \class ThreadPool
+ * \brief Work-stealing task scheduler with parallelFor() and parallelReduce() over index ranges
+ * \ingroup utilities
+ *
+ * The pool keeps numberOfThreads - 1 worker threads alive for its whole lifetime, the thread calling parallelFor() or
+ * parallelReduce() takes part in the work as well. An index range [begin, end) is cut into chunks of grainSize indices,
+ * and the function is always called for exactly one chunk, i.e. for the range [begin + k * grainSize, min(end, begin +
+ * (k + 1) * grainSize)). The chunking therefore depends only on the range and the grain size, not on the number of
+ * threads or on the schedule, which makes per-chunk algorithms (e.g. a chunked prefix sum) and reductions
+ * deterministic.
+ *
+ * Each thread owns a task deque. A task covers a range of chunks and is split in halves until it covers a single chunk,
+ * the upper halves are pushed onto the back of the deque of the executing thread. A thread takes its own tasks from the
+ * back (the most recently split, cache-warm range) and, once its deque is empty, steals from the front of the deques of
+ * the other threads, which hold the largest remaining ranges. Threads that are not part of the pool share one
+ * additional deque. Waiting threads keep executing tasks until their own loop has finished, so that parallel loops can
+ * be nested without deadlocking the pool. Exceptions thrown by the function are rethrown on the calling thread once all
+ * chunks have been processed (only the first one if several chunks throw).
+ *
+ * parallelReduce() computes one partial result per chunk and combines the partial results in chunk order on the
+ * calling thread, so that floating point reductions produce bitwise identical results for any number of threads. With
+ * automaticGrainSize the grain size depends on the size of the range only, for the same reason.
+ *
+ * getInstance() returns the pool shared by the whole code base, its number of threads is read from
+ * "/parallel/numberOfThreads" in input/aim.json (the hardware concurrency if the parameter or file is missing, or if it
+ * is set to 0). The pool is meant for compute-bound loops, blocking work such as file I/O should not be submitted to
+ * it.
+ *
+ * \code
+ * auto &pool = AIM::Utilities::ThreadPool::getInstance();
+ * pool.parallelFor(0, volumes.size(), [&](std::size_t begin, std::size_t end) {
+ *   for (auto cell = begin; cell < end; ++cell)
+ *     volumes[cell] = computeVolume(cell);
+ * });
+ * auto totalVolume = pool.parallelReduce(0, volumes.size(), 0.0,
+ *   [&](std::size_t begin, std::size_t end) { return std::accumulate(&volumes[begin], &volumes[end], 0.0); },
+ *   std::plus<>{});
+ * \endcode
+ */
+
+class ThreadPool {
+  /// \name Custom types used in this class
+  /// @{
+private:
+  struct JobType {
+    std::size_t begin{0};
+    std::size_t end{0};
+    std::size_t grainSize{1};
+    // type-erased chunk function, called with the index range of a single chunk
+    void (*invoke)(void *function, std::size_t begin, std::size_t end){nullptr};
+    void *function{nullptr};
+    std::atomic<std::size_t> remainingChunks{0};
+    std::mutex exceptionMutex;
+    std::exception_ptr exception;
+  };
+
+  struct TaskType {
+    JobType *job{nullptr};
+    std::size_t firstChunk{0};
+    std::size_t lastChunk{0};
+  };
+
+  struct alignas(64) TaskQueueType {
+    std::mutex mutex;
+    std::deque<TaskType> tasks;
+  };
+
+  struct CurrentWorkerType {
+    const ThreadPool *pool{nullptr};
+    std::size_t queue{0};
+  };
+  /// @}
+
+  /// \name Constructors and destructors
+  /// @{
+public:
+  explicit ThreadPool(std::size_t numberOfThreads);
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool(ThreadPool&& other) = delete;
+  ~ThreadPool();
+  /// @}
+
+  /// \name API interface that exposes behaviour to the caller
+  /// @{
+public:
+  static constexpr std::size_t automaticGrainSize{0};
+  static constexpr std::size_t minimumGrainSize{1024};
+  static constexpr std::size_t maximumNumberOfChunks{256};
+
+  static auto getInstance() -> ThreadPool&;
+
+  template <typename ChunkFunction>
+  auto parallelFor(std::size_t begin, std::size_t end, ChunkFunction&& function,
+    std::size_t grainSize = automaticGrainSize) -> void;
+
+  template <typename ValueType, typename ChunkFunction, typename ReduceFunction>
+  auto parallelReduce(std::size_t begin, std::size_t end, ValueType identity, ChunkFunction&& function,
+    ReduceFunction&& reduce, std::size_t grainSize = automaticGrainSize) -> ValueType;
+  /// @}
+
+  /// \name Getters and setters
+  /// @{
+public:
+  auto getNumberOfThreads() const -> std::size_t;
+  static auto getGrainSize(std::size_t size, std::size_t grainSize) -> std::size_t;
+  /// @}
+
+  /// \name Overloaded operators
+  /// @{
+public:
+  auto operator=(const ThreadPool& other) -> ThreadPool& = delete;
+  auto operator=(ThreadPool&& other) -> ThreadPool& = delete;
+  /// @}
+
+  /// \name Private or protected implementation details, not exposed to the caller
+  /// @{
+private:
+  static auto readNumberOfThreads() -> std::size_t;
+  static auto getCurrentWorker() -> CurrentWorkerType&;
+  auto run(JobType& job) -> void;
+  auto getQueueOfCurrentThread() -> std::size_t;
+  auto push(std::size_t queue, const TaskType& task) -> void;
+  auto tryGetTask(std::size_t queue) -> std::optional<TaskType>;
+  auto execute(std::size_t queue, TaskType task) -> void;
+  auto workerLoop(std::size_t queue) -> void;
+  /// @}
+
+  /// \name Encapsulated data (private or protected variables)
+  /// @{
+private:
+  // one queue per worker thread, the last one is shared by all threads outside the pool
+  std::vector<std::unique_ptr<TaskQueueType>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<std::size_t> numberOfQueuedTasks_{0};
+  std::atomic<std::size_t> numberOfSleepingWorkers_{0};
+  std::mutex sleepMutex_;
+  std::condition_variable sleepCondition_;
+  bool stop_{false};
+  /// @}
+};
+
+}  // namespace Utilities
+}  // end namespace AIM
+
+#include "threadPool.tpp"
@@ -0,0 +1,97 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// third-party include headers
+
+// AIM include headers
+
+namespace AIM {
+namespace Utilities {
+
+/// \name Constructors and destructors
+/// @{
+
+/// @}
+
+/// \name API interface that exposes behaviour to the caller
+/// @{
+template <typename ChunkFunction>
+auto ThreadPool::parallelFor(std::size_t begin, std::size_t end, ChunkFunction&& function, std::size_t grainSize)
+  -> void {
+  if (end <= begin)
+    return;
+  grainSize = getGrainSize(end - begin, grainSize);
+
+  // a single chunk, or a pool without workers, is processed on the calling thread without creating any tasks
+  if (end - begin <= grainSize || workers_.empty()) {
+    for (auto chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize)
+      function(chunkBegin, std::min(end, chunkBegin + grainSize));
+    return;
+  }
+
+  using FunctionType = std::remove_reference_t<ChunkFunction>;
+  auto job = JobType{};
+  job.begin = begin;
+  job.end = end;
+  job.grainSize = grainSize;
+  job.invoke = [](void *chunkFunction, std::size_t chunkBegin, std::size_t chunkEnd) {
+    (*static_cast<FunctionType *>(chunkFunction))(chunkBegin, chunkEnd);
+  };
+  job.function = const_cast<void *>(static_cast<const void *>(std::addressof(function)));
+  run(job);
+
+  if (job.exception)
+    std::rethrow_exception(job.exception);
+}
+
+template <typename ValueType, typename ChunkFunction, typename ReduceFunction>
+auto ThreadPool::parallelReduce(std::size_t begin, std::size_t end, ValueType identity, ChunkFunction&& function,
+  ReduceFunction&& reduce, std::size_t grainSize) -> ValueType {
+  if (end <= begin)
+    return identity;
+  grainSize = getGrainSize(end - begin, grainSize);
+
+  // partial results are stored per chunk and combined in chunk order, independent of the thread that computed them
+  auto partialResults = std::vector<std::optional<ValueType>>((end - begin + grainSize - 1) / grainSize);
+  parallelFor(
+    begin, end,
+    [&partialResults, &function, begin, grainSize](std::size_t chunkBegin, std::size_t chunkEnd) {
+      partialResults[(chunkBegin - begin) / grainSize].emplace(function(chunkBegin, chunkEnd));
+    },
+    grainSize);
+
+  auto result = std::move(identity);
+  for (auto &partialResult : partialResults)
+    result = reduce(std::move(result), std::move(*partialResult));
+  return result;
+}
+/// @}
+
+/// \name Getters and setters
+/// @{
+
+/// @}
+
+/// \name Overloaded operators
+/// @{
+
+/// @}
+
+/// \name Private or protected implementation details, not exposed to the caller
+/// @{
+
+/// @}
+
+}  // namespace Utilities
+}  // end namespace AIM
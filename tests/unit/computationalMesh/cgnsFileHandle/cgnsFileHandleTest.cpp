@@ -0,0 +1,67 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <filesystem>
+#include <mutex>
+#include <utility>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+#include "cgnslib.h"
+
+// AIM include headers
+#include "src/computationalMesh/cgnsFileHandle/cgnsFileHandle.hpp"
+
+namespace {
+auto getNumberOfBases(int fileIndex) -> int {
+  auto numberOfBases = int{0};
+  auto lock = std::scoped_lock{AIM::Mesh::CGNSFileHandle::getLibraryMutex()};
+  auto errorCode = cg_nbases(fileIndex, &numberOfBases);
+  return errorCode == 0 ? numberOfBases : -1;
+}
+}  // namespace
+
+TEST(CGNSFileHandleTest, openFileOnConstructionTest) {
+  // arrange
+
+  // act
+  auto sut = AIM::Mesh::CGNSFileHandle{std::filesystem::path{"input/mesh.cgns"}};
+
+  // assert
+  EXPECT_TRUE(sut.isOpen());
+  EXPECT_EQ(getNumberOfBases(sut.getIndex()), 1);
+}
+
+TEST(CGNSFileHandleTest, moveConstructionTransfersOwnershipTest) {
+  // arrange
+  auto handle = AIM::Mesh::CGNSFileHandle{std::filesystem::path{"input/mesh.cgns"}};
+  auto fileIndex = handle.getIndex();
+
+  // act
+  auto sut = std::move(handle);
+
+  // assert
+  EXPECT_FALSE(handle.isOpen());
+  EXPECT_TRUE(sut.isOpen());
+  EXPECT_EQ(sut.getIndex(), fileIndex);
+  EXPECT_EQ(getNumberOfBases(sut.getIndex()), 1);
+}
+
+TEST(CGNSFileHandleTest, moveAssignmentClosesPreviousFileTest) {
+  // arrange
+  auto sut = AIM::Mesh::CGNSFileHandle{std::filesystem::path{"input/mesh.cgns"}};
+  auto other = AIM::Mesh::CGNSFileHandle{std::filesystem::path{"input/mesh.cgns"}};
+  auto previousFileIndex = sut.getIndex();
+
+  // act
+  sut = std::move(other);
+
+  // assert
+  EXPECT_TRUE(sut.isOpen());
+  EXPECT_FALSE(other.isOpen());
+  EXPECT_EQ(getNumberOfBases(sut.getIndex()), 1);
+  EXPECT_EQ(getNumberOfBases(previousFileIndex), -1);
+}
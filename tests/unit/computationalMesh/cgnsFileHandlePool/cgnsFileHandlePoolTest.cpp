@@ -0,0 +1,58 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <filesystem>
+#include <future>
+#include <utility>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/computationalMesh/cgnsFileHandlePool/cgnsFileHandlePool.hpp"
+
+TEST(CGNSFileHandlePoolTest, acquireReusesIdleHandleTest) {
+  // arrange
+  auto sut = AIM::Mesh::CGNSFileHandlePool{std::filesystem::path{"input/mesh.cgns"}};
+  auto fileIndex = int{0};
+
+  // act
+  {
+    auto lease = sut.acquire();
+    fileIndex = lease.getIndex();
+    EXPECT_EQ(sut.getNumberOfIdleHandles(), 0);
+  }
+  auto lease = sut.acquire();
+
+  // assert
+  EXPECT_EQ(lease.getIndex(), fileIndex);
+}
+
+TEST(CGNSFileHandlePoolTest, concurrentLeasesUseDifferentHandlesTest) {
+  // arrange
+  auto sut = AIM::Mesh::CGNSFileHandlePool{std::filesystem::path{"input/mesh.cgns"}};
+
+  // act
+  auto first = sut.acquire();
+  auto second = std::async(std::launch::async, [&sut]() { return sut.acquire(); }).get();
+
+  // assert
+  EXPECT_NE(first.getIndex(), second.getIndex());
+}
+
+TEST(CGNSFileHandlePoolTest, surplusHandlesAreClosedOnReleaseTest) {
+  // arrange
+  auto sut = AIM::Mesh::CGNSFileHandlePool{std::filesystem::path{"input/mesh.cgns"}, 1};
+
+  // act
+  {
+    auto first = sut.acquire();
+    auto second = sut.acquire();
+    auto movedLease = std::move(second);
+  }
+
+  // assert
+  EXPECT_EQ(sut.getNumberOfIdleHandles(), 1);
+}
@@ -3,8 +3,10 @@
 // (c) by Tom-Robin Teschner 2021. This file is distribuited under the MIT license.
 
 // c++ include headers
+#include <algorithm>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 // third-party include headers
 #include <gtest/gtest.h>
@@ -15,12 +17,14 @@
 #include "src/types/enums.hpp"
 #include "src/types/types.hpp"
 
+using MeshReaderType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>;
+
 class ComputationalMeshFixture : public ::testing::Test {
 public:
   ComputationalMeshFixture() {}
 
 protected:
-  AIM::Mesh::MeshReader meshReader_{AIM::Enum::Dimension::Two};
+  MeshReaderType meshReader_{};
 };
 
 TEST_F(ComputationalMeshFixture, testReadCoordinates) {
@@ -66,22 +70,25 @@ TEST_F(ComputationalMeshFixture, testConnectivityTable) {
   const auto connectivityTable = sut.getConnectivityTable();
 
   // assert
-  auto rhs = std::vector<AIM::Types::UInt>{9, 3, 4};
-  EXPECT_EQ(connectivityTable[0], rhs);
-  rhs = std::vector<AIM::Types::UInt>{9, 1, 2};
-  EXPECT_EQ(connectivityTable[1], rhs);
-  rhs = std::vector<AIM::Types::UInt>{9, 2, 3};
-  EXPECT_EQ(connectivityTable[2], rhs);
-  rhs = std::vector<AIM::Types::UInt>{9, 10, 8};
-  EXPECT_EQ(connectivityTable[3], rhs);
-  rhs = std::vector<AIM::Types::UInt>{9, 8, 1};
-  EXPECT_EQ(connectivityTable[4], rhs);
-  rhs = std::vector<AIM::Types::UInt>{4, 10, 9};
-  EXPECT_EQ(connectivityTable[5], rhs);
-  rhs = std::vector<AIM::Types::UInt>{5, 6, 10, 4};
-  EXPECT_EQ(connectivityTable[6], rhs);
-  rhs = std::vector<AIM::Types::UInt>{6, 7, 8, 10};
-  EXPECT_EQ(connectivityTable[7], rhs);
+  EXPECT_EQ(connectivityTable.size(), 8);
+  EXPECT_EQ(connectivityTable.getNumberOfIndices(), 26);
+
+  auto rhs = std::vector<AIM::Types::UInt>{8, 2, 3};
+  EXPECT_TRUE(std::ranges::equal(connectivityTable[0], rhs));
+  rhs = std::vector<AIM::Types::UInt>{8, 0, 1};
+  EXPECT_TRUE(std::ranges::equal(connectivityTable[1], rhs));
+  rhs = std::vector<AIM::Types::UInt>{8, 1, 2};
+  EXPECT_TRUE(std::ranges::equal(connectivityTable[2], rhs));
+  rhs = std::vector<AIM::Types::UInt>{8, 9, 7};
+  EXPECT_TRUE(std::ranges::equal(connectivityTable[3], rhs));
+  rhs = std::vector<AIM::Types::UInt>{8, 7, 0};
+  EXPECT_TRUE(std::ranges::equal(connectivityTable[4], rhs));
+  rhs = std::vector<AIM::Types::UInt>{3, 9, 8};
+  EXPECT_TRUE(std::ranges::equal(connectivityTable[5], rhs));
+  rhs = std::vector<AIM::Types::UInt>{4, 5, 9, 3};
+  EXPECT_TRUE(std::ranges::equal(connectivityTable[6], rhs));
+  rhs = std::vector<AIM::Types::UInt>{5, 6, 7, 9};
+  EXPECT_TRUE(std::ranges::equal(connectivityTable[7], rhs));
 }
 
 TEST_F(ComputationalMeshFixture, readBoundaryConditionsInfo) {
@@ -126,4 +133,18 @@ TEST_F(ComputationalMeshFixture, readBoundaryConditionConnectivity) {
   EXPECT_EQ(boundaryConditionConnectivity[2][1], 14);
   EXPECT_EQ(boundaryConditionConnectivity[3][0], 15);
   EXPECT_EQ(boundaryConditionConnectivity[3][1], 16);
-}
\ No newline at end of file
+}
+TEST_F(ComputationalMeshFixture, readMeshWithoutMeshReader) {
+  // arrange
+  auto reference = AIM::Mesh::ComputationalMesh{meshReader_};
+
+  // act
+  auto sut = AIM::Mesh::ComputationalMesh<AIM::Enum::Dimension::Two>{};
+
+  // assert
+  EXPECT_TRUE(std::ranges::equal(sut.getCoordinateX(), reference.getCoordinateX()));
+  EXPECT_TRUE(std::ranges::equal(sut.getCoordinateY(), reference.getCoordinateY()));
+  EXPECT_TRUE(std::ranges::equal(
+    sut.getConnectivityTable().getIndices(), reference.getConnectivityTable().getIndices()));
+  EXPECT_EQ(sut.getBoundaryConditionInfo(), reference.getBoundaryConditionInfo());
+}
@@ -0,0 +1,78 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/computationalMesh/connectivityTable/connectivityTable.hpp"
+#include "src/types/types.hpp"
+
+TEST(ConnectivityTableTest, addCellsOfMixedTypeTest) {
+  // arrange
+  auto sut = AIM::Mesh::ConnectivityTable{};
+
+  // act
+  sut.addCell(std::vector<AIM::Types::UInt>{0, 1, 2});
+  sut.addCell(std::vector<AIM::Types::CGNSInt>{1, 3, 4, 2});
+
+  // assert
+  EXPECT_EQ(sut.size(), 2);
+  EXPECT_EQ(sut.getNumberOfIndices(), 7);
+  EXPECT_EQ(sut.getNumberOfVerticesForCell(0), 3);
+  EXPECT_EQ(sut.getNumberOfVerticesForCell(1), 4);
+  EXPECT_TRUE(std::ranges::equal(sut[0], std::vector<AIM::Types::UInt>{0, 1, 2}));
+  EXPECT_TRUE(std::ranges::equal(sut[1], std::vector<AIM::Types::UInt>{1, 3, 4, 2}));
+  EXPECT_TRUE(std::ranges::equal(sut.getOffsets(), std::vector<AIM::Types::UInt>{0, 3, 7}));
+}
+
+TEST(ConnectivityTableTest, constructFromOffsetsAndIndicesTest) {
+  // arrange
+  auto offsets = std::vector<AIM::Types::UInt>{0, 4, 7};
+  auto indices = std::vector<AIM::Types::UInt>{0, 1, 2, 3, 3, 2, 4};
+
+  // act
+  auto sut = AIM::Mesh::ConnectivityTable{offsets, indices};
+
+  // assert
+  EXPECT_EQ(sut.size(), 2);
+  EXPECT_TRUE(std::ranges::equal(sut[0], std::vector<AIM::Types::UInt>{0, 1, 2, 3}));
+  EXPECT_TRUE(std::ranges::equal(sut[1], std::vector<AIM::Types::UInt>{3, 2, 4}));
+}
+
+TEST(ConnectivityTableTest, iterateOverCellsTest) {
+  // arrange
+  auto sut = AIM::Mesh::ConnectivityTable{{0, 3, 6}, {0, 1, 2, 2, 1, 3}};
+  auto numberOfCells = AIM::Types::UInt{0};
+  auto sumOfIndices = AIM::Types::UInt{0};
+
+  // act
+  for (const auto &cell : sut) {
+    ++numberOfCells;
+    for (const auto &vertex : cell)
+      sumOfIndices += vertex;
+  }
+
+  // assert
+  EXPECT_EQ(numberOfCells, 2);
+  EXPECT_EQ(sumOfIndices, 9);
+}
+
+TEST(ConnectivityTableTest, emptyTableTest) {
+  // arrange
+  auto sut = AIM::Mesh::ConnectivityTable{};
+
+  // act
+  auto begin = sut.begin();
+  auto end = sut.end();
+
+  // assert
+  EXPECT_TRUE(sut.empty());
+  EXPECT_EQ(sut.size(), 0);
+  EXPECT_TRUE(begin == end);
+}
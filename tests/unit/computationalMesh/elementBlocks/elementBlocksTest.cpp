@@ -0,0 +1,123 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/elementBlocks/elementBlocks.hpp"
+#include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+using MeshReaderType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>;
+using ElementBlocks2DType = AIM::Mesh::ElementBlocks<AIM::Enum::Dimension::Two>;
+using ElementBlocks3DType = AIM::Mesh::ElementBlocks<AIM::Enum::Dimension::Three>;
+
+class ElementBlocksFixture : public ::testing::Test {
+public:
+  ElementBlocksFixture() {}
+  void SetUp() override { cells_ = meshReader_.readConnectivityTable(); }
+
+protected:
+  MeshReaderType meshReader_{};
+  MeshReaderType::ConnectivityTableType cells_;
+};
+
+TEST_F(ElementBlocksFixture, triangleAndQuadBlocksOfMixedMesh) {
+  // arrange
+
+  // act
+  auto sut = ElementBlocks2DType{cells_};
+
+  // assert
+  auto triangles = sut.getBlock<AIM::Enum::ElementType::Tri3>();
+  auto quads = sut.getBlock<AIM::Enum::ElementType::Quad4>();
+  static_assert(decltype(triangles)::CellType::extent == 3);
+  static_assert(decltype(quads)::CellType::extent == 4);
+
+  EXPECT_EQ(sut.getNumberOfBlocks(), 2);
+  EXPECT_EQ(sut.getNumberOfCells(), 8);
+  EXPECT_EQ(triangles.getFirstCell(), 0);
+  EXPECT_EQ(triangles.size(), 6);
+  EXPECT_EQ(quads.getFirstCell(), 6);
+  EXPECT_EQ(quads.size(), 2);
+  for (std::size_t cell = 0; cell < triangles.size(); ++cell)
+    EXPECT_TRUE(std::ranges::equal(triangles[cell], cells_[triangles.getFirstCell() + cell]));
+  for (std::size_t cell = 0; cell < quads.size(); ++cell)
+    EXPECT_TRUE(std::ranges::equal(quads[cell], cells_[quads.getFirstCell() + cell]));
+}
+
+TEST_F(ElementBlocksFixture, blocksOfComputationalMesh) {
+  // arrange
+  auto mesh = AIM::Mesh::ComputationalMesh{meshReader_};
+
+  // act
+  auto sut = mesh.getElementBlocks();
+
+  // assert
+  auto numberOfCells = std::size_t{0};
+  sut.forEachBlock([&numberOfCells](const auto &block) { numberOfCells += block.size(); });
+  EXPECT_EQ(numberOfCells, mesh.getConnectivityTable().size());
+}
+
+TEST(ElementBlocksTest, forEachBlockVisitsNonEmptyBlocksInOrderOfElementType) {
+  // arrange
+  auto cells = ElementBlocks3DType::ConnectivityTableType{};
+  cells.addCell(std::vector<AIM::Types::UInt>{0, 1, 2, 3});
+  cells.addCell(std::vector<AIM::Types::UInt>{1, 2, 3, 4});
+  cells.addCell(std::vector<AIM::Types::UInt>{0, 1, 2, 3, 4, 5, 6, 7});
+
+  // act
+  auto sut = ElementBlocks3DType{cells};
+
+  // assert
+  auto visitedElementTypes = std::vector<int>{};
+  auto firstCells = std::vector<std::size_t>{};
+  sut.forEachBlock([&](const auto &block) {
+    using BlockType = std::remove_cvref_t<decltype(block)>;
+    static_assert(
+      BlockType::numberOfVertices == ElementBlocks3DType::getNumberOfVerticesPerElement(BlockType::elementType));
+    visitedElementTypes.push_back(BlockType::elementType);
+    firstCells.push_back(block.getFirstCell());
+  });
+  EXPECT_EQ(visitedElementTypes, (std::vector<int>{AIM::Enum::ElementType::Tetra4, AIM::Enum::ElementType::Hexa8}));
+  EXPECT_EQ(firstCells, (std::vector<std::size_t>{0, 2}));
+  EXPECT_TRUE(sut.getBlock<AIM::Enum::ElementType::Pyra5>().empty());
+  EXPECT_TRUE(sut.getBlock<AIM::Enum::ElementType::Penta6>().empty());
+}
+
+TEST(ElementBlocksTest, cellsNotGroupedByElementTypeThrow) {
+  // arrange
+  auto cells = ElementBlocks2DType::ConnectivityTableType{};
+  cells.addCell(std::vector<AIM::Types::UInt>{0, 1, 4, 3});
+  cells.addCell(std::vector<AIM::Types::UInt>{1, 2, 4});
+  cells.addCell(std::vector<AIM::Types::UInt>{2, 5, 6, 4});
+
+  // act
+
+  // assert
+  EXPECT_THROW(ElementBlocks2DType{cells}, std::runtime_error);
+}
+
+TEST(ElementBlocksTest, unsupportedElementTypeThrows) {
+  // arrange
+  auto cells = ElementBlocks2DType::ConnectivityTableType{};
+  cells.addCell(std::vector<AIM::Types::UInt>{0, 1, 2, 3, 4});
+
+  // act
+
+  // assert
+  EXPECT_THROW(ElementBlocks2DType{cells}, std::runtime_error);
+  EXPECT_THROW(ElementBlocks3DType::getElementType(7), std::runtime_error);
+  EXPECT_EQ(ElementBlocks3DType::getElementType(6), AIM::Enum::ElementType::Penta6);
+}
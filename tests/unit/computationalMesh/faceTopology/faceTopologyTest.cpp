@@ -0,0 +1,324 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/faceTopology/faceTopology.hpp"
+#include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+using MeshReaderType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>;
+using FaceTopology2DType = AIM::Mesh::FaceTopology<AIM::Enum::Dimension::Two>;
+using FaceTopology3DType = AIM::Mesh::FaceTopology<AIM::Enum::Dimension::Three>;
+
+template <int BoundaryCondition>
+struct CountBoundaryFaces;
+
+template <>
+struct CountBoundaryFaces<AIM::Enum::BoundaryCondition::Wall> {
+  template <typename GroupType>
+  static auto apply(const GroupType &group, std::vector<std::size_t> &count) -> void {
+    count[0] += group.size();
+  }
+};
+
+template <>
+struct CountBoundaryFaces<AIM::Enum::BoundaryCondition::Inlet> {
+  template <typename GroupType>
+  static auto apply(const GroupType &group, std::vector<std::size_t> &count) -> void {
+    count[1] += group.size();
+  }
+};
+
+template <>
+struct CountBoundaryFaces<AIM::Enum::BoundaryCondition::Outlet> {
+  template <typename GroupType>
+  static auto apply(const GroupType &group, std::vector<std::size_t> &count) -> void {
+    count[2] += group.size();
+  }
+};
+
+template <>
+struct CountBoundaryFaces<AIM::Enum::BoundaryCondition::Symmetry> {
+  template <typename GroupType>
+  static auto apply(const GroupType &group, std::vector<std::size_t> &count) -> void {
+    count[3] += group.size();
+  }
+};
+
+class FaceTopologyFixture : public ::testing::Test {
+public:
+  FaceTopologyFixture() {}
+  void SetUp() override {
+    cells_ = meshReader_.readConnectivityTable();
+    boundaryFaces_ = meshReader_.readBoundaryFaceConnectivity();
+  }
+
+protected:
+  MeshReaderType meshReader_{};
+  MeshReaderType::ConnectivityTableType cells_;
+  MeshReaderType::BoundaryFaceConnectivityType boundaryFaces_;
+};
+
+TEST_F(FaceTopologyFixture, countInteriorAndBoundaryFaces) {
+  // arrange
+
+  // act
+  auto sut = FaceTopology2DType{cells_, boundaryFaces_};
+
+  // assert
+  EXPECT_EQ(sut.getNumberOfFaces(), 17);
+  EXPECT_EQ(sut.getNumberOfInteriorFaces(), 9);
+  EXPECT_EQ(sut.getNumberOfBoundaryFaces(), 8);
+  EXPECT_EQ(sut.getNumberOfBoundaries(), 4);
+  EXPECT_EQ(sut.getFaceVertices().size(), 17);
+  EXPECT_EQ(sut.getOwner().size(), 17);
+  EXPECT_EQ(sut.getNeighbour().size(), 9);
+}
+
+TEST_F(FaceTopologyFixture, interiorFacesAreSortedByOwnerAndNeighbour) {
+  // arrange
+  auto sut = FaceTopology2DType{cells_, boundaryFaces_};
+
+  // act
+  auto owner = sut.getOwner();
+  auto neighbour = sut.getNeighbour();
+
+  // assert
+  for (std::size_t face = 0; face < sut.getNumberOfInteriorFaces(); ++face) {
+    EXPECT_LT(owner[face], neighbour[face]);
+    if (face > 0) {
+      EXPECT_TRUE(owner[face - 1] < owner[face] ||
+                  (owner[face - 1] == owner[face] && neighbour[face - 1] < neighbour[face]));
+    }
+
+    // both cells must contain the vertices of the face they share
+    for (const auto &vertex : sut.getFaceVertices()[face]) {
+      EXPECT_TRUE(std::ranges::find(cells_[owner[face]], vertex) != cells_[owner[face]].end());
+      EXPECT_TRUE(std::ranges::find(cells_[neighbour[face]], vertex) != cells_[neighbour[face]].end());
+    }
+  }
+}
+
+TEST_F(FaceTopologyFixture, eachCellIsBoundedByAsManyFacesAsItHasVertices) {
+  // arrange
+  auto sut = FaceTopology2DType{cells_, boundaryFaces_};
+  auto facesPerCell = std::vector<std::size_t>(cells_.size(), 0);
+
+  // act
+  for (const auto &owner : sut.getOwner())
+    ++facesPerCell[owner];
+  for (const auto &neighbour : sut.getNeighbour())
+    ++facesPerCell[neighbour];
+
+  // assert
+  for (std::size_t cell = 0; cell < cells_.size(); ++cell)
+    EXPECT_EQ(facesPerCell[cell], cells_[cell].size());
+}
+
+TEST_F(FaceTopologyFixture, boundaryFacesAreGroupedByBoundary) {
+  // arrange
+  auto sut = FaceTopology2DType{cells_, boundaryFaces_};
+
+  // act
+  auto offsets = sut.getBoundaryFaceOffsets();
+
+  // assert
+  ASSERT_EQ(offsets.size(), 5);
+  EXPECT_EQ(offsets[0], sut.getNumberOfInteriorFaces());
+  EXPECT_EQ(offsets[4], sut.getNumberOfFaces());
+  for (std::size_t boundary = 0; boundary < sut.getNumberOfBoundaries(); ++boundary) {
+    const auto [first, last] = sut.getBoundaryFaceRange(boundary);
+    EXPECT_EQ(last - first, boundaryFaces_[boundary].size());
+
+    for (auto face = first; face < last; ++face) {
+      auto faceVertices = std::vector<AIM::Types::UInt>(
+        sut.getFaceVertices()[face].begin(), sut.getFaceVertices()[face].end());
+      std::ranges::sort(faceVertices);
+      auto isOnBoundary = std::ranges::any_of(boundaryFaces_[boundary], [&faceVertices](const auto &boundaryFace) {
+        auto boundaryFaceVertices = std::vector<AIM::Types::UInt>(boundaryFace.begin(), boundaryFace.end());
+        std::ranges::sort(boundaryFaceVertices);
+        return boundaryFaceVertices == faceVertices;
+      });
+      EXPECT_TRUE(isOnBoundary);
+    }
+  }
+}
+
+TEST_F(FaceTopologyFixture, boundaryFacesAreGroupedByBoundaryConditionType) {
+  // arrange
+  auto boundaryConditions = FaceTopology2DType::BoundaryConditionType{{AIM::Enum::BoundaryCondition::Outlet, "bottom"},
+    {AIM::Enum::BoundaryCondition::Wall, "left"}, {AIM::Enum::BoundaryCondition::Symmetry, "right"},
+    {AIM::Enum::BoundaryCondition::Wall, "top"}};
+
+  // act
+  auto sut = FaceTopology2DType{cells_, boundaryFaces_, boundaryConditions};
+
+  // assert
+  auto interiorFaces = sut.getNumberOfInteriorFaces();
+  EXPECT_EQ(sut.getBoundaryConditionFaceRange(AIM::Enum::BoundaryCondition::Wall),
+    FaceTopology2DType::FaceRangeType(interiorFaces, interiorFaces + 4));
+  EXPECT_EQ(sut.getBoundaryConditionFaceRange(AIM::Enum::BoundaryCondition::Inlet),
+    FaceTopology2DType::FaceRangeType(interiorFaces + 4, interiorFaces + 4));
+  EXPECT_EQ(sut.getBoundaryConditionFaceRange(AIM::Enum::BoundaryCondition::Outlet),
+    FaceTopology2DType::FaceRangeType(interiorFaces + 4, interiorFaces + 6));
+  EXPECT_EQ(sut.getBoundaryConditionFaceRange(AIM::Enum::BoundaryCondition::Symmetry),
+    FaceTopology2DType::FaceRangeType(interiorFaces + 6, interiorFaces + 8));
+
+  // boundaries of the same type keep their order, so left comes before top
+  EXPECT_EQ(sut.getBoundaryFaceRange(1), FaceTopology2DType::FaceRangeType(interiorFaces, interiorFaces + 2));
+  EXPECT_EQ(sut.getBoundaryFaceRange(3), FaceTopology2DType::FaceRangeType(interiorFaces + 2, interiorFaces + 4));
+  EXPECT_EQ(sut.getBoundaryFaceRange(0), FaceTopology2DType::FaceRangeType(interiorFaces + 4, interiorFaces + 6));
+  EXPECT_EQ(sut.getBoundaryFaceRange(2), FaceTopology2DType::FaceRangeType(interiorFaces + 6, interiorFaces + 8));
+}
+
+TEST_F(FaceTopologyFixture, forEachBoundaryConditionDispatchesOncePerType) {
+  // arrange
+  auto boundaryConditions = FaceTopology2DType::BoundaryConditionType{{AIM::Enum::BoundaryCondition::Outlet, "bottom"},
+    {AIM::Enum::BoundaryCondition::Wall, "left"}, {AIM::Enum::BoundaryCondition::Symmetry, "right"},
+    {AIM::Enum::BoundaryCondition::Wall, "top"}};
+  auto sut = FaceTopology2DType{cells_, boundaryFaces_, boundaryConditions};
+
+  // act
+  auto count = std::vector<std::size_t>(4);
+  auto visitedBoundaryConditions = std::vector<int>{};
+  sut.forEachBoundaryCondition([&](const auto &group) {
+    constexpr auto boundaryCondition = std::remove_cvref_t<decltype(group)>::boundaryCondition;
+    CountBoundaryFaces<boundaryCondition>::apply(group, count);
+    visitedBoundaryConditions.push_back(boundaryCondition);
+
+    const auto [first, last] = group.getFaceRange();
+    EXPECT_TRUE(std::ranges::equal(group.getOwner(), sut.getOwner().subspan(first, last - first)));
+  });
+
+  // assert
+  EXPECT_EQ(count, (std::vector<std::size_t>{4, 0, 2, 2}));
+  EXPECT_EQ(visitedBoundaryConditions, (std::vector<int>{AIM::Enum::BoundaryCondition::Wall,
+    AIM::Enum::BoundaryCondition::Outlet, AIM::Enum::BoundaryCondition::Symmetry}));
+}
+
+TEST_F(FaceTopologyFixture, unassignedBoundariesAreOrderedLastAndSkipped) {
+  // arrange
+  auto boundaryConditions = FaceTopology2DType::BoundaryConditionType{
+    {AIM::Enum::BoundaryCondition::Unassigned, "bottom"}, {AIM::Enum::BoundaryCondition::Wall, "left"},
+    {AIM::Enum::BoundaryCondition::Unassigned, "right"}, {AIM::Enum::BoundaryCondition::Symmetry, "top"}};
+
+  // act
+  auto sut = FaceTopology2DType{cells_, boundaryFaces_, boundaryConditions};
+
+  // assert
+  auto interiorFaces = sut.getNumberOfInteriorFaces();
+  EXPECT_EQ(sut.getBoundaryConditionFaceRange(AIM::Enum::BoundaryCondition::Wall),
+    FaceTopology2DType::FaceRangeType(interiorFaces, interiorFaces + 2));
+  EXPECT_EQ(sut.getBoundaryConditionFaceRange(AIM::Enum::BoundaryCondition::Symmetry),
+    FaceTopology2DType::FaceRangeType(interiorFaces + 2, interiorFaces + 4));
+  EXPECT_EQ(sut.getBoundaryFaceRange(0), FaceTopology2DType::FaceRangeType(interiorFaces + 4, interiorFaces + 6));
+  EXPECT_EQ(sut.getBoundaryFaceRange(2), FaceTopology2DType::FaceRangeType(interiorFaces + 6, interiorFaces + 8));
+
+  auto visitedBoundaryConditions = std::vector<int>{};
+  sut.forEachBoundaryCondition([&](const auto &group) {
+    visitedBoundaryConditions.push_back(std::remove_cvref_t<decltype(group)>::boundaryCondition);
+  });
+  EXPECT_EQ(visitedBoundaryConditions,
+    (std::vector<int>{AIM::Enum::BoundaryCondition::Wall, AIM::Enum::BoundaryCondition::Symmetry}));
+}
+
+TEST_F(FaceTopologyFixture, unsupportedBoundaryConditionTypeThrows) {
+  // arrange
+  auto boundaryConditions = FaceTopology2DType::BoundaryConditionType{{AIM::Enum::BoundaryCondition::Wall, "bottom"},
+    {AIM::Enum::BoundaryCondition::Wall, "left"}, {AIM::Enum::BoundaryCondition::Unassigned + 1, "right"},
+    {AIM::Enum::BoundaryCondition::Wall, "top"}};
+
+  // act
+
+  // assert
+  EXPECT_THROW((FaceTopology2DType{cells_, boundaryFaces_, boundaryConditions}), std::runtime_error);
+}
+
+TEST_F(FaceTopologyFixture, mismatchingNumberOfBoundaryConditionsThrows) {
+  // arrange
+  auto boundaryConditions = FaceTopology2DType::BoundaryConditionType{{AIM::Enum::BoundaryCondition::Wall, "bottom"}};
+
+  // act
+
+  // assert
+  EXPECT_THROW((FaceTopology2DType{cells_, boundaryFaces_, boundaryConditions}), std::runtime_error);
+}
+
+TEST_F(FaceTopologyFixture, buildFromComputationalMesh) {
+  // arrange
+  auto mesh = AIM::Mesh::ComputationalMesh{meshReader_};
+
+  // act
+  auto sut = AIM::Mesh::FaceTopology{mesh};
+
+  // assert
+  auto reference = FaceTopology2DType{cells_, boundaryFaces_};
+  EXPECT_TRUE(std::ranges::equal(sut.getOwner(), reference.getOwner()));
+  EXPECT_TRUE(std::ranges::equal(sut.getNeighbour(), reference.getNeighbour()));
+  EXPECT_TRUE(std::ranges::equal(sut.getFaceVertices().getIndices(), reference.getFaceVertices().getIndices()));
+  EXPECT_EQ(sut.getBoundaryConditionFaceRange(AIM::Enum::BoundaryCondition::Wall), reference.getBoundaryFaceRange(0));
+  EXPECT_EQ(sut.getBoundaryConditionFaceRange(AIM::Enum::BoundaryCondition::Symmetry),
+    reference.getBoundaryFaceRange(3));
+}
+
+TEST_F(FaceTopologyFixture, unmatchedBoundaryFaceThrows) {
+  // arrange
+  boundaryFaces_.pop_back();
+
+  // act
+
+  // assert
+  EXPECT_THROW((FaceTopology2DType{cells_, boundaryFaces_}), std::runtime_error);
+}
+
+TEST(FaceTopologyTest, buildTetrahedralFaceTopology) {
+  // arrange
+  auto cells = FaceTopology3DType::ConnectivityTableType{};
+  cells.addCell(std::vector<AIM::Types::UInt>{0, 1, 2, 3});
+  cells.addCell(std::vector<AIM::Types::UInt>{1, 2, 3, 4});
+  auto boundaryFaces = FaceTopology3DType::BoundaryFaceConnectivityType(1);
+  for (const auto &face : std::vector<std::vector<AIM::Types::UInt>>{
+         {0, 2, 1}, {0, 1, 3}, {2, 0, 3}, {1, 2, 4}, {2, 3, 4}, {3, 1, 4}})
+    boundaryFaces[0].addCell(face);
+
+  // act
+  auto sut = FaceTopology3DType{cells, boundaryFaces};
+
+  // assert
+  EXPECT_EQ(sut.getNumberOfFaces(), 7);
+  EXPECT_EQ(sut.getNumberOfInteriorFaces(), 1);
+  EXPECT_EQ(sut.getNumberOfBoundaryFaces(), 6);
+  EXPECT_EQ(sut.getOwner()[0], 0);
+  EXPECT_EQ(sut.getNeighbour()[0], 1);
+  EXPECT_TRUE(std::ranges::equal(sut.getFaceVertices()[0], std::vector<AIM::Types::UInt>{1, 2, 3}));
+  EXPECT_EQ(sut.getBoundaryFaceRange(0), FaceTopology3DType::FaceRangeType(1, 7));
+}
+
+TEST(FaceTopologyTest, nonManifoldFaceThrows) {
+  // arrange
+  auto cells = FaceTopology3DType::ConnectivityTableType{};
+  cells.addCell(std::vector<AIM::Types::UInt>{0, 1, 2, 3});
+  cells.addCell(std::vector<AIM::Types::UInt>{1, 2, 3, 4});
+  cells.addCell(std::vector<AIM::Types::UInt>{1, 2, 3, 5});
+
+  // act
+
+  // assert
+  EXPECT_THROW((FaceTopology3DType{cells, {}}), std::runtime_error);
+}
@@ -0,0 +1,91 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/computationalMesh/hdf5BulkReading/hdf5BulkReading.hpp"
+
+class HDF5BulkReaderFixture : public ::testing::Test {
+public:
+  HDF5BulkReaderFixture() {}
+
+protected:
+  const std::filesystem::path meshFile_{"input/mesh.cgns"};
+  AIM::Mesh::HDF5BulkReader sut_{meshFile_};
+};
+
+TEST_F(HDF5BulkReaderFixture, detectsHDF5FilesTest) {
+  // arrange
+
+  // act
+  auto isMeshHDF5 = AIM::Mesh::HDF5BulkReader::isHDF5File(meshFile_);
+  auto isInputHDF5 = AIM::Mesh::HDF5BulkReader::isHDF5File("input/aim.json");
+  auto isMissingHDF5 = AIM::Mesh::HDF5BulkReader::isHDF5File("input/missing.cgns");
+
+  // assert
+  EXPECT_TRUE(isMeshHDF5);
+  EXPECT_FALSE(isInputHDF5);
+  EXPECT_FALSE(isMissingHDF5);
+}
+
+TEST_F(HDF5BulkReaderFixture, readCoordinatesWithoutConversionTest) {
+  // arrange
+  auto x = std::vector<double>(10);
+  auto y = std::vector<double>(10);
+
+  // act
+  sut_.readNode("/Base/dom-2/GridCoordinates/CoordinateX", std::span{x});
+  sut_.readNode("/Base/dom-2/GridCoordinates/CoordinateY", std::span{y});
+
+  // assert
+  EXPECT_EQ(x, (std::vector<double>{1.0, 0.5, 0.0, 0.0, 0.0, 0.5, 1.0, 1.0, 0.5, 0.5}));
+  EXPECT_DOUBLE_EQ(y[3], 0.1);
+  EXPECT_DOUBLE_EQ(y[9], 0.1);
+}
+
+TEST_F(HDF5BulkReaderFixture, readCoordinatesWithConversionTest) {
+  // arrange
+  auto x = std::vector<float>(10);
+
+  // act
+  sut_.readNode("/Base/dom-2/GridCoordinates/CoordinateX", std::span{x});
+
+  // assert
+  EXPECT_EQ(x, (std::vector<float>{1.0f, 0.5f, 0.0f, 0.0f, 0.0f, 0.5f, 1.0f, 1.0f, 0.5f, 0.5f}));
+}
+
+TEST_F(HDF5BulkReaderFixture, readElementConnectivityTest) {
+  // arrange
+  auto wideIndices = std::vector<std::int64_t>(8);
+  auto narrowIndices = std::vector<std::int32_t>(8);
+
+  // act
+  sut_.readNode("/Base/dom-2/QuadElements/ElementConnectivity", std::span{wideIndices});
+  sut_.readNode("/Base/dom-2/QuadElements/ElementConnectivity", std::span{narrowIndices});
+
+  // assert
+  EXPECT_EQ(wideIndices, (std::vector<std::int64_t>{5, 6, 10, 4, 6, 7, 8, 10}));
+  EXPECT_EQ(narrowIndices, (std::vector<std::int32_t>{5, 6, 10, 4, 6, 7, 8, 10}));
+}
+
+TEST_F(HDF5BulkReaderFixture, missingNodeOrWrongSizeThrowsTest) {
+  // arrange
+  auto buffer = std::vector<double>(10);
+  auto tooSmall = std::vector<double>(9);
+
+  // act
+
+  // assert
+  EXPECT_THROW(sut_.readNode("/Base/dom-2/GridCoordinates/CoordinateZ", std::span{buffer}), std::runtime_error);
+  EXPECT_THROW(sut_.readNode("/Base/dom-2/GridCoordinates/CoordinateX", std::span{tooSmall}), std::runtime_error);
+}
@@ -0,0 +1,135 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/faceTopology/faceTopology.hpp"
+#include "src/computationalMesh/inverseConnectivity/inverseConnectivity.hpp"
+#include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+using MeshReaderType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>;
+using InverseConnectivity2DType = AIM::Mesh::InverseConnectivity<AIM::Enum::Dimension::Two>;
+using InverseConnectivity3DType = AIM::Mesh::InverseConnectivity<AIM::Enum::Dimension::Three>;
+
+class InverseConnectivityFixture : public ::testing::Test {
+public:
+  InverseConnectivityFixture() {}
+  void SetUp() override {
+    cells_ = meshReader_.readConnectivityTable();
+    boundaryFaces_ = meshReader_.readBoundaryFaceConnectivity();
+  }
+
+protected:
+  MeshReaderType meshReader_{};
+  MeshReaderType::ConnectivityTableType cells_;
+  MeshReaderType::BoundaryFaceConnectivityType boundaryFaces_;
+};
+
+TEST_F(InverseConnectivityFixture, vertexToCellListsEachCellOfAVertex) {
+  // arrange
+
+  // act
+  auto sut = InverseConnectivity2DType{cells_};
+
+  // assert
+  const auto &vertexToCell = sut.getVertexToCell();
+  ASSERT_EQ(vertexToCell.size(), 10);
+  EXPECT_EQ(vertexToCell.getNumberOfIndices(), cells_.getNumberOfIndices());
+  for (std::size_t vertex = 0; vertex < vertexToCell.size(); ++vertex) {
+    EXPECT_TRUE(std::ranges::is_sorted(vertexToCell[vertex]));
+    for (const auto &cell : vertexToCell[vertex])
+      EXPECT_TRUE(std::ranges::find(cells_[cell], vertex) != cells_[cell].end());
+  }
+}
+
+TEST_F(InverseConnectivityFixture, cellToCellMatchesFaceTopology) {
+  // arrange
+  auto faceTopology = AIM::Mesh::FaceTopology<AIM::Enum::Dimension::Two>{cells_, boundaryFaces_};
+
+  // act
+  auto sut = InverseConnectivity2DType{cells_};
+
+  // assert
+  const auto &cellToCell = sut.getCellToCell();
+  ASSERT_EQ(cellToCell.size(), cells_.size());
+  EXPECT_EQ(cellToCell.getNumberOfIndices(), 2 * faceTopology.getNumberOfInteriorFaces());
+  for (std::size_t face = 0; face < faceTopology.getNumberOfInteriorFaces(); ++face) {
+    auto owner = faceTopology.getOwner()[face];
+    auto neighbour = faceTopology.getNeighbour()[face];
+    EXPECT_TRUE(std::ranges::binary_search(cellToCell[owner], neighbour));
+    EXPECT_TRUE(std::ranges::binary_search(cellToCell[neighbour], owner));
+  }
+}
+
+TEST_F(InverseConnectivityFixture, buildFromComputationalMesh) {
+  // arrange
+  auto mesh = AIM::Mesh::ComputationalMesh{meshReader_};
+
+  // act
+  auto sut = AIM::Mesh::InverseConnectivity{mesh};
+
+  // assert
+  auto reference = InverseConnectivity2DType{cells_};
+  EXPECT_TRUE(std::ranges::equal(sut.getVertexToCell().getIndices(), reference.getVertexToCell().getIndices()));
+  EXPECT_TRUE(std::ranges::equal(sut.getCellToCell().getIndices(), reference.getCellToCell().getIndices()));
+}
+
+TEST(InverseConnectivityTest, largeGridIsBuiltInParallelAndDeterministically) {
+  // arrange
+  constexpr auto numberOfCellsPerDirection = AIM::Types::UInt{128};
+  constexpr auto numberOfVerticesPerDirection = numberOfCellsPerDirection + 1;
+  auto cells = InverseConnectivity2DType::ConnectivityTableType{};
+  for (AIM::Types::UInt j = 0; j < numberOfCellsPerDirection; ++j)
+    for (AIM::Types::UInt i = 0; i < numberOfCellsPerDirection; ++i) {
+      auto first = j * numberOfVerticesPerDirection + i;
+      cells.addCell(std::vector<AIM::Types::UInt>{
+        first, first + 1, first + 1 + numberOfVerticesPerDirection, first + numberOfVerticesPerDirection});
+    }
+
+  // act
+  auto sut = InverseConnectivity2DType{cells};
+
+  // assert
+  const auto &vertexToCell = sut.getVertexToCell();
+  const auto &cellToCell = sut.getCellToCell();
+  EXPECT_EQ(vertexToCell.getNumberOfIndices(), cells.getNumberOfIndices());
+  EXPECT_EQ(cellToCell.getNumberOfIndices(), 4 * numberOfCellsPerDirection * (numberOfCellsPerDirection - 1));
+
+  // the vertex in the centre of the grid is shared by four cells, the cell next to it by four face neighbours
+  auto centreVertex = (numberOfCellsPerDirection / 2) * numberOfVerticesPerDirection + numberOfCellsPerDirection / 2;
+  auto cell = (numberOfCellsPerDirection / 2) * numberOfCellsPerDirection + numberOfCellsPerDirection / 2;
+  auto below = cell - numberOfCellsPerDirection;
+  auto above = cell + numberOfCellsPerDirection;
+  EXPECT_TRUE(
+    std::ranges::equal(vertexToCell[centreVertex], std::vector<AIM::Types::UInt>{below - 1, below, cell - 1, cell}));
+  EXPECT_TRUE(std::ranges::equal(cellToCell[cell], std::vector<AIM::Types::UInt>{below, cell - 1, cell + 1, above}));
+}
+
+TEST(InverseConnectivityTest, cellsSharingOnlyAnEdgeAreNoFaceNeighbours) {
+  // arrange
+  auto cells = InverseConnectivity3DType::ConnectivityTableType{};
+  cells.addCell(std::vector<AIM::Types::UInt>{0, 1, 2, 3});
+  cells.addCell(std::vector<AIM::Types::UInt>{1, 2, 3, 4});
+  cells.addCell(std::vector<AIM::Types::UInt>{3, 4, 5, 6});
+
+  // act
+  auto sut = InverseConnectivity3DType{cells};
+
+  // assert
+  const auto &cellToCell = sut.getCellToCell();
+  EXPECT_TRUE(std::ranges::equal(cellToCell[0], std::vector<AIM::Types::UInt>{1}));
+  EXPECT_TRUE(std::ranges::equal(cellToCell[1], std::vector<AIM::Types::UInt>{0}));
+  EXPECT_TRUE(cellToCell[2].empty());
+  EXPECT_TRUE(std::ranges::equal(sut.getVertexToCell()[3], std::vector<AIM::Types::UInt>{0, 1, 2}));
+}
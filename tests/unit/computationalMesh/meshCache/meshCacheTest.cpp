@@ -0,0 +1,159 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/computationalMesh/meshCache/meshCache.hpp"
+#include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+using MeshReaderType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>;
+using MeshCacheType = AIM::Mesh::MeshCache<>;
+
+class MeshCacheFixture : public ::testing::Test {
+public:
+  MeshCacheFixture() {}
+  void SetUp() override {
+    std::filesystem::remove(cacheFile_);
+    x_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::X>();
+    y_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::Y>();
+    connectivityTable_ = meshReader_.readConnectivityTable();
+    bc_ = meshReader_.readBoundaryConditions();
+    bcc_ = meshReader_.readBoundaryConditionConnectivity();
+    boundaryFaces_ = meshReader_.readBoundaryFaceConnectivity();
+    MeshCacheType::write(
+      cacheFile_, AIM::Enum::Dimension::Two, {x_, y_, {}}, connectivityTable_, bc_, bcc_, boundaryFaces_);
+  }
+  void TearDown() override { std::filesystem::remove(cacheFile_); }
+
+protected:
+  MeshReaderType meshReader_{};
+  std::filesystem::path meshFile_{"input/mesh.cgns"};
+  std::filesystem::path cacheFile_{MeshCacheType::getCacheFile(meshFile_)};
+  MeshReaderType::CoordinateType x_, y_;
+  MeshReaderType::ConnectivityTableType connectivityTable_;
+  MeshReaderType::BoundaryConditionType bc_;
+  MeshReaderType::BoundaryConditionConnectivityType bcc_;
+  MeshReaderType::BoundaryFaceConnectivityType boundaryFaces_;
+};
+
+TEST_F(MeshCacheFixture, readCoordinatesFromCacheTest) {
+  // arrange
+  auto sut = MeshCacheType{cacheFile_};
+
+  // act
+  auto x = sut.getCoordinate<AIM::Enum::Coordinate::X>();
+  auto y = sut.getCoordinate<AIM::Enum::Coordinate::Y>();
+  auto z = sut.getCoordinate<AIM::Enum::Coordinate::Z>();
+
+  // assert
+  EXPECT_EQ(sut.getDimensions(), AIM::Enum::Dimension::Two);
+  EXPECT_TRUE(std::ranges::equal(x, x_));
+  EXPECT_TRUE(std::ranges::equal(y, y_));
+  EXPECT_EQ(z.size(), 0);
+}
+
+TEST_F(MeshCacheFixture, readConnectivityTableFromCacheTest) {
+  // arrange
+  auto sut = MeshCacheType{cacheFile_};
+
+  // act
+  auto connectivityTable = sut.getConnectivityTable();
+
+  // assert
+  EXPECT_FALSE(connectivityTable.isOwning());
+  EXPECT_EQ(connectivityTable.size(), connectivityTable_.size());
+  EXPECT_TRUE(std::ranges::equal(connectivityTable.getOffsets(), connectivityTable_.getOffsets()));
+  EXPECT_TRUE(std::ranges::equal(connectivityTable.getIndices(), connectivityTable_.getIndices()));
+}
+
+TEST_F(MeshCacheFixture, readBoundaryConditionsFromCacheTest) {
+  // arrange
+  auto sut = MeshCacheType{cacheFile_};
+
+  // act
+  auto bc = sut.getBoundaryConditionInfo();
+  auto bcc = sut.getBoundaryConditionConnectivity();
+
+  // assert
+  EXPECT_EQ(bc, bc_);
+  EXPECT_EQ(bcc, bcc_);
+}
+
+TEST_F(MeshCacheFixture, readBoundaryFacesFromCacheTest) {
+  // arrange
+  auto sut = MeshCacheType{cacheFile_};
+
+  // act
+  auto boundaryFaces = sut.getBoundaryFaceConnectivity();
+
+  // assert
+  ASSERT_EQ(boundaryFaces.size(), boundaryFaces_.size());
+  for (std::size_t boundary = 0; boundary < boundaryFaces.size(); ++boundary) {
+    EXPECT_TRUE(std::ranges::equal(boundaryFaces[boundary].getOffsets(), boundaryFaces_[boundary].getOffsets()));
+    EXPECT_TRUE(std::ranges::equal(boundaryFaces[boundary].getIndices(), boundaryFaces_[boundary].getIndices()));
+  }
+}
+
+TEST_F(MeshCacheFixture, cacheIsUpToDateAfterWritingTest) {
+  // arrange
+
+  // act
+  auto upToDate = MeshCacheType::isUpToDate(cacheFile_, meshFile_, AIM::Enum::Dimension::Two);
+  auto wrongDimension = MeshCacheType::isUpToDate(cacheFile_, meshFile_, AIM::Enum::Dimension::Three);
+
+  // assert
+  EXPECT_TRUE(upToDate);
+  EXPECT_FALSE(wrongDimension);
+}
+
+TEST_F(MeshCacheFixture, cacheIsOutdatedIfMeshFileIsNewerTest) {
+  // arrange
+  auto cacheTime = std::filesystem::last_write_time(meshFile_) - std::chrono::hours(1);
+  std::filesystem::last_write_time(cacheFile_, cacheTime);
+
+  // act
+  auto upToDate = MeshCacheType::isUpToDate(cacheFile_, meshFile_, AIM::Enum::Dimension::Two);
+
+  // assert
+  EXPECT_FALSE(upToDate);
+}
+
+TEST_F(MeshCacheFixture, corruptCacheIsRejectedTest) {
+  // arrange
+  std::ofstream(cacheFile_, std::ios::binary | std::ios::trunc) << "not a mesh cache";
+
+  // act
+  auto upToDate = MeshCacheType::isUpToDate(cacheFile_, meshFile_, AIM::Enum::Dimension::Two);
+
+  // assert
+  EXPECT_FALSE(upToDate);
+  EXPECT_THROW(MeshCacheType{cacheFile_}, std::runtime_error);
+}
+
+TEST_F(MeshCacheFixture, cacheWithDifferentTypeWidthsIsRejectedTest) {
+  // arrange
+  using WideIndexMeshCacheType = AIM::Mesh::MeshCache<std::uint64_t, double>;
+  using SinglePrecisionMeshCacheType = AIM::Mesh::MeshCache<std::uint32_t, float>;
+
+  // act
+  auto wideIndexUpToDate = WideIndexMeshCacheType::isUpToDate(cacheFile_, meshFile_, AIM::Enum::Dimension::Two);
+  auto singlePrecisionUpToDate =
+    SinglePrecisionMeshCacheType::isUpToDate(cacheFile_, meshFile_, AIM::Enum::Dimension::Two);
+
+  // assert
+  EXPECT_FALSE(wideIndexUpToDate);
+  EXPECT_FALSE(singlePrecisionUpToDate);
+  EXPECT_THROW(WideIndexMeshCacheType{cacheFile_}, std::runtime_error);
+}
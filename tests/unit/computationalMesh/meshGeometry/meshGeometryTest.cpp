@@ -0,0 +1,180 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/faceTopology/faceTopology.hpp"
+#include "src/computationalMesh/meshGeometry/meshGeometry.hpp"
+#include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+using MeshReaderType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>;
+using MeshGeometry2DType = AIM::Mesh::MeshGeometry<AIM::Enum::Dimension::Two>;
+using MeshGeometry3DType = AIM::Mesh::MeshGeometry<AIM::Enum::Dimension::Three>;
+using FaceTopology2DType = AIM::Mesh::FaceTopology<AIM::Enum::Dimension::Two>;
+using FaceTopology3DType = AIM::Mesh::FaceTopology<AIM::Enum::Dimension::Three>;
+
+class MeshGeometryFixture : public ::testing::Test {
+public:
+  MeshGeometryFixture() {}
+  void SetUp() override {
+    x_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::X>();
+    y_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::Y>();
+    cells_ = meshReader_.readConnectivityTable();
+    boundaryFaces_ = meshReader_.readBoundaryFaceConnectivity();
+  }
+
+protected:
+  MeshReaderType meshReader_{};
+  MeshReaderType::CoordinateType x_, y_;
+  MeshReaderType::ConnectivityTableType cells_;
+  MeshReaderType::BoundaryFaceConnectivityType boundaryFaces_;
+};
+
+TEST_F(MeshGeometryFixture, cellsAreClosedAndPositive) {
+  // arrange
+  auto faceTopology = FaceTopology2DType{cells_, boundaryFaces_};
+
+  // act
+  auto sut = MeshGeometry2DType{{x_, y_}, cells_, faceTopology};
+
+  // assert
+  ASSERT_EQ(sut.getNumberOfCells(), cells_.size());
+  ASSERT_EQ(sut.getNumberOfFaces(), faceTopology.getNumberOfFaces());
+
+  // the outward area vectors of each cell sum to zero
+  const auto &areaVectors = sut.getFaceAreaVectors();
+  auto sumX = std::vector<double>(cells_.size(), 0.0);
+  auto sumY = std::vector<double>(cells_.size(), 0.0);
+  for (std::size_t face = 0; face < faceTopology.getNumberOfFaces(); ++face) {
+    auto owner = faceTopology.getOwner()[face];
+    sumX[owner] += areaVectors[AIM::Enum::Coordinate::X][face];
+    sumY[owner] += areaVectors[AIM::Enum::Coordinate::Y][face];
+    if (face < faceTopology.getNumberOfInteriorFaces()) {
+      auto neighbour = faceTopology.getNeighbour()[face];
+      sumX[neighbour] -= areaVectors[AIM::Enum::Coordinate::X][face];
+      sumY[neighbour] -= areaVectors[AIM::Enum::Coordinate::Y][face];
+    }
+  }
+  for (std::size_t cell = 0; cell < cells_.size(); ++cell) {
+    EXPECT_GT(sut.getCellVolumes()[cell], 0.0);
+    EXPECT_NEAR(sumX[cell], 0.0, 1e-12);
+    EXPECT_NEAR(sumY[cell], 0.0, 1e-12);
+  }
+}
+
+TEST_F(MeshGeometryFixture, totalVolumeMatchesDivergenceTheorem) {
+  // arrange
+  auto faceTopology = FaceTopology2DType{cells_, boundaryFaces_};
+
+  // act
+  auto sut = MeshGeometry2DType{{x_, y_}, cells_, faceTopology};
+
+  // assert
+  // the area of the domain is half the boundary integral of the position vector dotted with the outward normal
+  auto totalVolume = 0.0;
+  for (const auto &volume : sut.getCellVolumes())
+    totalVolume += volume;
+  auto boundaryIntegral = 0.0;
+  for (auto face = faceTopology.getNumberOfInteriorFaces(); face < faceTopology.getNumberOfFaces(); ++face)
+    for (std::size_t dimension = 0; dimension < 2; ++dimension)
+      boundaryIntegral += sut.getFaceCentroids()[dimension][face] * sut.getFaceAreaVectors()[dimension][face];
+  EXPECT_NEAR(totalVolume, 0.5 * boundaryIntegral, 1e-12);
+}
+
+TEST_F(MeshGeometryFixture, buildFromComputationalMesh) {
+  // arrange
+  auto mesh = AIM::Mesh::ComputationalMesh{meshReader_};
+  auto faceTopology = AIM::Mesh::FaceTopology{mesh};
+
+  // act
+  auto sut = AIM::Mesh::MeshGeometry{mesh, faceTopology};
+
+  // assert
+  auto reference = MeshGeometry2DType{{x_, y_}, cells_, FaceTopology2DType{cells_, boundaryFaces_}};
+  EXPECT_EQ(sut.getCellVolumes().size(), reference.getCellVolumes().size());
+  for (std::size_t cell = 0; cell < cells_.size(); ++cell)
+    EXPECT_DOUBLE_EQ(sut.getCellVolumes()[cell], reference.getCellVolumes()[cell]);
+}
+
+TEST(MeshGeometryTest, computeGeometryOfStructuredGrid) {
+  // arrange
+  auto x = std::vector<AIM::Types::FloatType>{0.0, 0.5, 1.0, 0.0, 0.5, 1.0, 0.0, 0.5, 1.0};
+  auto y = std::vector<AIM::Types::FloatType>{0.0, 0.0, 0.0, 0.5, 0.5, 0.5, 1.0, 1.0, 1.0};
+  auto cells = FaceTopology2DType::ConnectivityTableType{};
+  cells.addCell(std::vector<AIM::Types::UInt>{0, 1, 4, 3});
+  cells.addCell(std::vector<AIM::Types::UInt>{1, 2, 5, 4});
+  cells.addCell(std::vector<AIM::Types::UInt>{3, 4, 7, 6});
+  cells.addCell(std::vector<AIM::Types::UInt>{4, 5, 8, 7});
+  auto boundaryFaces = FaceTopology2DType::BoundaryFaceConnectivityType(1);
+  for (const auto &face : std::vector<std::vector<AIM::Types::UInt>>{
+         {0, 1}, {1, 2}, {2, 5}, {5, 8}, {8, 7}, {7, 6}, {6, 3}, {3, 0}})
+    boundaryFaces[0].addCell(face);
+  auto faceTopology = FaceTopology2DType{cells, boundaryFaces};
+
+  // act
+  auto sut = MeshGeometry2DType{{x, y}, cells, faceTopology};
+
+  // assert
+  const auto &centroids = sut.getCellCentroids();
+  EXPECT_DOUBLE_EQ(centroids[AIM::Enum::Coordinate::X][3], 0.75);
+  EXPECT_DOUBLE_EQ(centroids[AIM::Enum::Coordinate::Y][3], 0.75);
+  for (std::size_t cell = 0; cell < cells.size(); ++cell)
+    EXPECT_DOUBLE_EQ(sut.getCellVolumes()[cell], 0.25);
+
+  const auto &distances = sut.getDistanceVectors();
+  for (std::size_t face = 0; face < faceTopology.getNumberOfFaces(); ++face) {
+    EXPECT_DOUBLE_EQ(sut.getFaceAreas()[face], 0.5);
+    auto expectedDistance = face < faceTopology.getNumberOfInteriorFaces() ? 0.5 : 0.25;
+    auto distanceX = distances[AIM::Enum::Coordinate::X][face];
+    auto distanceY = distances[AIM::Enum::Coordinate::Y][face];
+    EXPECT_DOUBLE_EQ(std::abs(distanceX) + std::abs(distanceY), expectedDistance);
+
+    // the distance vector and the area vector both point out of the owner
+    auto projection = distanceX * sut.getFaceAreaVectors()[AIM::Enum::Coordinate::X][face] +
+                      distanceY * sut.getFaceAreaVectors()[AIM::Enum::Coordinate::Y][face];
+    EXPECT_DOUBLE_EQ(projection, 0.5 * expectedDistance);
+  }
+}
+
+TEST(MeshGeometryTest, computeGeometryOfTetrahedra) {
+  // arrange
+  auto x = std::vector<AIM::Types::FloatType>{0.0, 1.0, 0.0, 0.0, 1.0};
+  auto y = std::vector<AIM::Types::FloatType>{0.0, 0.0, 1.0, 0.0, 1.0};
+  auto z = std::vector<AIM::Types::FloatType>{0.0, 0.0, 0.0, 1.0, 1.0};
+  auto cells = FaceTopology3DType::ConnectivityTableType{};
+  cells.addCell(std::vector<AIM::Types::UInt>{0, 1, 2, 3});
+  cells.addCell(std::vector<AIM::Types::UInt>{1, 2, 3, 4});
+  auto boundaryFaces = FaceTopology3DType::BoundaryFaceConnectivityType(1);
+  for (const auto &face : std::vector<std::vector<AIM::Types::UInt>>{
+         {0, 2, 1}, {0, 1, 3}, {2, 0, 3}, {1, 2, 4}, {2, 3, 4}, {3, 1, 4}})
+    boundaryFaces[0].addCell(face);
+  auto faceTopology = FaceTopology3DType{cells, boundaryFaces};
+
+  // act
+  auto sut = MeshGeometry3DType{{x, y, z}, cells, faceTopology};
+
+  // assert
+  EXPECT_NEAR(sut.getCellVolumes()[0], 1.0 / 6.0, 1e-14);
+  EXPECT_NEAR(sut.getCellVolumes()[1], 1.0 / 3.0, 1e-14);
+  for (std::size_t dimension = 0; dimension < 3; ++dimension) {
+    EXPECT_NEAR(sut.getCellCentroids()[dimension][0], 0.25, 1e-14);
+    EXPECT_NEAR(sut.getCellCentroids()[dimension][1], 0.5, 1e-14);
+
+    // the shared face (1, 2, 3) has its normal along (1, 1, 1) with an area of sqrt(3) / 2
+    EXPECT_NEAR(sut.getFaceAreaVectors()[dimension][0], 0.5, 1e-14);
+    EXPECT_NEAR(sut.getFaceCentroids()[dimension][0], 1.0 / 3.0, 1e-14);
+    EXPECT_NEAR(sut.getDistanceVectors()[dimension][0], 0.25, 1e-14);
+  }
+  EXPECT_NEAR(sut.getFaceAreas()[0], std::sqrt(3.0) / 2.0, 1e-14);
+}
@@ -0,0 +1,211 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/meshPartitioning/meshPartitioning.hpp"
+#include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+using MeshReaderType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>;
+using MeshPartitioningType = AIM::Mesh::MeshPartitioning<AIM::Enum::Dimension::Two>;
+
+class MeshPartitioningFixture : public ::testing::Test {
+public:
+  MeshPartitioningFixture() {}
+  void SetUp() override {
+    x_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::X>();
+    y_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::Y>();
+    cells_ = meshReader_.readConnectivityTable();
+  }
+
+  // a structured grid of 8 x 8 quads on the unit square, numbered row by row
+  void makeGrid() {
+    constexpr auto numberOfCellsPerDirection = AIM::Types::UInt{8};
+    constexpr auto numberOfVerticesPerDirection = numberOfCellsPerDirection + 1;
+    gridX_.clear();
+    gridY_.clear();
+    for (AIM::Types::UInt j = 0; j < numberOfVerticesPerDirection; ++j)
+      for (AIM::Types::UInt i = 0; i < numberOfVerticesPerDirection; ++i) {
+        gridX_.push_back(static_cast<AIM::Types::FloatType>(i) / numberOfCellsPerDirection);
+        gridY_.push_back(static_cast<AIM::Types::FloatType>(j) / numberOfCellsPerDirection);
+      }
+    for (AIM::Types::UInt j = 0; j < numberOfCellsPerDirection; ++j)
+      for (AIM::Types::UInt i = 0; i < numberOfCellsPerDirection; ++i) {
+        auto first = j * numberOfVerticesPerDirection + i;
+        gridCells_.addCell(std::vector<AIM::Types::UInt>{
+          first, first + 1, first + 1 + numberOfVerticesPerDirection, first + numberOfVerticesPerDirection});
+      }
+  }
+
+  // each cell must be owned by exactly one partition and each halo cell must be sent by its owner in the same order
+  static auto expectConsistentPartitions(const MeshPartitioningType& sut, std::size_t numberOfCells) -> void {
+    auto owners = std::vector<std::size_t>(numberOfCells, 0);
+    for (const auto &partition : sut.getPartitions())
+      for (std::size_t cell = 0; cell < partition.numberOfOwnedCells; ++cell)
+        ++owners[partition.localToGlobal[cell]];
+    for (const auto &owner : owners)
+      EXPECT_EQ(owner, 1);
+
+    for (std::size_t current = 0; current < sut.getNumberOfPartitions(); ++current) {
+      const auto &partition = sut.getPartition(current);
+      ASSERT_EQ(partition.sendLists.size(), partition.neighbours.size());
+      ASSERT_EQ(partition.receiveLists.size(), partition.neighbours.size());
+      for (std::size_t neighbour = 0; neighbour < partition.neighbours.size(); ++neighbour) {
+        const auto &other = sut.getPartition(partition.neighbours[neighbour]);
+        auto position = std::ranges::find(other.neighbours, current) - other.neighbours.begin();
+        ASSERT_LT(static_cast<std::size_t>(position), other.neighbours.size());
+
+        auto receiveList = partition.receiveLists[neighbour];
+        auto sendList = other.sendLists[static_cast<std::size_t>(position)];
+        ASSERT_EQ(receiveList.size(), sendList.size());
+        for (std::size_t index = 0; index < receiveList.size(); ++index) {
+          EXPECT_GE(receiveList[index], partition.numberOfOwnedCells);
+          EXPECT_LT(sendList[index], other.numberOfOwnedCells);
+          EXPECT_EQ(partition.localToGlobal[receiveList[index]], other.localToGlobal[sendList[index]]);
+          auto haloCell = partition.localToGlobal[receiveList[index]];
+          EXPECT_EQ(sut.getCellPartition()[haloCell], partition.neighbours[neighbour]);
+        }
+      }
+    }
+  }
+
+protected:
+  MeshReaderType meshReader_{};
+  MeshReaderType::CoordinateType x_, y_;
+  MeshReaderType::ConnectivityTableType cells_;
+  std::vector<AIM::Types::FloatType> gridX_, gridY_;
+  MeshPartitioningType::ConnectivityTableType gridCells_;
+};
+
+TEST_F(MeshPartitioningFixture, partitionMeshIntoTwo) {
+  for (auto method :
+    {AIM::Enum::Partitioning::RecursiveCoordinateBisection, AIM::Enum::Partitioning::MultilevelGraph}) {
+    // arrange
+
+    // act
+    auto sut = MeshPartitioningType{method, 2, {x_, y_}, cells_};
+
+    // assert
+    ASSERT_EQ(sut.getNumberOfPartitions(), 2);
+    EXPECT_EQ(sut.getCellPartition().size(), cells_.size());
+    EXPECT_EQ(sut.getPartition(0).numberOfOwnedCells, 4);
+    EXPECT_EQ(sut.getPartition(1).numberOfOwnedCells, 4);
+    EXPECT_EQ(sut.getPartition(0).neighbours, std::vector<AIM::Types::UInt>{1});
+    EXPECT_EQ(sut.getPartition(1).neighbours, std::vector<AIM::Types::UInt>{0});
+    EXPECT_GT(sut.getEdgeCut(), 0);
+    expectConsistentPartitions(sut, cells_.size());
+  }
+}
+
+TEST_F(MeshPartitioningFixture, coordinateBisectionSplitsGridIntoQuadrants) {
+  // arrange
+  makeGrid();
+
+  // act
+  auto sut =
+    MeshPartitioningType{AIM::Enum::Partitioning::RecursiveCoordinateBisection, 4, {gridX_, gridY_}, gridCells_};
+
+  // assert
+  EXPECT_EQ(sut.getEdgeCut(), 16);
+  EXPECT_DOUBLE_EQ(sut.getImbalance(), 1.0);
+  for (const auto &partition : sut.getPartitions()) {
+    EXPECT_EQ(partition.numberOfOwnedCells, 16);
+    EXPECT_EQ(partition.neighbours.size(), 2);
+    EXPECT_EQ(partition.localToGlobal.size(), 16 + 8);
+  }
+  expectConsistentPartitions(sut, gridCells_.size());
+}
+
+TEST_F(MeshPartitioningFixture, multilevelGraphPartitioningOfGridIsBalanced) {
+  // arrange
+  makeGrid();
+
+  // act
+  auto sut = MeshPartitioningType{AIM::Enum::Partitioning::MultilevelGraph, 4, {gridX_, gridY_}, gridCells_};
+
+  // assert
+  EXPECT_LE(sut.getEdgeCut(), 24);
+  EXPECT_LE(sut.getImbalance(), 1.1);
+  expectConsistentPartitions(sut, gridCells_.size());
+}
+
+TEST_F(MeshPartitioningFixture, singlePartitionHasNoHalo) {
+  // arrange
+
+  // act
+  auto sut = MeshPartitioningType{AIM::Enum::Partitioning::MultilevelGraph, 1, {x_, y_}, cells_};
+
+  // assert
+  EXPECT_EQ(sut.getEdgeCut(), 0);
+  EXPECT_EQ(sut.getPartition(0).numberOfOwnedCells, cells_.size());
+  EXPECT_EQ(sut.getPartition(0).localToGlobal.size(), cells_.size());
+  EXPECT_TRUE(sut.getPartition(0).neighbours.empty());
+}
+
+TEST_F(MeshPartitioningFixture, partitionComputationalMesh) {
+  // arrange
+  auto mesh = AIM::Mesh::ComputationalMesh{meshReader_};
+
+  // act
+  auto sut = AIM::Mesh::MeshPartitioning{mesh};
+
+  // assert
+  EXPECT_GE(sut.getNumberOfPartitions(), 1);
+  EXPECT_LE(sut.getNumberOfPartitions(), cells_.size());
+  expectConsistentPartitions(sut, cells_.size());
+}
+
+TEST_F(MeshPartitioningFixture, invalidInputThrows) {
+  // arrange
+
+  // act
+  auto method = MeshPartitioningType::getMethodFromString("recursiveCoordinateBisection");
+
+  // assert
+  EXPECT_EQ(method, AIM::Enum::Partitioning::RecursiveCoordinateBisection);
+  EXPECT_THROW(MeshPartitioningType::getMethodFromString("metis"), std::runtime_error);
+  EXPECT_THROW((MeshPartitioningType{method, cells_.size() + 1, {x_, y_}, cells_}), std::runtime_error);
+  EXPECT_THROW((MeshPartitioningType{method, 0, {x_, y_}, cells_}), std::runtime_error);
+}
+
+TEST(MeshPartitioningTest, heavyVerticesDoNotLeavePartitionsEmpty) {
+  // arrange
+  // a path of 8 vertices, the first one carries most of the weight, as coarse graphs with heavy matched nodes do
+  auto graph = MeshPartitioningType::GraphType{};
+  graph.vertexWeights = {50, 1, 1, 1, 1, 1, 1, 1};
+  for (std::size_t vertex = 0; vertex < graph.size(); ++vertex) {
+    if (vertex > 0)
+      graph.adjacency.push_back(static_cast<AIM::Types::UInt>(vertex - 1));
+    if (vertex + 1 < graph.size())
+      graph.adjacency.push_back(static_cast<AIM::Types::UInt>(vertex + 1));
+    graph.offsets.push_back(graph.adjacency.size());
+  }
+  graph.edgeWeights.assign(graph.adjacency.size(), 1);
+
+  for (std::size_t numberOfPartitions = 1; numberOfPartitions <= graph.size(); ++numberOfPartitions) {
+    // act
+    auto partition = MeshPartitioningType::partitionGraph(graph, numberOfPartitions);
+
+    // assert
+    auto sizes = std::vector<std::size_t>(numberOfPartitions, 0);
+    for (const auto &owner : partition) {
+      ASSERT_LT(owner, numberOfPartitions);
+      ++sizes[owner];
+    }
+    for (const auto &size : sizes)
+      EXPECT_GE(size, 1);
+  }
+  EXPECT_THROW(MeshPartitioningType::partitionGraph(graph, graph.size() + 1), std::runtime_error);
+}
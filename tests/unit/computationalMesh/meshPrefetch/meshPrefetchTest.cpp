@@ -0,0 +1,88 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <utility>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/meshPrefetch/meshPrefetch.hpp"
+#include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+using MeshReaderType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>;
+using MeshPrefetchType = AIM::Mesh::MeshPrefetch<AIM::Enum::Dimension::Two>;
+
+class MeshPrefetchFixture : public ::testing::Test {
+public:
+  MeshPrefetchFixture() {}
+  void SetUp() override {
+    x_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::X>();
+    y_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::Y>();
+    connectivityTable_ = meshReader_.readConnectivityTable();
+    bc_ = meshReader_.readBoundaryConditions();
+    bcc_ = meshReader_.readBoundaryConditionConnectivity();
+  }
+
+protected:
+  MeshReaderType meshReader_{};
+  MeshReaderType::CoordinateType x_, y_;
+  MeshReaderType::ConnectivityTableType connectivityTable_;
+  MeshReaderType::BoundaryConditionType bc_;
+  MeshReaderType::BoundaryConditionConnectivityType bcc_;
+};
+
+TEST_F(MeshPrefetchFixture, prefetchedComponentsMatchMeshReaderTest) {
+  // arrange
+  auto sut = MeshPrefetchType{};
+
+  // act
+  const auto &x = sut.getCoordinate<AIM::Enum::Coordinate::X>().get();
+  const auto &y = sut.getCoordinate<AIM::Enum::Coordinate::Y>().get();
+  const auto &connectivityTable = sut.getConnectivityTable().get();
+
+  // assert
+  EXPECT_TRUE(std::ranges::equal(x, x_));
+  EXPECT_TRUE(std::ranges::equal(y, y_));
+  EXPECT_TRUE(std::ranges::equal(connectivityTable.getOffsets(), connectivityTable_.getOffsets()));
+  EXPECT_TRUE(std::ranges::equal(connectivityTable.getIndices(), connectivityTable_.getIndices()));
+  EXPECT_EQ(sut.getBoundaryConditionInfo().get(), bc_);
+  EXPECT_EQ(sut.getBoundaryConditionConnectivity().get(), bcc_);
+}
+
+TEST_F(MeshPrefetchFixture, futuresOutliveMeshPrefetchTest) {
+  // arrange
+  auto connectivityTableFuture = MeshPrefetchType::FutureType<MeshReaderType::ConnectivityTableType>{};
+
+  // act
+  {
+    auto sut = MeshPrefetchType{};
+    connectivityTableFuture = sut.getConnectivityTable();
+  }
+
+  // assert
+  EXPECT_TRUE(std::ranges::equal(connectivityTableFuture.get().getIndices(), connectivityTable_.getIndices()));
+}
+
+TEST_F(MeshPrefetchFixture, computationalMeshFromPrefetchTest) {
+  // arrange
+  auto meshPrefetch = MeshPrefetchType{};
+
+  // act
+  auto sut = AIM::Mesh::ComputationalMesh{meshPrefetch};
+  auto copy = sut;
+
+  // assert
+  EXPECT_TRUE(std::ranges::equal(copy.getCoordinateX(), x_));
+  EXPECT_TRUE(std::ranges::equal(copy.getCoordinateY(), y_));
+  EXPECT_FALSE(copy.getConnectivityTable().isOwning());
+  EXPECT_TRUE(std::ranges::equal(copy.getConnectivityTable().getIndices(), connectivityTable_.getIndices()));
+  EXPECT_EQ(copy.getBoundaryConditionInfo(), bc_);
+  EXPECT_EQ(copy.getBoundaryConditionConnvectivity(), bcc_);
+}
@@ -3,23 +3,120 @@
 // (c) by Tom-Robin Teschner 2021. This file is distribuited under the MIT license.
 
 // c++ include headers
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 // third-party include headers
 #include <gtest/gtest.h>
 
+#include "cgnslib.h"
+
 // AIM include headers
+#include "src/computationalMesh/cgnsFileHandle/cgnsFileHandle.hpp"
 #include "src/computationalMesh/meshReading/meshReading.hpp"
 #include "src/types/enums.hpp"
 #include "src/types/types.hpp"
 
+using MeshReaderType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>;
+
 class MeshReadingFixture : public ::testing::Test {
 public:
   MeshReadingFixture() {}
 
 protected:
-  AIM::Mesh::MeshReader meshReader_{AIM::Enum::Dimension::Two};
+  MeshReaderType meshReader_{};
+};
+
+namespace {
+auto throwOnCGNSError(int errorCode) -> void {
+  if (errorCode != CG_OK)
+    throw std::runtime_error(std::string{"could not write multi-zone test mesh: "} + cg_get_error());
+}
+
+// writes the rectangle [0, 2] x [0, 1] as two zones of two quads each, which share the vertices at x = 1. Each zone
+// stores its boundary edges after its cells, the boundaries "bottom" and "top" appear in both zones
+auto writeTwoZoneMesh(const std::filesystem::path &meshFile) -> void {
+  constexpr auto donorDataType = sizeof(cgsize_t) == 8 ? CGNS_ENUMV(LongInteger) : CGNS_ENUMV(Integer);
+  auto lock = std::scoped_lock{AIM::Mesh::CGNSFileHandle::getLibraryMutex()};
+  auto fileIndex = int{0}, base = int{0}, index = int{0};
+  throwOnCGNSError(cg_open(meshFile.string().c_str(), CG_MODE_WRITE, &fileIndex));
+  throwOnCGNSError(cg_base_write(fileIndex, "Base", 2, 2, &base));
+
+  auto writeZone = [&](const char *name, double xOffset, const char *sideName, CGNS_ENUMT(BCType_t) sideType,
+                     std::vector<cgsize_t> sideEdge) {
+    auto zone = int{0};
+    auto size = std::vector<cgsize_t>{6, 2, 0};
+    throwOnCGNSError(cg_zone_write(fileIndex, base, name, size.data(), CGNS_ENUMV(Unstructured), &zone));
+
+    auto x = std::vector<double>{0.0, 0.5, 1.0, 0.0, 0.5, 1.0};
+    auto y = std::vector<double>{0.0, 0.0, 0.0, 1.0, 1.0, 1.0};
+    std::ranges::for_each(x, [xOffset](double &value) { value += xOffset; });
+    throwOnCGNSError(cg_coord_write(fileIndex, base, zone, CGNS_ENUMV(RealDouble), "CoordinateX", x.data(), &index));
+    throwOnCGNSError(cg_coord_write(fileIndex, base, zone, CGNS_ENUMV(RealDouble), "CoordinateY", y.data(), &index));
+
+    auto cells = std::vector<cgsize_t>{1, 2, 5, 4, 2, 3, 6, 5};
+    auto edges = std::vector<cgsize_t>{1, 2, 2, 3, sideEdge[0], sideEdge[1], 6, 5, 5, 4};
+    throwOnCGNSError(
+      cg_section_write(fileIndex, base, zone, "cells", CGNS_ENUMV(QUAD_4), 1, 2, 0, cells.data(), &index));
+    throwOnCGNSError(
+      cg_section_write(fileIndex, base, zone, "edges", CGNS_ENUMV(BAR_2), 3, 7, 0, edges.data(), &index));
+
+    auto writeBoundary = [&](const char *boundaryName, CGNS_ENUMT(BCType_t) type, std::vector<cgsize_t> range) {
+      throwOnCGNSError(
+        cg_boco_write(fileIndex, base, zone, boundaryName, type, CGNS_ENUMV(PointRange), 2, range.data(), &index));
+      throwOnCGNSError(cg_boco_gridlocation_write(fileIndex, base, zone, index, CGNS_ENUMV(EdgeCenter)));
+    };
+    writeBoundary("bottom", CGNS_ENUMV(BCWall), {3, 4});
+    writeBoundary(sideName, sideType, {5, 5});
+    writeBoundary("top", CGNS_ENUMV(BCSymmetryPlane), {6, 7});
+    return zone;
+  };
+  auto zoneA = writeZone("zoneA", 0.0, "inlet", CGNS_ENUMV(BCInflow), {4, 1});
+  writeZone("zoneB", 1.0, "outlet", CGNS_ENUMV(BCOutflow), {3, 6});
+
+  // the right vertices of the first zone coincide with the left vertices of the second zone
+  auto points = std::vector<cgsize_t>{3, 6};
+  auto donorPoints = std::vector<cgsize_t>{1, 4};
+  throwOnCGNSError(cg_conn_write(fileIndex, base, zoneA, "interface", CGNS_ENUMV(Vertex),
+    CGNS_ENUMV(Abutting1to1), CGNS_ENUMV(PointList), 2, points.data(), "zoneB", CGNS_ENUMV(Unstructured),
+    CGNS_ENUMV(PointListDonor), donorDataType, 2, donorPoints.data(), &index));
+  throwOnCGNSError(cg_close(fileIndex));
+}
+}  // namespace
+
+class MultiZoneMeshReadingFixture : public ::testing::Test {
+protected:
+  void SetUp() override {
+    // each test writes its own mesh and parameter file, so that tests can be run in parallel
+    originalPath_ = std::filesystem::current_path();
+    testPath_ = std::filesystem::temp_directory_path() / "aimMultiZoneMesh" /
+      ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    std::filesystem::create_directories(testPath_ / "input");
+    std::ofstream{testPath_ / "input" / "aim.json"} << R"({"mesh": {"filename": "input/mesh.cgns"}})";
+    writeTwoZoneMesh(testPath_ / "input" / "mesh.cgns");
+
+    std::filesystem::current_path(testPath_);
+    meshReader_ = std::make_unique<MeshReaderType>();
+  }
+
+  void TearDown() override {
+    meshReader_.reset();
+    std::filesystem::current_path(originalPath_);
+    std::filesystem::remove_all(testPath_);
+  }
+
+protected:
+  std::filesystem::path originalPath_;
+  std::filesystem::path testPath_;
+  std::unique_ptr<MeshReaderType> meshReader_;
 };
 
 TEST_F(MeshReadingFixture, testReadCoordinates) {
@@ -63,22 +160,25 @@ TEST_F(MeshReadingFixture, testConnectivityTable) {
   const auto sut = meshReader_.readConnectivityTable();
 
   // assert
-  auto rhs = std::vector<AIM::Types::UInt>{9, 3, 4};
-  EXPECT_EQ(sut[0], rhs);
-  rhs = std::vector<AIM::Types::UInt>{9, 1, 2};
-  EXPECT_EQ(sut[1], rhs);
-  rhs = std::vector<AIM::Types::UInt>{9, 2, 3};
-  EXPECT_EQ(sut[2], rhs);
-  rhs = std::vector<AIM::Types::UInt>{9, 10, 8};
-  EXPECT_EQ(sut[3], rhs);
-  rhs = std::vector<AIM::Types::UInt>{9, 8, 1};
-  EXPECT_EQ(sut[4], rhs);
-  rhs = std::vector<AIM::Types::UInt>{4, 10, 9};
-  EXPECT_EQ(sut[5], rhs);
-  rhs = std::vector<AIM::Types::UInt>{5, 6, 10, 4};
-  EXPECT_EQ(sut[6], rhs);
-  rhs = std::vector<AIM::Types::UInt>{6, 7, 8, 10};
-  EXPECT_EQ(sut[7], rhs);
+  EXPECT_EQ(sut.size(), 8);
+  EXPECT_EQ(sut.getNumberOfIndices(), 26);
+
+  auto rhs = std::vector<AIM::Types::UInt>{8, 2, 3};
+  EXPECT_TRUE(std::ranges::equal(sut[0], rhs));
+  rhs = std::vector<AIM::Types::UInt>{8, 0, 1};
+  EXPECT_TRUE(std::ranges::equal(sut[1], rhs));
+  rhs = std::vector<AIM::Types::UInt>{8, 1, 2};
+  EXPECT_TRUE(std::ranges::equal(sut[2], rhs));
+  rhs = std::vector<AIM::Types::UInt>{8, 9, 7};
+  EXPECT_TRUE(std::ranges::equal(sut[3], rhs));
+  rhs = std::vector<AIM::Types::UInt>{8, 7, 0};
+  EXPECT_TRUE(std::ranges::equal(sut[4], rhs));
+  rhs = std::vector<AIM::Types::UInt>{3, 9, 8};
+  EXPECT_TRUE(std::ranges::equal(sut[5], rhs));
+  rhs = std::vector<AIM::Types::UInt>{4, 5, 9, 3};
+  EXPECT_TRUE(std::ranges::equal(sut[6], rhs));
+  rhs = std::vector<AIM::Types::UInt>{5, 6, 7, 9};
+  EXPECT_TRUE(std::ranges::equal(sut[7], rhs));
 }
 
 TEST_F(MeshReadingFixture, readBoundaryConditionsInfo) {
@@ -121,4 +221,259 @@ TEST_F(MeshReadingFixture, readBoundaryConditionConnectivity) {
   EXPECT_EQ(sut[2][1], 14);
   EXPECT_EQ(sut[3][0], 15);
   EXPECT_EQ(sut[3][1], 16);
-}
\ No newline at end of file
+}
+
+TEST_F(MeshReadingFixture, readBoundaryFaceConnectivity) {
+  // arrange
+  auto expected = std::vector<std::vector<AIM::Types::UInt>>{{4, 5, 5, 6}, {2, 3, 3, 4}, {6, 7, 7, 0}, {0, 1, 1, 2}};
+
+  // act
+  const auto sut = meshReader_.readBoundaryFaceConnectivity();
+
+  // assert
+  ASSERT_EQ(sut.size(), 4);
+  for (std::size_t boundary = 0; boundary < sut.size(); ++boundary) {
+    EXPECT_EQ(sut[boundary].size(), 2);
+    EXPECT_EQ(sut[boundary].getNumberOfVerticesForCell(0), 2);
+    EXPECT_TRUE(std::ranges::equal(sut[boundary].getIndices(), expected[boundary]));
+  }
+}
+
+TEST_F(MeshReadingFixture, readCoordinatesInChunks) {
+  // arrange
+  const auto x = meshReader_.readCoordinate<AIM::Enum::Coordinate::X>();
+  auto sut = std::vector<AIM::Types::FloatType>{};
+  auto chunkSizes = std::vector<std::size_t>{};
+
+  // act
+  meshReader_.readCoordinateInChunks<AIM::Enum::Coordinate::X>(4, [&](std::size_t firstVertex, auto chunk) {
+    EXPECT_EQ(firstVertex, sut.size());
+    sut.insert(sut.end(), chunk.begin(), chunk.end());
+    chunkSizes.push_back(chunk.size());
+  });
+
+  // assert
+  EXPECT_TRUE(std::ranges::equal(sut, x));
+  EXPECT_EQ(chunkSizes, (std::vector<std::size_t>{4, 4, 2}));
+}
+
+TEST_F(MeshReadingFixture, readConnectivityTableInChunks) {
+  // arrange
+  const auto connectivityTable = meshReader_.readConnectivityTable();
+  auto sut = MeshReaderType::ConnectivityTableType{};
+  auto chunkSizes = std::vector<std::size_t>{};
+
+  // act
+  // a chunk size of 5 makes the second chunk span both the tri and the quad section
+  meshReader_.readConnectivityTableInChunks(5, [&](std::size_t firstCell, const auto &chunk) {
+    EXPECT_EQ(firstCell, sut.size());
+    for (const auto &cell : chunk)
+      sut.addCell(cell);
+    chunkSizes.push_back(chunk.size());
+  });
+
+  // assert
+  EXPECT_EQ(sut.size(), 8);
+  EXPECT_TRUE(std::ranges::equal(sut.getOffsets(), connectivityTable.getOffsets()));
+  EXPECT_TRUE(std::ranges::equal(sut.getIndices(), connectivityTable.getIndices()));
+  EXPECT_EQ(chunkSizes, (std::vector<std::size_t>{5, 3}));
+}
+
+TEST_F(MeshReadingFixture, copiedReaderOutlivesOriginal) {
+  // arrange
+  auto original = std::make_unique<MeshReaderType>();
+  auto sut = *original;
+
+  // act
+  original.reset();
+  const auto connectivityTable = sut.readConnectivityTable();
+
+  // assert
+  EXPECT_EQ(connectivityTable.size(), 8);
+  EXPECT_TRUE(std::ranges::equal(connectivityTable.getIndices(), meshReader_.readConnectivityTable().getIndices()));
+}
+
+TEST_F(MeshReadingFixture, forEachCoordinateVisitsMeshDimensions) {
+  // arrange
+  auto coordinateSizes = std::vector<std::size_t>{};
+
+  // act
+  MeshReaderType::forEachCoordinate([this, &coordinateSizes](auto index) {
+    coordinateSizes.push_back(meshReader_.readCoordinate<decltype(index)::value>().size());
+  });
+
+  // assert
+  EXPECT_EQ(MeshReaderType::getDimensions(), AIM::Enum::Dimension::Two);
+  EXPECT_EQ(coordinateSizes, (std::vector<std::size_t>{10, 10}));
+}
+
+TEST_F(MeshReadingFixture, readMeshWithWideIndicesAndSinglePrecision) {
+  // arrange
+  auto sut = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two, std::uint64_t, float>{};
+
+  // act
+  const auto x = sut.readCoordinate<AIM::Enum::Coordinate::X>();
+  const auto connectivityTable = sut.readConnectivityTable();
+
+  // assert
+  EXPECT_EQ(sizeof(x[0]), sizeof(float));
+  EXPECT_EQ(sizeof(connectivityTable.getIndices()[0]), sizeof(std::uint64_t));
+  EXPECT_TRUE(std::ranges::equal(x, meshReader_.readCoordinate<AIM::Enum::Coordinate::X>(),
+    [](float lhs, double rhs) { return lhs == static_cast<float>(rhs); }));
+  EXPECT_TRUE(std::ranges::equal(connectivityTable.getOffsets(), meshReader_.readConnectivityTable().getOffsets()));
+  EXPECT_TRUE(std::ranges::equal(connectivityTable.getIndices(), meshReader_.readConnectivityTable().getIndices()));
+}
+
+TEST_F(MeshReadingFixture, singleZoneMeshIsReadAsOneZone) {
+  // arrange
+
+  // act
+  auto numberOfZones = meshReader_.getNumberOfZones();
+
+  // assert
+  EXPECT_EQ(numberOfZones, 1);
+}
+
+TEST(MeshReadingTest, meshWithoutBaseOfMatchingDimensionThrows) {
+  // arrange
+  // the mesh file only contains a two-dimensional base, which is skipped by a three-dimensional reader
+  using MeshReader3DType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Three>;
+
+  // act
+  auto construct = []() { MeshReader3DType{}; };
+
+  // assert
+  EXPECT_THROW(construct(), std::runtime_error);
+}
+
+TEST(MeshReadingTest, mergeInterfaceVerticesDeduplicatesSharedVertices) {
+  // arrange
+  // two zones with 4 vertices each, vertices 2 and 3 of the first zone coincide with vertices 4 and 5 of the second
+  auto interfaceVertices = MeshReaderType::InterfaceVerticesType{{2, 4}, {5, 3}};
+
+  // act
+  auto sut = MeshReaderType::mergeInterfaceVertices(8, interfaceVertices);
+
+  // assert
+  EXPECT_EQ(sut, (std::vector<MeshReaderType::IndexType>{0, 1, 2, 3, 2, 3, 4, 5}));
+}
+
+TEST(MeshReadingTest, mergeInterfaceVerticesFollowsChainsOfInterfaces) {
+  // arrange
+  // a vertex shared by three zones is only listed pairwise on each interface
+  auto interfaceVertices = MeshReaderType::InterfaceVerticesType{{5, 8}, {8, 1}};
+
+  // act
+  auto sut = MeshReaderType::mergeInterfaceVertices(9, interfaceVertices);
+
+  // assert
+  EXPECT_EQ(sut, (std::vector<MeshReaderType::IndexType>{0, 1, 2, 3, 4, 1, 5, 6, 1}));
+}
+
+TEST(MeshReadingTest, mergeInterfaceVerticesWithoutInterfacesKeepsNumbering) {
+  // arrange
+  auto interfaceVertices = MeshReaderType::InterfaceVerticesType{};
+
+  // act
+  auto sut = MeshReaderType::mergeInterfaceVertices(3, interfaceVertices);
+
+  // assert
+  EXPECT_EQ(sut, (std::vector<MeshReaderType::IndexType>{0, 1, 2}));
+}
+
+TEST(MeshReadingTest, mergeInterfaceVerticesOutOfRangeThrows) {
+  // arrange
+  auto interfaceVertices = MeshReaderType::InterfaceVerticesType{{0, 3}};
+
+  // act
+
+  // assert
+  EXPECT_THROW(MeshReaderType::mergeInterfaceVertices(3, interfaceVertices), std::runtime_error);
+}
+
+TEST_F(MultiZoneMeshReadingFixture, zonesAreMergedIntoOneMesh) {
+  // arrange
+
+  // act
+  auto numberOfZones = meshReader_->getNumberOfZones();
+  const auto x = meshReader_->readCoordinate<AIM::Enum::Coordinate::X>();
+  const auto y = meshReader_->readCoordinate<AIM::Enum::Coordinate::Y>();
+
+  // assert
+  // the two vertices on the interface are only kept once, at the position of their occurrence in the first zone
+  EXPECT_EQ(numberOfZones, 2);
+  EXPECT_EQ(x, (MeshReaderType::CoordinateType{0.0, 0.5, 1.0, 0.0, 0.5, 1.0, 1.5, 2.0, 1.5, 2.0}));
+  EXPECT_EQ(y, (MeshReaderType::CoordinateType{0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 0.0, 0.0, 1.0, 1.0}));
+}
+
+TEST_F(MultiZoneMeshReadingFixture, readCoordinatesInChunksSkipsSharedVertices) {
+  // arrange
+  const auto x = meshReader_->readCoordinate<AIM::Enum::Coordinate::X>();
+  auto sut = MeshReaderType::CoordinateType{};
+  auto chunkSizes = std::vector<std::size_t>{};
+
+  // act
+  meshReader_->readCoordinateInChunks<AIM::Enum::Coordinate::X>(4, [&](std::size_t firstVertex, auto chunk) {
+    EXPECT_EQ(firstVertex, sut.size());
+    sut.insert(sut.end(), chunk.begin(), chunk.end());
+    chunkSizes.push_back(chunk.size());
+  });
+
+  // assert
+  EXPECT_EQ(sut, x);
+  EXPECT_EQ(chunkSizes, (std::vector<std::size_t>{4, 4, 2}));
+}
+
+TEST_F(MultiZoneMeshReadingFixture, connectivityTableUsesMergedVertices) {
+  // arrange
+  auto expected = std::vector<std::vector<AIM::Types::UInt>>{{0, 1, 4, 3}, {1, 2, 5, 4}, {2, 6, 8, 5}, {6, 7, 9, 8}};
+
+  // act
+  const auto sut = meshReader_->readConnectivityTable();
+
+  // assert
+  ASSERT_EQ(sut.size(), 4);
+  EXPECT_EQ(sut.getNumberOfIndices(), 16);
+  for (std::size_t cell = 0; cell < sut.size(); ++cell)
+    EXPECT_TRUE(std::ranges::equal(sut[cell], expected[cell]));
+}
+
+TEST_F(MultiZoneMeshReadingFixture, boundariesWithTheSameNameAreMerged) {
+  // arrange
+
+  // act
+  const auto boundaryConditions = meshReader_->readBoundaryConditions();
+  const auto boundaryElements = meshReader_->readBoundaryConditionConnectivity();
+
+  // assert
+  // boundaries are ordered by their first appearance, element indices of the second zone are offset by 7 elements
+  ASSERT_EQ(boundaryConditions.size(), 4);
+  EXPECT_EQ(boundaryConditions[0].first, AIM::Enum::BoundaryCondition::Wall);
+  EXPECT_EQ(boundaryConditions[1].first, AIM::Enum::BoundaryCondition::Inlet);
+  EXPECT_EQ(boundaryConditions[2].first, AIM::Enum::BoundaryCondition::Symmetry);
+  EXPECT_EQ(boundaryConditions[3].first, AIM::Enum::BoundaryCondition::Outlet);
+  EXPECT_EQ(boundaryConditions[0].second, "bottom");
+  EXPECT_EQ(boundaryConditions[1].second, "inlet");
+  EXPECT_EQ(boundaryConditions[2].second, "top");
+  EXPECT_EQ(boundaryConditions[3].second, "outlet");
+
+  ASSERT_EQ(boundaryElements.size(), 4);
+  EXPECT_EQ(boundaryElements[0], (std::vector<AIM::Types::CGNSInt>{3, 4, 10, 11}));
+  EXPECT_EQ(boundaryElements[1].front(), 5);
+  EXPECT_EQ(boundaryElements[2], (std::vector<AIM::Types::CGNSInt>{6, 7, 13, 14}));
+  EXPECT_EQ(boundaryElements[3].front(), 12);
+}
+
+TEST_F(MultiZoneMeshReadingFixture, boundaryFacesUseMergedVertices) {
+  // arrange
+  auto expected = std::vector<std::vector<AIM::Types::UInt>>{{0, 1, 1, 2, 2, 6, 6, 7}, {3, 0}, {5, 4, 4, 3, 9, 8, 8, 5},
+    {7, 9}};
+
+  // act
+  const auto sut = meshReader_->readBoundaryFaceConnectivity();
+
+  // assert
+  ASSERT_EQ(sut.size(), 4);
+  for (std::size_t boundary = 0; boundary < sut.size(); ++boundary)
+    EXPECT_TRUE(std::ranges::equal(sut[boundary].getIndices(), expected[boundary]));
+}
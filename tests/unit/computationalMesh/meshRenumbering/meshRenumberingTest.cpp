@@ -0,0 +1,187 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/computationalMesh/meshRenumbering/meshRenumbering.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+using MeshReaderType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>;
+using MeshRenumberingType = AIM::Mesh::MeshRenumbering<AIM::Enum::Dimension::Two>;
+
+class MeshRenumberingFixture : public ::testing::Test {
+public:
+  MeshRenumberingFixture() {}
+  void SetUp() override {
+    x_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::X>();
+    y_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::Y>();
+    cells_ = meshReader_.readConnectivityTable();
+    boundaryFaces_ = meshReader_.readBoundaryFaceConnectivity();
+  }
+
+  // a strip of six quads along the x-axis, numbered so that neighbouring cells are far apart in memory
+  static auto makeScrambledStrip() -> MeshRenumberingType::ConnectivityTableType {
+    auto cells = MeshRenumberingType::ConnectivityTableType{};
+    for (const auto &column : std::vector<AIM::Types::UInt>{0, 5, 1, 4, 2, 3})
+      cells.addCell(std::vector<AIM::Types::UInt>{column, column + 1, column + 8, column + 7});
+    return cells;
+  }
+
+  static auto isPermutation(const MeshRenumberingType::PermutationType& order) -> bool {
+    auto sorted = order;
+    std::ranges::sort(sorted);
+    auto identity = MeshRenumberingType::PermutationType(order.size());
+    std::iota(identity.begin(), identity.end(), AIM::Types::UInt{0});
+    return sorted == identity;
+  }
+
+protected:
+  MeshReaderType meshReader_{};
+  MeshReaderType::CoordinateType x_, y_;
+  MeshReaderType::ConnectivityTableType cells_;
+  MeshReaderType::BoundaryFaceConnectivityType boundaryFaces_;
+  std::vector<AIM::Types::FloatType> stripX_{0, 1, 2, 3, 4, 5, 6, 0, 1, 2, 3, 4, 5, 6};
+  std::vector<AIM::Types::FloatType> stripY_{0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1};
+};
+
+TEST_F(MeshRenumberingFixture, renumberingProducesValidPermutations) {
+  for (auto method : {AIM::Enum::Renumbering::NoRenumbering, AIM::Enum::Renumbering::ReverseCuthillMcKee,
+         AIM::Enum::Renumbering::HilbertCurve, AIM::Enum::Renumbering::MortonCurve}) {
+    // arrange
+    auto sut = MeshRenumberingType{method};
+
+    // act
+    sut.renumber({x_, y_}, cells_);
+
+    // assert
+    EXPECT_EQ(sut.getCellOrder().size(), cells_.size());
+    EXPECT_EQ(sut.getVertexOrder().size(), x_.size());
+    EXPECT_TRUE(isPermutation(sut.getCellOrder()));
+    EXPECT_TRUE(isPermutation(sut.getVertexOrder()));
+  }
+}
+
+TEST_F(MeshRenumberingFixture, permutedMeshDescribesTheSameGeometry) {
+  // arrange
+  auto sut = MeshRenumberingType{AIM::Enum::Renumbering::ReverseCuthillMcKee};
+  sut.renumber({x_, y_}, cells_);
+
+  // act
+  auto x = sut.permuteCoordinate(x_);
+  auto y = sut.permuteCoordinate(y_);
+  auto cells = sut.permuteConnectivityTable(cells_);
+  auto boundaryFaces = sut.permuteBoundaryFaces(boundaryFaces_);
+
+  // assert
+  ASSERT_EQ(cells.size(), cells_.size());
+  for (std::size_t cell = 0; cell < cells.size(); ++cell) {
+    auto originalCell = cells_[sut.getCellOrder()[cell]];
+    ASSERT_EQ(cells[cell].size(), originalCell.size());
+    for (std::size_t vertex = 0; vertex < originalCell.size(); ++vertex) {
+      EXPECT_DOUBLE_EQ(x[cells[cell][vertex]], x_[originalCell[vertex]]);
+      EXPECT_DOUBLE_EQ(y[cells[cell][vertex]], y_[originalCell[vertex]]);
+    }
+  }
+
+  ASSERT_EQ(boundaryFaces.size(), boundaryFaces_.size());
+  for (std::size_t boundary = 0; boundary < boundaryFaces.size(); ++boundary)
+    for (std::size_t face = 0; face < boundaryFaces[boundary].size(); ++face)
+      for (std::size_t vertex = 0; vertex < boundaryFaces[boundary][face].size(); ++vertex)
+        EXPECT_DOUBLE_EQ(x[boundaryFaces[boundary][face][vertex]], x_[boundaryFaces_[boundary][face][vertex]]);
+}
+
+TEST_F(MeshRenumberingFixture, renumberedCellsStayGroupedByElementType) {
+  for (auto method : {AIM::Enum::Renumbering::ReverseCuthillMcKee, AIM::Enum::Renumbering::HilbertCurve,
+         AIM::Enum::Renumbering::MortonCurve}) {
+    // arrange
+    auto sut = MeshRenumberingType{method};
+    sut.renumber({x_, y_}, cells_);
+
+    // act
+    auto cells = sut.permuteConnectivityTable(cells_);
+
+    // assert
+    auto numberOfVertices = std::vector<std::size_t>{};
+    for (const auto &cell : cells)
+      numberOfVertices.push_back(cell.size());
+    EXPECT_TRUE(std::ranges::is_sorted(numberOfVertices));
+  }
+}
+
+TEST_F(MeshRenumberingFixture, reverseCuthillMcKeeMinimisesBandwidthOfStrip) {
+  // arrange
+  auto cells = makeScrambledStrip();
+  auto sut = MeshRenumberingType{AIM::Enum::Renumbering::ReverseCuthillMcKee};
+
+  // act
+  sut.renumber({stripX_, stripY_}, cells);
+
+  // assert
+  EXPECT_EQ(sut.getStatisticsBefore().bandwidth, 2);
+  EXPECT_EQ(sut.getStatisticsBefore().profile, 8);
+  EXPECT_EQ(sut.getStatisticsAfter().bandwidth, 1);
+  EXPECT_EQ(sut.getStatisticsAfter().profile, 5);
+  EXPECT_EQ(MeshRenumberingType::computeStatistics(sut.permuteConnectivityTable(cells)).bandwidth, 1);
+}
+
+TEST_F(MeshRenumberingFixture, mortonCurveOrdersStripAlongTheAxis) {
+  // arrange
+  auto cells = makeScrambledStrip();
+  auto sut = MeshRenumberingType{AIM::Enum::Renumbering::MortonCurve};
+
+  // act
+  sut.renumber({stripX_, stripY_}, cells);
+
+  // assert
+  EXPECT_EQ(sut.getCellOrder(), (MeshRenumberingType::PermutationType{0, 2, 4, 5, 3, 1}));
+  EXPECT_EQ(sut.getStatisticsAfter().bandwidth, 1);
+}
+
+TEST_F(MeshRenumberingFixture, hilbertCurveVisitsNeighbouringQuadrantsConsecutively) {
+  // arrange
+  auto cells = MeshRenumberingType::ConnectivityTableType{};
+  cells.addCell(std::vector<AIM::Types::UInt>{0, 1, 4, 3});
+  cells.addCell(std::vector<AIM::Types::UInt>{1, 2, 5, 4});
+  cells.addCell(std::vector<AIM::Types::UInt>{3, 4, 7, 6});
+  cells.addCell(std::vector<AIM::Types::UInt>{4, 5, 8, 7});
+  auto x = std::vector<AIM::Types::FloatType>{0, 1, 2, 0, 1, 2, 0, 1, 2};
+  auto y = std::vector<AIM::Types::FloatType>{0, 0, 0, 1, 1, 1, 2, 2, 2};
+  auto sut = MeshRenumberingType{AIM::Enum::Renumbering::HilbertCurve};
+
+  // act
+  sut.renumber({x, y}, cells);
+
+  // assert
+  const auto &order = sut.getCellOrder();
+  EXPECT_EQ(order.front(), 0);
+  for (std::size_t cell = 1; cell < order.size(); ++cell) {
+    auto previous = cells[order[cell - 1]];
+    auto current = cells[order[cell]];
+    auto sharedVertices = std::ranges::count_if(
+      current, [&previous](auto vertex) { return std::ranges::find(previous, vertex) != previous.end(); });
+    EXPECT_EQ(sharedVertices, 2);
+  }
+}
+
+TEST_F(MeshRenumberingFixture, unknownMethodThrows) {
+  // arrange
+
+  // act
+  auto rcm = MeshRenumberingType::getMethodFromString("reverseCuthillMcKee");
+
+  // assert
+  EXPECT_EQ(rcm, AIM::Enum::Renumbering::ReverseCuthillMcKee);
+  EXPECT_THROW(MeshRenumberingType::getMethodFromString("metis"), std::runtime_error);
+}
@@ -0,0 +1,149 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+// AIM include headers
+#include "src/computationalMesh/distributedMeshReading/distributedMeshReading.hpp"
+#include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+using DistributedMeshReaderType = AIM::Mesh::DistributedMeshReader<AIM::Enum::Dimension::Two>;
+using MeshReaderType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>;
+
+class DistributedMeshReaderFixture : public ::testing::Test {
+public:
+  DistributedMeshReaderFixture() {}
+  void SetUp() override {
+    auto meshReader = MeshReaderType{};
+    x_ = meshReader.readCoordinate<AIM::Enum::Coordinate::X>();
+    y_ = meshReader.readCoordinate<AIM::Enum::Coordinate::Y>();
+    connectivityTable_ = meshReader.readConnectivityTable();
+  }
+
+protected:
+  static auto sumOverRanks(std::size_t value) -> std::size_t {
+    auto sum = std::size_t{0};
+    MPI_Allreduce(&value, &sum, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    return sum;
+  }
+
+protected:
+  MeshReaderType::CoordinateType x_, y_;
+  MeshReaderType::ConnectivityTableType connectivityTable_;
+};
+
+TEST(DistributedMeshReaderTest, blockOwnerMatchesBlockRanges) {
+  // arrange
+  constexpr auto size = std::size_t{10};
+  constexpr auto numberOfRanks = int{4};
+
+  // act
+  auto ranges = std::vector<DistributedMeshReaderType::RangeType>{};
+  for (int rank = 0; rank < numberOfRanks; ++rank)
+    ranges.push_back(DistributedMeshReaderType::getBlockRange(size, rank, numberOfRanks));
+
+  // assert
+  EXPECT_EQ(ranges, (std::vector<DistributedMeshReaderType::RangeType>{{0, 3}, {3, 6}, {6, 8}, {8, 10}}));
+  for (int rank = 0; rank < numberOfRanks; ++rank)
+    for (auto index = ranges[rank].first; index < ranges[rank].second; ++index)
+      EXPECT_EQ(DistributedMeshReaderType::getBlockOwner(index, size, numberOfRanks), rank);
+}
+
+TEST_F(DistributedMeshReaderFixture, slicesCoverTheWholeMesh) {
+  // arrange
+  auto sut = DistributedMeshReaderType{MPI_COMM_WORLD};
+
+  // act
+  auto [firstVertex, lastVertex] = sut.getVertexRange();
+  auto [firstCell, lastCell] = sut.getCellRange();
+
+  // assert
+  EXPECT_EQ(sut.getNumberOfVertices(), 10);
+  EXPECT_EQ(sut.getNumberOfCells(), 8);
+  EXPECT_EQ(sumOverRanks(lastVertex - firstVertex), 10);
+  EXPECT_EQ(sumOverRanks(lastCell - firstCell), 8);
+}
+
+TEST_F(DistributedMeshReaderFixture, slicesMatchSerialReading) {
+  // arrange
+  auto sut = DistributedMeshReaderType{MPI_COMM_WORLD};
+  auto [firstVertex, lastVertex] = sut.getVertexRange();
+  auto [firstCell, lastCell] = sut.getCellRange();
+
+  // act
+  auto x = sut.readCoordinateSlice<AIM::Enum::Coordinate::X>();
+  auto y = sut.readCoordinateSlice<AIM::Enum::Coordinate::Y>();
+  auto cells = sut.readConnectivityTableSlice();
+
+  // assert
+  EXPECT_TRUE(std::ranges::equal(x, std::span{x_}.subspan(firstVertex, lastVertex - firstVertex)));
+  EXPECT_TRUE(std::ranges::equal(y, std::span{y_}.subspan(firstVertex, lastVertex - firstVertex)));
+  ASSERT_EQ(cells.size(), lastCell - firstCell);
+  for (std::size_t cell = 0; cell < cells.size(); ++cell)
+    EXPECT_TRUE(std::ranges::equal(cells[cell], connectivityTable_[firstCell + cell]));
+}
+
+TEST_F(DistributedMeshReaderFixture, distributeKeepsBlocksByDefault) {
+  // arrange
+  auto sut = DistributedMeshReaderType{MPI_COMM_WORLD};
+  auto [firstCell, lastCell] = sut.getCellRange();
+
+  // act
+  auto localMesh = sut.distribute();
+
+  // assert
+  EXPECT_TRUE(std::ranges::equal(localMesh.globalCells, std::views::iota(firstCell, lastCell)));
+}
+
+TEST_F(DistributedMeshReaderFixture, distributeSendsCellsAndVerticesToTargetRanks) {
+  // arrange
+  auto sut = DistributedMeshReaderType{MPI_COMM_WORLD};
+  auto [firstCell, lastCell] = sut.getCellRange();
+  auto targetRanks = std::vector<int>{};
+  for (auto cell = firstCell; cell < lastCell; ++cell)
+    targetRanks.push_back(static_cast<int>(cell % static_cast<std::size_t>(sut.getNumberOfRanks())));
+
+  // act
+  auto localMesh = sut.distribute(targetRanks);
+
+  // assert
+  EXPECT_EQ(sumOverRanks(localMesh.cells.size()), 8);
+  EXPECT_TRUE(std::ranges::is_sorted(localMesh.globalCells));
+  EXPECT_EQ(localMesh.coordinates[AIM::Enum::Coordinate::X].size(), localMesh.globalVertices.size());
+  for (std::size_t cell = 0; cell < localMesh.cells.size(); ++cell) {
+    auto globalCell = static_cast<std::size_t>(localMesh.globalCells[cell]);
+    EXPECT_EQ(globalCell % static_cast<std::size_t>(sut.getNumberOfRanks()), sut.getRank());
+    auto toGlobal = std::views::transform([&](auto vertex) { return localMesh.globalVertices[vertex]; });
+    EXPECT_TRUE(std::ranges::equal(localMesh.cells[cell] | toGlobal, connectivityTable_[globalCell]));
+  }
+  for (std::size_t vertex = 0; vertex < localMesh.globalVertices.size(); ++vertex) {
+    EXPECT_DOUBLE_EQ(localMesh.coordinates[AIM::Enum::Coordinate::X][vertex], x_[localMesh.globalVertices[vertex]]);
+    EXPECT_DOUBLE_EQ(localMesh.coordinates[AIM::Enum::Coordinate::Y][vertex], y_[localMesh.globalVertices[vertex]]);
+  }
+}
+
+TEST_F(DistributedMeshReaderFixture, invalidTargetRanksThrow) {
+  // arrange
+  auto sut = DistributedMeshReaderType{MPI_COMM_WORLD};
+  auto [firstCell, lastCell] = sut.getCellRange();
+  auto targetRanks = std::vector<int>(lastCell - firstCell, sut.getNumberOfRanks());
+
+  // act
+
+  // assert
+  EXPECT_THROW(sut.distribute(targetRanks), std::runtime_error);
+  EXPECT_THROW(sut.distribute(std::vector<int>(lastCell - firstCell + 1, 0)), std::runtime_error);
+}
@@ -0,0 +1,101 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/computationalMesh/computationalMesh/computationalMesh.hpp"
+#include "src/computationalMesh/meshPrefetch/meshPrefetch.hpp"
+#include "src/computationalMesh/meshReading/meshReading.hpp"
+#include "src/types/enums.hpp"
+#include "src/types/types.hpp"
+
+using MeshReaderType = AIM::Mesh::MeshReader<AIM::Enum::Dimension::Two>;
+using MeshPrefetchType = AIM::Mesh::MeshPrefetch<AIM::Enum::Dimension::Two>;
+
+class ParallelMeshLoadingFixture : public ::testing::Test {
+public:
+  ParallelMeshLoadingFixture() {}
+  void SetUp() override {
+    x_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::X>();
+    y_ = meshReader_.readCoordinate<AIM::Enum::Coordinate::Y>();
+    connectivityTable_ = meshReader_.readConnectivityTable();
+    bc_ = meshReader_.readBoundaryConditions();
+    bcc_ = meshReader_.readBoundaryConditionConnectivity();
+  }
+
+protected:
+  MeshReaderType meshReader_{};
+  MeshReaderType::CoordinateType x_, y_;
+  MeshReaderType::ConnectivityTableType connectivityTable_;
+  MeshReaderType::BoundaryConditionType bc_;
+  MeshReaderType::BoundaryConditionConnectivityType bcc_;
+};
+
+TEST_F(ParallelMeshLoadingFixture, parallelLoadingMatchesSequentialReadingTest) {
+  // arrange
+  auto sut = AIM::Mesh::ComputationalMesh{meshReader_};
+
+  // act
+  auto x = sut.getCoordinateX();
+  auto y = sut.getCoordinateY();
+  const auto &connectivityTable = sut.getConnectivityTable();
+
+  // assert
+  EXPECT_TRUE(std::ranges::equal(x, x_));
+  EXPECT_TRUE(std::ranges::equal(y, y_));
+  EXPECT_TRUE(std::ranges::equal(connectivityTable.getOffsets(), connectivityTable_.getOffsets()));
+  EXPECT_TRUE(std::ranges::equal(connectivityTable.getIndices(), connectivityTable_.getIndices()));
+  EXPECT_EQ(sut.getBoundaryConditionInfo(), bc_);
+  EXPECT_EQ(sut.getBoundaryConditionConnvectivity(), bcc_);
+}
+
+TEST_F(ParallelMeshLoadingFixture, concurrentReadsFromSingleReaderTest) {
+  // arrange
+  constexpr auto numberOfTasks = std::size_t{8};
+  auto connectivityTables = std::vector<std::future<MeshReaderType::ConnectivityTableType>>{};
+  auto coordinates = std::vector<std::future<MeshReaderType::CoordinateType>>{};
+  auto boundaryConditions = std::vector<std::future<MeshReaderType::BoundaryConditionConnectivityType>>{};
+
+  // act
+  for (std::size_t task = 0; task < numberOfTasks; ++task) {
+    connectivityTables.push_back(
+      std::async(std::launch::async, [this]() { return meshReader_.readConnectivityTable(); }));
+    coordinates.push_back(
+      std::async(std::launch::async, [this]() { return meshReader_.readCoordinate<AIM::Enum::Coordinate::X>(); }));
+    boundaryConditions.push_back(
+      std::async(std::launch::async, [this]() { return meshReader_.readBoundaryConditionConnectivity(); }));
+  }
+
+  // assert
+  for (std::size_t task = 0; task < numberOfTasks; ++task) {
+    auto connectivityTable = connectivityTables[task].get();
+    EXPECT_TRUE(std::ranges::equal(connectivityTable.getIndices(), connectivityTable_.getIndices()));
+    EXPECT_TRUE(std::ranges::equal(coordinates[task].get(), x_));
+    EXPECT_EQ(boundaryConditions[task].get(), bcc_);
+  }
+}
+
+TEST_F(ParallelMeshLoadingFixture, parallelPrefetchMatchesSequentialReadingTest) {
+  // arrange
+  auto meshPrefetch = MeshPrefetchType{};
+
+  // act
+  auto sut = AIM::Mesh::ComputationalMesh{meshPrefetch};
+
+  // assert
+  EXPECT_TRUE(std::ranges::equal(sut.getCoordinateX(), x_));
+  EXPECT_TRUE(std::ranges::equal(sut.getCoordinateY(), y_));
+  EXPECT_TRUE(std::ranges::equal(sut.getConnectivityTable().getOffsets(), connectivityTable_.getOffsets()));
+  EXPECT_TRUE(std::ranges::equal(sut.getConnectivityTable().getIndices(), connectivityTable_.getIndices()));
+  EXPECT_EQ(sut.getBoundaryConditionInfo(), bc_);
+  EXPECT_EQ(sut.getBoundaryConditionConnvectivity(), bcc_);
+}
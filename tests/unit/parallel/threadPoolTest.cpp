@@ -0,0 +1,117 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/utilities/threadPool/threadPool.hpp"
+
+using ThreadPoolType = AIM::Utilities::ThreadPool;
+
+TEST(ThreadPoolTest, sharedPoolReadsNumberOfThreadsFromInputFileTest) {
+  // act
+  const auto &sut = ThreadPoolType::getInstance();
+
+  // assert
+  EXPECT_EQ(sut.getNumberOfThreads(), 4);
+}
+
+TEST(ThreadPoolTest, parallelForVisitsEveryIndexOnceInWholeChunksTest) {
+  // arrange
+  auto sut = ThreadPoolType{4};
+  auto begin = std::size_t{3};
+  auto end = std::size_t{100003};
+  auto grainSize = std::size_t{1000};
+  auto visits = std::vector<std::atomic<int>>(end);
+  auto isAligned = std::atomic<bool>{true};
+
+  // act
+  sut.parallelFor(
+    begin, end,
+    [&visits, &isAligned, begin, end, grainSize](std::size_t chunkBegin, std::size_t chunkEnd) {
+      if ((chunkBegin - begin) % grainSize != 0 || chunkEnd != std::min(end, chunkBegin + grainSize))
+        isAligned = false;
+      for (auto index = chunkBegin; index < chunkEnd; ++index)
+        visits[index].fetch_add(1);
+    },
+    grainSize);
+
+  // assert
+  EXPECT_TRUE(isAligned);
+  for (std::size_t index = 0; index < visits.size(); ++index)
+    ASSERT_EQ(visits[index], index < begin ? 0 : 1);
+}
+
+TEST(ThreadPoolTest, parallelReduceIsIndependentOfNumberOfThreadsTest) {
+  // arrange
+  auto values = std::vector<double>(1 << 20);
+  for (std::size_t index = 0; index < values.size(); ++index)
+    values[index] = 1.0 / static_cast<double>(index + 1) * (index % 2 == 0 ? 1.0 : -1e-3);
+  auto sum = [&values](std::size_t begin, std::size_t end) {
+    return std::accumulate(values.begin() + static_cast<std::ptrdiff_t>(begin),
+      values.begin() + static_cast<std::ptrdiff_t>(end), 0.0);
+  };
+
+  // act
+  auto sequential = ThreadPoolType{1}.parallelReduce(0, values.size(), 0.0, sum, std::plus<>{});
+  auto parallel = ThreadPoolType{4}.parallelReduce(0, values.size(), 0.0, sum, std::plus<>{});
+  auto oversubscribed = ThreadPoolType{16}.parallelReduce(0, values.size(), 0.0, sum, std::plus<>{});
+
+  // assert
+  EXPECT_EQ(sequential, parallel);
+  EXPECT_EQ(sequential, oversubscribed);
+  EXPECT_NEAR(sequential, std::accumulate(values.begin(), values.end(), 0.0), 1e-12);
+}
+
+TEST(ThreadPoolTest, nestedLoopsDoNotDeadlockTest) {
+  // arrange
+  auto sut = ThreadPoolType{4};
+  auto count = std::atomic<std::size_t>{0};
+
+  // act
+  sut.parallelFor(
+    0, 64,
+    [&sut, &count](std::size_t begin, std::size_t end) {
+      for (auto outer = begin; outer < end; ++outer)
+        sut.parallelFor(
+          0, 1000, [&count](std::size_t innerBegin, std::size_t innerEnd) { count += innerEnd - innerBegin; }, 10);
+    },
+    1);
+
+  // assert
+  EXPECT_EQ(count, 64 * 1000);
+}
+
+TEST(ThreadPoolTest, exceptionsAreRethrownOnCallingThreadTest) {
+  // arrange
+  auto sut = ThreadPoolType{4};
+  auto processed = std::atomic<std::size_t>{0};
+
+  // act
+  auto loop = [&sut, &processed]() {
+    sut.parallelFor(
+      0, 100,
+      [&processed](std::size_t begin, std::size_t) {
+        ++processed;
+        if (begin == 42)
+          throw std::runtime_error("chunk failed");
+      },
+      1);
+  };
+
+  // assert
+  EXPECT_THROW(loop(), std::runtime_error);
+  EXPECT_EQ(processed, 100);
+}
@@ -4,6 +4,7 @@
 
 // c++ include headers
 #include <filesystem>
+#include <fstream>
 
 // third-party include headers
 #include <gtest/gtest.h>
@@ -46,4 +47,21 @@ TEST(parameterFileReadingTest, expectThrowForMissingParameterWithoutDefaultValue
   EXPECT_THROW(AIM::Parameters::ParameterFileReading::readParameterOrGetDefaultValue<std::string>(
                  file, "/non/existing/parameter", std::nullopt),
     std::runtime_error);
+}
+
+TEST(parameterFileReadingTest, fileIsParsedOnlyOnceUntilItIsModifiedTest) {
+  // arrange
+  auto file = std::filesystem::path("cachedParameters.json");
+  std::ofstream{file} << R"({"value": 1})";
+
+  // act
+  auto firstRead = AIM::Parameters::ParameterFileReading::getJSONFile(file);
+  auto secondRead = AIM::Parameters::ParameterFileReading::getJSONFile(file);
+  std::ofstream{file} << R"({"value": 2})";
+  auto value = AIM::Parameters::ParameterFileReading::readParameterOrGetDefaultValue<int>(file, "/value", std::nullopt);
+  std::filesystem::remove(file);
+
+  // assert
+  EXPECT_EQ(firstRead.get(), secondRead.get());
+  EXPECT_EQ(value, 2);
 }
\ No newline at end of file
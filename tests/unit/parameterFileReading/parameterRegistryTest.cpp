@@ -0,0 +1,98 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/parameterFileReading/parameterRegistry.hpp"
+
+TEST(parameterRegistryTest, declaredParametersAreAvailableAfterValidationTest) {
+  // arrange
+  auto parameters = AIM::Parameters::ParameterRegistry{"aim.json"};
+  auto meshFile = parameters.declare<std::string>("/mesh/filename", std::nullopt);
+  auto useCache = parameters.declare<bool>("/mesh/cache", true);
+
+  // act
+  parameters.validate();
+
+  // assert
+  EXPECT_TRUE(parameters.isValidated());
+  EXPECT_STREQ(parameters.get(meshFile).c_str(), "input/mesh.cgns");
+  EXPECT_TRUE(parameters.get(useCache));
+}
+
+TEST(parameterRegistryTest, validationReportsAllInvalidParametersAtOnceTest) {
+  // arrange
+  auto file = std::filesystem::path("invalidParameters.json");
+  std::ofstream{file} << R"({"mesh": {"cache": "yes", "filename": "mesh.cgns"}})";
+  auto parameters = AIM::Parameters::ParameterRegistry{file};
+  parameters.declare<bool>("/mesh/cache", false);
+  parameters.declare<std::string>("/mesh/filename", std::nullopt);
+  parameters.declare<int>("/mesh/numberOfZones", std::nullopt);
+  std::filesystem::remove(file);
+
+  // act
+  auto message = std::string{};
+  try {
+    parameters.validate();
+  } catch (const std::runtime_error& e) {
+    message = e.what();
+  }
+
+  // assert
+  EXPECT_FALSE(parameters.isValidated());
+  EXPECT_NE(message.find("2 invalid parameter(s)"), std::string::npos);
+  EXPECT_NE(message.find("/mesh/cache"), std::string::npos);
+  EXPECT_NE(message.find("/mesh/numberOfZones"), std::string::npos);
+  EXPECT_EQ(message.find("/mesh/filename"), std::string::npos);
+}
+
+TEST(parameterRegistryTest, declaringAfterValidationRequiresNewValidationTest) {
+  // arrange
+  auto parameters = AIM::Parameters::ParameterRegistry{"aim.json"};
+  auto meshFile = parameters.declare<std::string>("/mesh/filename", std::nullopt);
+  parameters.validate();
+
+  // act
+  auto renumbering = parameters.declare<std::string>("/mesh/renumbering", "none");
+  auto isValidatedAfterDeclaration = parameters.isValidated();
+  parameters.validate();
+
+  // assert
+  EXPECT_FALSE(isValidatedAfterDeclaration);
+  EXPECT_STREQ(parameters.get(meshFile).c_str(), "input/mesh.cgns");
+  EXPECT_STREQ(parameters.get(renumbering).c_str(), "none");
+}
+
+TEST(parameterRegistryTest, valuesRejectedByPredicateAreReportedTest) {
+  // arrange
+  auto file = std::filesystem::path("outOfRangeParameters.json");
+  std::ofstream{file} << R"({"parallel": {"numberOfThreads": -2}})";
+  auto parameters = AIM::Parameters::ParameterRegistry{file};
+  auto isNotNegative = [](int value) { return value >= 0; };
+  parameters.declare<int>("/parallel/numberOfThreads", 0, isNotNegative, "be at least 0");
+  parameters.declare<int>("/parallel/numberOfPartitions", 1, isNotNegative, "be at least 0");
+  std::filesystem::remove(file);
+
+  // act
+  auto message = std::string{};
+  try {
+    parameters.validate();
+  } catch (const std::runtime_error& e) {
+    message = e.what();
+  }
+
+  // assert
+  EXPECT_FALSE(parameters.isValidated());
+  EXPECT_NE(message.find("1 invalid parameter(s)"), std::string::npos);
+  EXPECT_NE(message.find("/parallel/numberOfThreads\" has the value -2, but it must be at least 0"), std::string::npos);
+  EXPECT_EQ(message.find("/parallel/numberOfPartitions"), std::string::npos);
+}
@@ -0,0 +1,74 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+#include "nlohmann/json.hpp"
+
+// AIM include headers
+#include "src/utilities/hardwareCounters/hardwareCounters.hpp"
+#include "src/utilities/instrumentation/instrumentation.hpp"
+
+using HardwareCountersType = AIM::Utilities::HardwareCounters;
+
+TEST(HardwareCountersTest, sampleIsOnlyAvailableIfCountersCanBeOpened) {
+  // act
+  auto sample = HardwareCountersType::getSample();
+
+  // assert
+  ASSERT_EQ(sample.has_value(), HardwareCountersType::isAvailable());
+}
+
+TEST(HardwareCountersTest, instructionsOfRegionAreCounted) {
+  if (!HardwareCountersType::isAvailable() || !HardwareCountersType::isCounted(HardwareCountersType::Instructions))
+    GTEST_SKIP() << "hardware counters are not available on this machine";
+
+  // arrange
+  auto values = std::vector<std::uint64_t>(1 << 16);
+  std::iota(values.begin(), values.end(), std::uint64_t{0});
+
+  // act
+  auto start = HardwareCountersType::getSample();
+  auto sum = std::accumulate(values.begin(), values.end(), std::uint64_t{0});
+  auto end = HardwareCountersType::getSample();
+
+  // assert
+  ASSERT_TRUE(start && end);
+  ASSERT_EQ(sum, values.size() * (values.size() - 1) / 2);
+  auto counts = HardwareCountersType::getDifference(*start, *end);
+  ASSERT_GT(counts[HardwareCountersType::Instructions], values.size());
+}
+
+TEST(HardwareCountersTest, differenceIsScaledForMultiplexedCounters) {
+  // arrange
+  auto start = HardwareCountersType::SampleType{{100, 200, 0, 0, 0}, 1000, 500};
+  auto end = HardwareCountersType::SampleType{{300, 600, 0, 0, 0}, 3000, 1500};
+
+  // act
+  auto counts = HardwareCountersType::getDifference(start, end);
+
+  // assert
+  ASSERT_EQ(counts[HardwareCountersType::Instructions], 400);
+  ASSERT_EQ(counts[HardwareCountersType::Cycles], 800);
+  ASSERT_EQ(counts[HardwareCountersType::BranchMisses], 0);
+}
+
+TEST(HardwareCountersTest, profiledScopeAddsAvailableCountersToReport) {
+  // act
+  { auto scope = AIM::Utilities::ProfiledScope{"profiledRegion"}; }
+  auto report = nlohmann::json::parse(AIM::Utilities::Instrumentation::getReport());
+
+  // assert
+  const auto &region = report["scopes"]["profiledRegion"];
+  ASSERT_EQ(region["calls"], 1);
+  auto isReported = region.contains("children") && region["children"].contains("instructions");
+  ASSERT_EQ(isReported, HardwareCountersType::isCounted(HardwareCountersType::Instructions));
+}
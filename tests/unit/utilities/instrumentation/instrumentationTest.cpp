@@ -0,0 +1,114 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <future>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+#include "nlohmann/json.hpp"
+
+// AIM include headers
+#include "src/utilities/instrumentation/instrumentation.hpp"
+
+class InstrumentationFixture : public ::testing::Test {
+public:
+  void SetUp() override { AIM::Utilities::Instrumentation::reset(); }
+
+protected:
+  auto getReport() const -> nlohmann::json {
+    return nlohmann::json::parse(AIM::Utilities::Instrumentation::getReport());
+  }
+};
+
+TEST_F(InstrumentationFixture, nestedScopesAreReportedAsChildren) {
+  // arrange
+  {
+    auto outer = AIM::Utilities::ScopedTimer{"nestedOuter"};
+    for (int call = 0; call < 3; ++call)
+      auto inner = AIM::Utilities::ScopedTimer{"nestedInner"};
+  }
+
+  // act
+  auto report = getReport();
+
+  // assert
+  const auto &outer = report["scopes"]["nestedOuter"];
+  ASSERT_EQ(outer["calls"], 1);
+  ASSERT_EQ(outer["children"]["nestedInner"]["calls"], 3);
+  ASSERT_GE(outer["seconds"].get<double>(), outer["children"]["nestedInner"]["seconds"].get<double>());
+  ASSERT_FALSE(report["scopes"].contains("nestedInner"));
+}
+
+TEST_F(InstrumentationFixture, countersAccumulateValues) {
+  // arrange
+  {
+    auto scope = AIM::Utilities::ScopedTimer{"counterScope"};
+    AIM::Utilities::Instrumentation::addToCounter("counterBytes", 10);
+    AIM::Utilities::Instrumentation::addToCounter("counterBytes", 32);
+  }
+
+  // act
+  auto report = getReport();
+
+  // assert
+  const auto &counter = report["scopes"]["counterScope"]["children"]["counterBytes"];
+  ASSERT_EQ(counter["calls"], 2);
+  ASSERT_EQ(counter["value"], 42);
+  ASSERT_FALSE(counter.contains("seconds"));
+}
+
+TEST_F(InstrumentationFixture, scopesOfSeveralThreadsAreMerged) {
+  // arrange
+  auto workers = std::vector<std::future<void>>{};
+  for (int thread = 0; thread < 4; ++thread)
+    workers.push_back(std::async(std::launch::async, []() {
+      auto scope = AIM::Utilities::ScopedTimer{"mergedWorker"};
+      AIM::Utilities::Instrumentation::addToCounter("mergedItems", 5);
+    }));
+  for (auto &worker : workers)
+    worker.get();
+
+  // act
+  auto report = getReport();
+
+  // assert
+  ASSERT_GE(report["threads"], 2);
+  ASSERT_EQ(report["scopes"]["mergedWorker"]["calls"], 4);
+  ASSERT_EQ(report["scopes"]["mergedWorker"]["children"]["mergedItems"]["value"], 20);
+}
+
+TEST_F(InstrumentationFixture, resetClearsAccumulators) {
+  // arrange
+  { auto scope = AIM::Utilities::ScopedTimer{"resetScope"}; }
+
+  // act
+  AIM::Utilities::Instrumentation::reset();
+  auto report = getReport();
+
+  // assert
+  ASSERT_EQ(report["scopes"]["resetScope"]["calls"], 0);
+  ASSERT_EQ(report["scopes"]["resetScope"]["seconds"], 0.0);
+}
+
+TEST_F(InstrumentationFixture, macrosAreOnlyRecordedIfEnabled) {
+  // arrange
+  {
+    AIM_INSTRUMENT_SCOPE("macroScope");
+    AIM_INSTRUMENT_COUNT("macroCounter", 7);
+  }
+
+  // act
+  auto report = getReport();
+
+  // assert
+  if (AIM::Utilities::Instrumentation::isEnabled()) {
+    ASSERT_EQ(report["scopes"]["macroScope"]["calls"], 1);
+    ASSERT_EQ(report["scopes"]["macroScope"]["children"]["macroCounter"]["value"], 7);
+  } else {
+    ASSERT_FALSE(report["scopes"].contains("macroScope"));
+  }
+}
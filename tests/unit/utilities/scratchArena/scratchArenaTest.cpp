@@ -0,0 +1,89 @@
+// This file is part of Artificial-based Incompressibile Methods (AIM), a CFD solver for exact projection
+// methods based on hybrid Artificial compressibility and Pressure Projection methods.
+// (c) by Tom-Robin Teschner 2021-present. This file is distribuited under the MIT license.
+
+// c++ include headers
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+// third-party include headers
+#include <gtest/gtest.h>
+
+// AIM include headers
+#include "src/utilities/scratchArena/scratchArena.hpp"
+
+using ScratchArenaType = AIM::Utilities::ScratchArena;
+
+namespace {
+auto allocateTemporaries(std::pmr::memory_resource *resource) -> std::uint64_t {
+  auto sum = std::uint64_t{0};
+  for (std::size_t size = 1; size <= 4096; size *= 2) {
+    auto values = std::pmr::vector<std::uint64_t>(size, resource);
+    std::iota(values.begin(), values.end(), std::uint64_t{0});
+    sum += std::accumulate(values.begin(), values.end(), std::uint64_t{0});
+  }
+  return sum;
+}
+}  // namespace
+
+TEST(ScratchArenaTest, repeatedWorkloadIsServedFromRetainedBufferTest) {
+  // arrange
+  auto sut = ScratchArenaType{};
+  auto firstSum = allocateTemporaries(sut.getResource());
+  auto firstUpstreamAllocations = sut.getNumberOfUpstreamAllocations();
+
+  // act
+  sut.release();
+  auto secondSum = allocateTemporaries(sut.getResource());
+
+  // assert
+  EXPECT_EQ(firstSum, secondSum);
+  EXPECT_GT(firstUpstreamAllocations, 0);
+  EXPECT_GE(sut.getCapacity(), 8191 * sizeof(std::uint64_t));
+  EXPECT_EQ(sut.getNumberOfUpstreamAllocations(), 0);
+}
+
+TEST(ScratchArenaTest, retainedCapacityIsLimitedTest) {
+  // arrange
+  auto sut = ScratchArenaType{4096};
+  allocateTemporaries(sut.getResource());
+
+  // act
+  sut.release();
+
+  // assert
+  EXPECT_EQ(sut.getCapacity(), 4096);
+  EXPECT_EQ(sut.getNumberOfUpstreamAllocations(), 0);
+}
+
+TEST(ScratchArenaTest, nestedScopesReleaseWhenOutermostScopeEndsTest) {
+  // arrange
+  auto upstreamAllocationsAfterInnerScope = std::size_t{0};
+  auto upstreamAllocationsAfterOuterScope = std::size_t{0};
+  auto outerValues = std::vector<int>{};
+
+  // act
+  // a new thread starts with an empty thread-local arena
+  std::thread([&]() {
+    {
+      auto outer = AIM::Utilities::ScratchScope{};
+      auto values = std::pmr::vector<int>(1000, 1, outer.getResource());
+      {
+        auto inner = AIM::Utilities::ScratchScope{};
+        auto innerValues = std::pmr::vector<int>(1000, 2, inner.getResource());
+      }
+      upstreamAllocationsAfterInnerScope = ScratchArenaType::getThreadLocal().getNumberOfUpstreamAllocations();
+      outerValues.assign(values.begin(), values.end());
+    }
+    upstreamAllocationsAfterOuterScope = ScratchArenaType::getThreadLocal().getNumberOfUpstreamAllocations();
+  }).join();
+
+  // assert
+  EXPECT_GT(upstreamAllocationsAfterInnerScope, 0);
+  EXPECT_EQ(upstreamAllocationsAfterOuterScope, 0);
+  EXPECT_EQ(outerValues, std::vector<int>(1000, 1));
+}